@@ -0,0 +1,68 @@
+############################# INTELLECTUAL PROPERTY RIGHTS #############################
+##                                                                                    ##
+##                           Copyright (c) 2025 Terminus LLC                          ##
+##                                All Rights Reserved.                                ##
+##                                                                                    ##
+##          Use of this source code is governed by LICENSE in the repo root.          ##
+##                                                                                    ##
+############################# INTELLECTUAL PROPERTY RIGHTS #############################
+#
+#    File:    TerminusEmbedResources.cmake
+#    Author:  Marvin Smith
+#    Date:    10/19/2026
+#
+#    Purpose:  Compile resources into a target as a constexpr resource bundle.
+#
+#    Usage:
+#
+#      terminus_embed_resources( <target>
+#                                RESOURCES <name> [<name> ...]
+#                                [FORMAT GRAY|GRAY_ALPHA|RGB|RGBA] )
+#
+#    Each name is a path relative to cpp/resources.  Images are converted to native frames
+#    in the requested pixel format (RGBA by default) and packed, along with any other files,
+#    into a bundle which is emitted as a constexpr byte array.  The target gets the generated
+#    source plus the TERMINUS_EMBEDDED_RESOURCES definition, which makes the Session fall back
+#    to the embedded bundle when none is found on disk.
+#
+#    Cross-compiled builds (ie Pico) cannot run a target built for the device, so point
+#    TERMINUS_ASSET_BUILDER at an asset_builder executable built for the host.
+
+set( TERMINUS_ASSET_BUILDER "" CACHE FILEPATH "Host asset_builder executable used when cross-compiling" )
+
+function( terminus_embed_resources TARGET_NAME )
+
+    cmake_parse_arguments( EMBED "" "FORMAT" "RESOURCES" ${ARGN} )
+
+    if( NOT EMBED_FORMAT )
+        set( EMBED_FORMAT RGBA )
+    endif()
+
+    #  Find the converter
+    if( TERMINUS_ASSET_BUILDER )
+        set( BUILDER ${TERMINUS_ASSET_BUILDER} )
+        set( BUILDER_DEPENDS ${TERMINUS_ASSET_BUILDER} )
+    elseif( TARGET asset_builder )
+        set( BUILDER asset_builder )
+        set( BUILDER_DEPENDS asset_builder )
+    else()
+        message( FATAL_ERROR "terminus_embed_resources() needs TERMINUS_ASSET_BUILDER set to a host asset_builder executable" )
+    endif()
+
+    set( RESOURCE_INPUTS )
+    foreach( RESOURCE_NAME ${EMBED_RESOURCES} )
+        list( APPEND RESOURCE_INPUTS ${CMAKE_SOURCE_DIR}/cpp/resources/${RESOURCE_NAME} )
+    endforeach()
+
+    set( GENERATED_SOURCE ${CMAKE_CURRENT_BINARY_DIR}/generated/${TARGET_NAME}_embedded_resources.cpp )
+
+    add_custom_command( OUTPUT  ${GENERATED_SOURCE}
+                        COMMAND ${BUILDER} embed ${CMAKE_SOURCE_DIR}/cpp/resources ${GENERATED_SOURCE}
+                                --format ${EMBED_FORMAT} ${EMBED_RESOURCES}
+                        DEPENDS ${BUILDER_DEPENDS} ${RESOURCE_INPUTS}
+                        COMMENT "Embedding resources into ${TARGET_NAME}" )
+
+    target_sources( ${TARGET_NAME} PRIVATE ${GENERATED_SOURCE} )
+    target_compile_definitions( ${TARGET_NAME} PRIVATE TERMINUS_EMBEDDED_RESOURCES=1 )
+
+endfunction()
@@ -27,7 +27,7 @@ class ConanProject(ConanFile):
     description = "Embedded Calculator / Converter App"
     topics = ("terminus","convert")
 
-    options = { "driver":     ['raylib','allegro','pico'],
+    options = { "driver":     ['raylib','allegro','fbdev','pico'],
                 "with_tests": [True, False] }
 
     default_options = { 'driver': 'raylib',
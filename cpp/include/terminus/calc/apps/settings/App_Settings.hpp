@@ -36,7 +36,12 @@ class App_Settings : public gui::App_Base
         /**
          * Get the menu icon to show on the main-menu
          */
-        img::Frame::ptr_t menu_icon() override;
+        gui::Label::ptr_t menu_icon() override;
+
+        /**
+         * Get the name to show on the main-menu
+         */
+        std::string menu_name() const override;
 
         /**
          * Create an instance 
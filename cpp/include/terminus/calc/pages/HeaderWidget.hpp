@@ -37,8 +37,7 @@ class Header_Widget : public gui::WidgetLayout
          * Create the widget
          */
         static Header_Widget::ptr_t create( const core::Options& config,
-                                            gui::Session&        session,
-                                            math::Size2i         parent_size );
+                                            gui::Session&        session );
 
     private:
 
@@ -14,12 +14,29 @@
  */
 #pragma once
 
+// C++ Standard Libraries
+#include <vector>
+
 // Project Libraries
-#include <terminus/gui/layout/LayoutVertical.hpp>
+#include <terminus/driver/Input_Event.hpp>
+#include <terminus/gui/app/App_Base.hpp>
+#include <terminus/gui/layout/LayoutGrid.hpp>
 #include <terminus/gui/widget/WidgetLayout.hpp>
+#include <terminus/image/Frame.hpp>
 
 namespace tmns::calc::page {
 
+/**
+ * @class Main_Menu
+ *
+ * Launcher grid with one tile per app.  Tiles are only built for the rows on screen and are
+ * rebound as the focus scrolls.  Arrow keys move the focus, and Enter or Space launches.
+ *
+ * Configuration (`[menu]` section):
+ *  - `cell_width`, `cell_height`: Tile size.  Default 128 x 128.
+ *  - `cell_spacing`:              Gap between tiles.  Default 8.
+ *  - `icon_size`:                 Largest icon to load.  Default 96.
+ */
 class Main_Menu : public gui::WidgetLayout {
 
     public:
@@ -32,12 +49,24 @@ class Main_Menu : public gui::WidgetLayout {
          */
         void set_layout_size( math::Size2i layout_size );
 
+        /**
+         * Move the focus or launch the focused app
+         *
+         * @returns True if the event was used.
+         */
+        bool handle_input( const drv::Input_Event& event );
+
+        /**
+         * Get the launcher grid
+         */
+        gui::LayoutGrid::ptr_t grid() const;
+
         /**
          * Construct Main Menu
          */
-        static Main_Menu::ptr_t create( core::Options& config,
-                                        gui::Session&  session,
-                                        math::Size2i   parent_size );
+        static Main_Menu::ptr_t create( core::Options&                    config,
+                                        gui::Session&                     session,
+                                        std::vector<gui::App_Base::ptr_t> apps );
     
     private:
 
@@ -46,11 +75,20 @@ class Main_Menu : public gui::WidgetLayout {
         /**
          * Parameterized Constructor
          */
-        Main_Menu( gui::LayoutVertical::ptr_t main_layout );
-        
-        /// List of Application Labels
-        
+        Main_Menu( gui::LayoutGrid::ptr_t main_layout );
+
+        /// Launcher grid
+        gui::LayoutGrid::ptr_t m_grid;
+
+        /// Apps shown in the grid
+        std::vector<gui::App_Base::ptr_t> m_apps;
+
+        /// Icon of each app, loaded once in the background
+        std::vector<gui::Label::ptr_t> m_icons;
+
+        /// Caption of each app, rasterized once
+        std::vector<img::Frame::ptr_t> m_captions;
 
 }; // End of Main_Menu class
 
-} // End of tmns::calc::page namespace
\ No newline at end of file
+} // End of tmns::calc::page namespace
@@ -0,0 +1,49 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Byte_Order.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Helpers for reading and writing little-endian file fields.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <concepts>
+#include <cstdint>
+
+namespace tmns::core {
+
+/**
+ * Read an unsigned little-endian value from a byte buffer
+ */
+template <std::unsigned_integral ValueT>
+constexpr ValueT read_le( const uint8_t* data )
+{
+    ValueT value = 0;
+    for( size_t i = 0; i < sizeof(ValueT); i++ ){
+        value = static_cast<ValueT>( value | ( static_cast<ValueT>( data[i] ) << ( 8 * i ) ) );
+    }
+    return value;
+}
+
+/**
+ * Write an unsigned little-endian value into a byte buffer
+ */
+template <std::unsigned_integral ValueT>
+constexpr void write_le( uint8_t* data, ValueT value )
+{
+    for( size_t i = 0; i < sizeof(ValueT); i++ ){
+        data[i] = static_cast<uint8_t>( ( value >> ( 8 * i ) ) & 0xff );
+    }
+}
+
+} // End of tmns::core namespace
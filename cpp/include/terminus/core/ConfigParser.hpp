@@ -16,6 +16,7 @@
 
 // C++ Standard Libraries
 #include <filesystem>
+#include <istream>
 #include <map>
 #include <string>
 
@@ -32,6 +33,16 @@ class ConfigParser {
          */
         static SETTINGS_TYPE parse( const std::filesystem::path& path );
 
+        /**
+         * Parse configuration text from a stream
+         */
+        static SETTINGS_TYPE parse( std::istream& input );
+
+        /**
+         * Write settings back out in the configuration file format
+         */
+        static std::string to_string( const SETTINGS_TYPE& settings );
+
     private:
 
 
@@ -0,0 +1,37 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Embedded_Resources.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Resources compiled directly into the application binary.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <span>
+
+namespace tmns::core {
+
+/**
+ * Get the resource bundle linked into the binary.
+ *
+ * The bundle is a `constexpr` byte array generated at build time by the
+ * `terminus_embed_resources()` CMake function (see `cmake/TerminusEmbedResources.cmake`),
+ * so on the Pico it stays in flash and is read through XIP instead of being copied into RAM.
+ * Wrap it with `Resource_Bundle::from_buffer()` and no owner, as it lives for the whole program.
+ *
+ * @note Only defined when the target was built with `TERMINUS_EMBEDDED_RESOURCES`.
+ */
+std::span<const uint8_t> embedded_bundle();
+
+} // End of tmns::core namespace
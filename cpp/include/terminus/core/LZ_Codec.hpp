@@ -0,0 +1,55 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    LZ_Codec.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Fast byte-oriented LZ77 compression.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace tmns::core {
+
+/**
+ * @brief Compress a buffer, appending the result to `output`.
+ *
+ * The stream is a series of sequences in the style of LZ4:
+ *
+ * | Field    | Size     | Contents                                                    |
+ * |----------|----------|-------------------------------------------------------------|
+ * | Token    | 1        | High nibble: literal count, low nibble: match length - 4    |
+ * | Literals | 0+n      | Extra literal count bytes if the nibble is 15, then bytes   |
+ * | Offset   | 2        | Little-endian distance back to the match                    |
+ * | Match    | 0+n      | Extra match length bytes if the nibble is 15                |
+ *
+ * Extra length bytes are added together and end at the first byte below 255.  The last
+ * sequence holds only literals.  Matches are found with a single hash probe, so the
+ * compressor trades ratio for speed, which suits frame deltas that are mostly zeros.
+ */
+void lz_compress( std::span<const uint8_t> input,
+                  std::vector<uint8_t>&    output );
+
+/**
+ * @brief Decompress a buffer written by `lz_compress`.
+ *
+ * @param output Destination, must be exactly the uncompressed size
+ *
+ * @throws std::runtime_error if the stream is corrupt or does not fill `output`.
+ */
+void lz_decompress( std::span<const uint8_t> input,
+                    std::span<uint8_t>       output );
+
+} // End of tmns::core namespace
@@ -0,0 +1,94 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Memory_Map.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Read-only memory-mapped file.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace tmns::core {
+
+/**
+ * RAII wrapper around a read-only memory-mapped file.
+ *
+ * Pages are only faulted in when touched, and the kernel page cache
+ * shares them across processes and restarts.  Hand out the pointer type
+ * to anything holding a span into the mapping so it stays alive.
+ */
+class Memory_Map {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<Memory_Map>;
+
+        /**
+         * Destructor.  Unmaps the file.
+         */
+        ~Memory_Map();
+
+        /**
+         * Get the mapped bytes
+         */
+        std::span<const uint8_t> data() const;
+
+        /**
+         * Get the number of mapped bytes
+         */
+        inline size_t size() const { return m_size; }
+
+        /**
+         * Get the path of the mapped file
+         */
+        inline const std::filesystem::path& path() const { return m_path; }
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Map the entire file into memory.
+         *
+         * @throws std::runtime_error if the file cannot be opened or mapped.
+         */
+        static Memory_Map::ptr_t open( const std::filesystem::path& path );
+
+    private:
+
+        /// @brief Use the open() method
+        Memory_Map() = default;
+
+        /// @brief This class must be non-copyable
+        Memory_Map( const Memory_Map& ) = delete;
+        Memory_Map& operator = ( const Memory_Map& ) = delete;
+
+        /// Path to the mapped file
+        std::filesystem::path m_path;
+
+        /// Start of the mapping
+        void* m_data { nullptr };
+
+        /// Size of the mapping in bytes
+        size_t m_size { 0 };
+
+}; // End of Memory_Map class
+
+} // End of tmns::core namespace
@@ -147,6 +147,13 @@ class Options final {
             }
         }
         
+        /**
+         * Get every configuration setting, including command-line overrides
+         */
+        inline const std::map<std::string,std::map<std::string,std::string>>& settings() const {
+            return m_settings;
+        }
+
         /**
          * Get the log severity
          */
@@ -0,0 +1,160 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Resource_Bundle.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Single-file, indexed archive of application resources.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tmns::core {
+
+/**
+ * @brief Read-only archive of named blobs with a hashed index.
+ *
+ * Layout (all fields little-endian):
+ *
+ * | Section | Contents                                                                    |
+ * |---------|-----------------------------------------------------------------------------|
+ * | Header  | "TBDL", u16 version, u16 reserved, u32 count, u32 offsets (fan-out, index,  |
+ * |         | names), u32 names size, u32 reserved.  32 bytes total.                      |
+ * | Fan-out | 256 x u32.  Entry `b` is the number of entries whose hash top byte is <= b. |
+ * | Index   | count x { u64 hash, u32 name offset, u32 name size, u32 data offset,        |
+ * |         | u32 data size }, sorted by hash.                                            |
+ * | Names   | Concatenated entry names, used to reject hash collisions.                   |
+ * | Data    | Blobs, each starting on a 16-byte boundary.                                 |
+ *
+ * A lookup hashes the name, uses the top byte to jump into the fan-out table, and
+ * scans the handful of entries sharing that bucket.  The bundle is usually memory-mapped,
+ * so opening it costs one `open`/`mmap` no matter how many resources it holds.
+ */
+class Resource_Bundle {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<Resource_Bundle>;
+
+        /// File identifier
+        static constexpr std::array<char,4> MAGIC { 'T', 'B', 'D', 'L' };
+
+        /// Current file version
+        static constexpr uint16_t VERSION { 1 };
+
+        /// Alignment of each blob within the bundle
+        static constexpr size_t DATA_ALIGNMENT { 16 };
+
+        /**
+         * Find the blob stored under the given name
+         *
+         * @returns Empty optional if the bundle has no such entry.
+         */
+        std::optional<std::span<const uint8_t>> find( std::string_view name ) const;
+
+        /**
+         * Check if the bundle contains an entry
+         */
+        inline bool contains( std::string_view name ) const { return find( name ).has_value(); }
+
+        /**
+         * Number of entries in the bundle
+         */
+        inline size_t size() const { return m_count; }
+
+        /**
+         * Names of all entries, in index order
+         */
+        std::vector<std::string_view> names() const;
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Hash function used by the index (64-bit FNV-1a)
+         */
+        static uint64_t hash( std::string_view name );
+
+        /**
+         * Memory-map a bundle from disk.
+         *
+         * @throws std::runtime_error if the file cannot be mapped or is malformed, or if this
+         *         build cannot memory-map files.  Such builds use from_buffer() on the
+         *         embedded bundle instead.
+         */
+        static Resource_Bundle::ptr_t open( const std::filesystem::path& pathname );
+
+        /**
+         * Wrap a bundle which already lives in memory.
+         *
+         * @param buffer Bundle bytes.  Must outlive the bundle, or be kept alive by `owner`.
+         * @param owner  Optional keep-alive for the buffer.
+         *
+         * @throws std::runtime_error if the buffer is malformed.
+         */
+        static Resource_Bundle::ptr_t from_buffer( std::span<const uint8_t>    buffer,
+                                                   std::shared_ptr<const void> owner );
+
+        /**
+         * Serialize a set of named blobs into a bundle
+         */
+        static std::vector<uint8_t> pack( const std::map<std::string,std::vector<uint8_t>>& entries );
+
+    private:
+
+        /// @brief Use the open() or from_buffer() methods
+        Resource_Bundle() = default;
+
+        /// @brief This class must be non-copyable
+        Resource_Bundle( const Resource_Bundle& ) = delete;
+        Resource_Bundle& operator = ( const Resource_Bundle& ) = delete;
+
+        /**
+         * Parse and validate the header, fan-out, and index
+         */
+        void parse();
+
+        /**
+         * Get the name of the entry at the given index position
+         */
+        std::string_view entry_name( size_t index ) const;
+
+        /// Raw bundle bytes
+        std::span<const uint8_t> m_buffer;
+
+        /// Keeps the buffer alive
+        std::shared_ptr<const void> m_owner;
+
+        /// Number of entries
+        size_t m_count { 0 };
+
+        /// Offsets of each section
+        size_t m_fanout_offset { 0 };
+        size_t m_index_offset { 0 };
+        size_t m_names_offset { 0 };
+
+}; // End of Resource_Bundle class
+
+} // End of tmns::core namespace
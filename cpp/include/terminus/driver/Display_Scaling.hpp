@@ -0,0 +1,66 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Display_Scaling.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Placement of the rendered frame inside a larger window.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <string>
+
+// Project Libraries
+#include <terminus/math/Rectangle.hpp>
+#include <terminus/math/Size.hpp>
+
+namespace tmns::drv {
+
+/**
+ * How a frame is scaled up to fill the window
+ */
+enum class Scale_Mode : uint8_t
+{
+    INTEGER = 0, ///< Largest whole multiple that fits, nearest-neighbor, letterboxed
+    FIT     = 1, ///< Largest size that fits with the same aspect ratio, filtered, letterboxed
+    STRETCH = 2, ///< Fill the window, ignoring the aspect ratio
+}; // End of Scale_Mode Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( Scale_Mode mode );
+
+/**
+ * Parse a mode name ("integer", "fit" or "stretch")
+ *
+ * @throws std::runtime_error if the name is not recognized.
+ */
+Scale_Mode scale_mode_from_string( const std::string& name );
+
+/**
+ * Find where a frame is drawn in the window
+ *
+ * The result is in window pixels, with the origin at the top-left, and centered.  In
+ * integer mode a window smaller than the frame falls back to fitting, since there is no
+ * whole multiple below one.
+ *
+ * @param frame  Size the application renders at
+ * @param window Current window size
+ * @param mode   How to scale
+ */
+math::Rect2i present_viewport( const math::Size2i& frame,
+                               const math::Size2i& window,
+                               Scale_Mode          mode );
+
+} // End of tmns::drv namespace
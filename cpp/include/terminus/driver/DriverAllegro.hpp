@@ -12,29 +12,42 @@
  * @author  Marvin Smith
  * @date    03/21/2025
  *
- * @details Vertical Layout API
+ * @details Allegro Graphics API Wrapper
  */
 #pragma once
 
+// C++ Standard Libraries
+#include <chrono>
+#include <vector>
+
 // Allegro APIs
 #include <allegro5/allegro5.h>
 #include <allegro5/allegro_font.h>
 
-// OpenCV APIs
-
-
 // Project Libraries
-#include <terminus/app/calc/core/Options.hpp>
-#include <terminus/app/calc/drivers/DriverBase.hpp>
+#include <terminus/core/Options.hpp>
+#include <terminus/driver/DriverBase.hpp>
 
-namespace tmns::calc::drv {
+namespace tmns::drv {
 
+/**
+ * @class Driver_Allegro
+ *
+ * Allegro 5 backend.  Lighter than raylib, and needs no OpenGL on the software renderer.
+ *
+ * Input, mouse and display events arrive on one event queue.  Between frames the driver
+ * blocks on that queue until the next frame is due, so an idle application sleeps in the
+ * kernel instead of polling.
+ *
+ * Frames are copied into a screen-sized bitmap through a locked region covering only the
+ * rows that changed, then drawn to the back buffer and flipped.
+ */
 class Driver_Allegro : public Driver_Base {
 
     public:
 
         /// Pointer Type
-        using ptr_t = std::shared_ptr<Driver_Allegro>;
+        using ptr_t = std::unique_ptr<Driver_Allegro>;
 
         /**
          * Initialize Library
@@ -44,7 +57,33 @@ class Driver_Allegro : public Driver_Base {
         /**
          * Close / Finalize
          */
-        void finalize() override;
+        int finalize() override;
+
+        /**
+         * Handle queued events, and check if the window was closed
+         */
+        bool okay_to_run() override;
+
+        /**
+         * Check if any events are waiting, or any key or mouse button is held
+         */
+        bool input_pending() override;
+
+        /**
+         * Block on the event queue until an event arrives or the deadline passes
+         */
+        bool wait_for_input( std::chrono::steady_clock::time_point until,
+                             std::chrono::steady_clock::duration   poll_interval ) override;
+
+        /**
+         * Display the current image.
+         */
+        void show( img::Frame& frame ) override;
+
+        /**
+         * RGBA frames with partial updates.  Vsync and the bitmap size limit come from the display.
+         */
+        Driver_Capabilities capabilities() const override;
 
         /**
          * Get screen dimensions
@@ -56,11 +95,16 @@ class Driver_Allegro : public Driver_Base {
          */
         img::Frame::ptr_t load_image( const std::filesystem::path& path ) override;
 
+        /**
+         * Generate Image from Text
+         */
+        img::Frame::ptr_t rasterize_text( const std::string& message ) override;
+
         /**
          * Print log-friendly string
          */
         std::string to_log_string( size_t offset = 0 ) const override;
-        
+
         /**
          * Create a new instance of the driver.
          */
@@ -72,14 +116,28 @@ class Driver_Allegro : public Driver_Base {
 
     private:
 
-        ALLEGRO_TIMER* m_timer { nullptr };
-
         ALLEGRO_EVENT_QUEUE* m_queue { nullptr };
 
         ALLEGRO_DISPLAY* m_display { nullptr };
 
         ALLEGRO_FONT* m_font { nullptr };
 
+        /// Screen-sized bitmap the frames are copied into
+        ALLEGRO_BITMAP* m_screen { nullptr };
+
+        /// Current Window Size
+        size_t m_window_cols { 0 };
+        size_t m_window_rows { 0 };
+
+        /// Copy of the last frame shown, used to find changed rows
+        std::vector<uint8_t> m_previous;
+
+        /// Keys and mouse buttons currently held
+        size_t m_inputs_down { 0 };
+
+        /// Cleared once the window is closed
+        bool m_okay_to_run { true };
+
 }; // End of Driver_Allegro class
 
-} // End of tmns::calc::drv namespace
+} // End of tmns::drv namespace
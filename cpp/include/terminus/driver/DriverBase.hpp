@@ -14,8 +14,18 @@
  */
 #pragma once
 
+// C++ Standard Libraries
+#include <chrono>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
 // Project Libraries
 #include <terminus/core/Options.hpp>
+#include <terminus/driver/Driver_Capabilities.hpp>
+#include <terminus/driver/Image_Loader.hpp>
+#include <terminus/driver/Input_Event.hpp>
 #include <terminus/image/Frame.hpp>
 
 namespace tmns::drv {
@@ -27,6 +37,21 @@ class Driver_Base {
         /// Pointer Type
         using ptr_t = std::unique_ptr<Driver_Base>;
 
+        /// Threads used by load_image_async()
+        static constexpr size_t IMAGE_LOADER_THREADS { 2 };
+
+        /// Width and height of the glyph cell used for headless text
+        static constexpr size_t HEADLESS_GLYPH_COLS { 8 };
+        static constexpr size_t HEADLESS_GLYPH_ROWS { 16 };
+
+        /// Size of the placeholder for images that cannot be loaded headless
+        static constexpr size_t HEADLESS_IMAGE_SIZE { 64 };
+
+        /**
+         * Destructor
+         */
+        virtual ~Driver_Base();
+
         /**
          * Initialize the driver
          */
@@ -43,11 +68,41 @@ class Driver_Base {
          */
         virtual bool okay_to_run() = 0;
 
+        /**
+         * Check if the user is interacting, without consuming any input.
+         * Used to raise the frame rate while they are.
+         */
+        virtual bool input_pending() = 0;
+
+        /**
+         * Wait until the deadline, returning true as soon as the user does something.
+         *
+         * The default polls input_pending() at the given interval.  Drivers with an event
+         * queue should block on it instead.
+         */
+        virtual bool wait_for_input( std::chrono::steady_clock::time_point until,
+                                     std::chrono::steady_clock::duration   poll_interval );
+
+        /**
+         * Take the key events seen since the last call.  Called once per frame, after
+         * okay_to_run().
+         */
+        virtual std::vector<Input_Event> take_input_events();
+
         /**
          * Display the current image.
          */
         virtual void show( img::Frame& frame ) = 0;
 
+        /**
+         * Describe what the display can do.  The session sizes its frames and picks how to
+         * present them from this.
+         *
+         * The default is an RGBA display with no partial updates or vsync, which must be
+         * shown from the thread that initialized it.
+         */
+        virtual Driver_Capabilities capabilities() const;
+
         /**
          * Get default screen dimensions
          */
@@ -58,6 +113,22 @@ class Driver_Base {
          */
         virtual img::Frame::ptr_t load_image( const std::filesystem::path& path ) = 0;
 
+        /**
+         * Load image from disk on a background thread.
+         *
+         * The default runs load_image() on a pool started by the first request, so drivers
+         * must keep load_image() safe to call from any thread.  Requests for a path already
+         * being loaded share its result.  Builds without threads load on the calling thread
+         * and return a finished result.
+         */
+        virtual Image_Loader::Result load_image_async( const std::filesystem::path& path );
+
+        /**
+         * Stop the background loader.  Call before finalize(), since loads in progress
+         * still use the driver.
+         */
+        void stop_image_loader();
+
         /**
          * Rasterize Text
          */
@@ -68,6 +139,49 @@ class Driver_Base {
          */
         virtual std::string to_log_string( size_t offset = 0 ) const = 0;
 
+    protected:
+
+        /**
+         * Queue a key event for take_input_events()
+         */
+        void push_input_event( Input_Action action,
+                               Key          key );
+
+        /**
+         * Find the band of rows that differ from the previous frame, then remember this one.
+         *
+         * @param pixels   Frame being shown, rows packed
+         * @param previous Last frame shown.  Everything is changed when its size differs.
+         * @returns First changed row and one past the last.  Equal when nothing changed.
+         */
+        static std::pair<size_t,size_t> changed_rows( std::span<const uint8_t> pixels,
+                                                      std::vector<uint8_t>&    previous,
+                                                      size_t                   row_bytes );
+
+        /**
+         * Load an image without a display.  `.tfrm` files load normally, anything else
+         * becomes a blank placeholder.
+         */
+        static img::Frame::ptr_t headless_image( const std::filesystem::path& path );
+
+        /**
+         * Rasterize text without a display, as a blank frame about the size real text would be
+         */
+        static img::Frame::ptr_t headless_text( const std::string& message );
+
+    private:
+
+        /// Key events not yet taken
+        std::vector<Input_Event> m_input_events;
+
+#if TERMINUS_POSIX
+        /// Guards creation of the loader
+        std::mutex m_image_loader_mutex;
+
+        /// Background loader, started on first use
+        Image_Loader::ptr_t m_image_loader;
+#endif
+
 }; // End of Driver_Base class
 
 
@@ -0,0 +1,188 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverFBDev.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Linux Framebuffer Driver
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+// Project Libraries
+#include <terminus/core/Options.hpp>
+#include <terminus/driver/DriverBase.hpp>
+#include <terminus/image/Primitives.hpp>
+
+namespace tmns::drv {
+
+/**
+ * @class Driver_FBDev
+ *
+ * Draws straight into a memory-mapped Linux framebuffer (`/dev/fb0`), with no window system
+ * or graphics library involved.
+ *
+ * The size, stride and pixel format come from the device.  Each call to show() compares the
+ * frame against the previous one and only converts the rows that changed, so an idle screen
+ * costs a row comparison and nothing else.
+ *
+ * A regular file can stand in for the device.  Its size comes from `[display] screen_width`
+ * and `screen_height`, and its format from `[fbdev] format`, and it is grown to fit.
+ *
+ * Configuration (`[fbdev]` section):
+ *  - `device`:       Framebuffer to draw into.  Default `/dev/fb0`.
+ *  - `format`:       Pixel format when `device` is a regular file.  Default `BGRA`.
+ *  - `input_device`: Optional evdev node (`/dev/input/eventN`) used to detect activity.
+ */
+class Driver_FBDev : public Driver_Base {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Driver_FBDev>;
+
+        /// Framebuffer used when none is configured
+        static constexpr const char* DEFAULT_DEVICE { "/dev/fb0" };
+
+        /**
+         * Destructor.  Unmaps the framebuffer.
+         */
+        ~Driver_FBDev() override;
+
+        /**
+         * Map the framebuffer and open the input device
+         */
+        bool initialize( core::Options& config ) override;
+
+        /**
+         * Close / Finalize
+         */
+        int finalize() override;
+
+        /**
+         * Check if the process has been asked to stop (SIGINT or SIGTERM)
+         */
+        bool okay_to_run() override;
+
+        /**
+         * Check for input events or held keys on the input device
+         */
+        bool input_pending() override;
+
+        /**
+         * Read the input device, then take the key events seen since the last call
+         */
+        std::vector<Input_Event> take_input_events() override;
+
+        /**
+         * Copy the changed rows of the frame into the framebuffer
+         */
+        void show( img::Frame& frame ) override;
+
+        /**
+         * The framebuffer's own format, with partial updates and threaded presentation
+         */
+        Driver_Capabilities capabilities() const override;
+
+        /**
+         * Get screen dimensions
+         */
+        img::Dimensions get_screen_dimensions() const override;
+
+        /**
+         * Load image from disk.
+         */
+        img::Frame::ptr_t load_image( const std::filesystem::path& path ) override;
+
+        /**
+         * Generate Image from Text
+         */
+        img::Frame::ptr_t rasterize_text( const std::string& message ) override;
+
+        /**
+         * Pixel format of the framebuffer
+         */
+        inline img::PixelFormat pixel_format() const { return m_format; }
+
+        /**
+         * Bytes between the start of consecutive framebuffer rows
+         */
+        inline size_t stride() const { return m_stride; }
+
+        /**
+         * Number of rows the last show() wrote
+         */
+        inline size_t rows_written() const { return m_rows_written; }
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Create a new instance of the driver.
+         */
+        static Driver_FBDev::ptr_t create( core::Options& config );
+
+    private:
+
+        /**
+         * Open and map the framebuffer, or the file standing in for it
+         */
+        void open_device( core::Options& config );
+
+        /**
+         * Release the mapping and any open devices
+         */
+        void close_devices();
+
+        /// Path to the framebuffer
+        std::filesystem::path m_device_path;
+
+        /// Framebuffer descriptor
+        int m_fd { -1 };
+
+        /// Mapped framebuffer memory
+        uint8_t* m_mapping { nullptr };
+
+        /// Size of the mapping in bytes
+        size_t m_map_bytes { 0 };
+
+        /// Visible framebuffer size
+        size_t m_cols { 0 };
+        size_t m_rows { 0 };
+
+        /// Bytes per framebuffer row
+        size_t m_stride { 0 };
+
+        /// Framebuffer pixel format
+        img::PixelFormat m_format { img::PixelFormat::BGRA };
+
+        /// Copy of the last frame shown, used to find changed rows
+        std::vector<uint8_t> m_previous;
+
+        /// Rows written by the last show()
+        size_t m_rows_written { 0 };
+
+        /// Optional evdev descriptor
+        int m_input_fd { -1 };
+
+        /// Keys currently held on the input device
+        size_t m_keys_down { 0 };
+
+}; // End of Driver_FBDev class
+
+} // End of tmns::drv namespace
@@ -16,6 +16,9 @@
  */
 #pragma once
 
+// C++ Standard Libraries
+#include <vector>
+
 // Raylib APIs
 //    Helpful Cheatsheet:  https://www.raylib.com/cheatsheet/cheatsheet.html
 #include <raylib.h>
@@ -26,9 +29,23 @@
 // Project Libraries
 #include <terminus/core/Options.hpp>
 #include <terminus/driver/DriverBase.hpp>
+#include <terminus/driver/Display_Scaling.hpp>
 
 namespace tmns::drv {
 
+/**
+ * @class Driver_Raylib
+ *
+ * Desktop driver.  Frames are rendered at `[display] screen_width` x `screen_height` and
+ * scaled by the GPU to fill the window, so a handheld can be emulated at its own resolution
+ * in a window of any size, and rendering cost does not grow with the window.
+ *
+ * Configuration (`[display]` section):
+ *  - `window_width`, `window_height`: Initial window size.  Default the render size.
+ *  - `scale_mode`: `integer` (default), `fit` or `stretch`.  See Scale_Mode.
+ *  - `resizable`:  Allow the window to be resized.  Default false.
+ *  - `vsync`:      Swap buffers on the vertical blank.  Default false.
+ */
 class Driver_Raylib : public Driver_Base {
 
     public:
@@ -51,13 +68,28 @@ class Driver_Raylib : public Driver_Base {
          */
         bool okay_to_run() override;
 
+        /**
+         * Check if any key or mouse button is held
+         */
+        bool input_pending() override;
+
+        /**
+         * Take the key presses and releases seen since the last call
+         */
+        std::vector<Input_Event> take_input_events() override;
+
         /**
          * Display the current image.
          */
         void show( img::Frame& frame ) override;
 
         /**
-         * Get screen dimensions
+         * RGBA frames with partial texture updates, and vsync if it was requested
+         */
+        Driver_Capabilities capabilities() const override;
+
+        /**
+         * Get the render resolution, which is independent of the window size
          */
         img::Dimensions get_screen_dimensions() const override;
 
@@ -87,10 +119,29 @@ class Driver_Raylib : public Driver_Base {
 
     private:
 
-        /// Current Window Size
+        /// Render Resolution
+        size_t m_render_cols { 0 };
+        size_t m_render_rows { 0 };
+
+        /// Initial Window Size
         size_t m_window_cols { 0 };
         size_t m_window_rows { 0 };
 
+        /// How frames are scaled into the window
+        Scale_Mode m_scale_mode { Scale_Mode::INTEGER };
+
+        /// Texture the frames are uploaded into
+        Texture2D m_texture {};
+
+        /// Copy of the last frame shown, used to find changed rows
+        std::vector<uint8_t> m_previous;
+
+        /// Raylib key codes seen going down and not yet released
+        std::vector<int> m_keys_held;
+
+        /// Swap buffers on the vertical blank
+        bool m_vsync { false };
+
 
 }; // End of Driver_Raylib class
 
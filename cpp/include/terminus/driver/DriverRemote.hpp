@@ -0,0 +1,255 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverRemote.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Serves the screen to remote viewers and takes their key input.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/core/Options.hpp>
+#include <terminus/driver/DriverBase.hpp>
+#include <terminus/driver/Remote_Protocol.hpp>
+#include <terminus/image/Delta_Encoder.hpp>
+
+namespace tmns::drv {
+
+/**
+ * @class Driver_Remote
+ *
+ * Lets a unit be viewed and driven from another machine, over a Unix or TCP socket.
+ *
+ * Every frame shown goes through a `img::Delta_Encoder`, so viewers get a keyframe when they
+ * connect and afterwards only the changed span of each changed row, compressed.  An idle
+ * screen sends nothing.  Viewers send key events back, which are delivered alongside the
+ * wrapped driver's own.
+ *
+ * Sockets never block the application.  A viewer that falls more than `max_pending_kb`
+ * behind has its backlog dropped and every viewer is resynced with a keyframe.
+ *
+ * The server wraps the display driver and forwards everything to it, so the unit's own screen
+ * keeps working.  Without a display driver it runs headless.
+ *
+ * Configuration (`[remote]` section):
+ *  - `enabled`:           Serve the screen.  Default false.
+ *  - `listen`:            `unix:<path>` or `tcp:<host>:<port>`.  Default `unix:/tmp/terminus.sock`.
+ *  - `max_clients`:       Viewers allowed at once.  Default 4.
+ *  - `max_pending_kb`:    Backlog per viewer before it is resynced.  Default 4096.
+ *  - `keyframe_interval`: Frames between keyframes.  Default 0, only when needed.
+ *  - `headless`:          Run without opening the display.  Default false.
+ */
+class Driver_Remote : public Driver_Base {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Driver_Remote>;
+
+        /// Address used when none is configured
+        static constexpr const char* DEFAULT_LISTEN { "unix:/tmp/terminus.sock" };
+
+        /**
+         * Limits on the viewers
+         */
+        struct Limits {
+
+            /// Viewers allowed at once
+            size_t max_clients { 4 };
+
+            /// Backlog per viewer before it is resynced
+            size_t max_pending_bytes { 4 * 1024 * 1024 };
+
+            /// Frames between keyframes, 0 for only when needed
+            size_t keyframe_interval { 0 };
+
+        }; // End of Limits struct
+
+        /**
+         * Usage counters
+         */
+        struct Stats {
+
+            /// Viewers accepted
+            size_t clients_accepted { 0 };
+
+            /// Viewers turned away at the limit
+            size_t clients_refused { 0 };
+
+            /// Frame messages queued, counted once per viewer
+            size_t frames_sent { 0 };
+
+            /// Bytes queued for viewers
+            size_t bytes_sent { 0 };
+
+            /// Backlogs dropped to resync a slow viewer
+            size_t resyncs { 0 };
+
+            /// Key events received
+            size_t input_events { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor.  Starts listening.
+         *
+         * @param display  Driver to forward to, or null to run headless
+         * @param dims     Screen size when headless
+         * @param endpoint Address to listen on
+         * @param limits   Limits on the viewers
+         * @throws std::runtime_error if the socket cannot be opened.
+         */
+        Driver_Remote( Driver_Base::ptr_t     display,
+                       img::Dimensions        dims,
+                       const Remote_Endpoint& endpoint,
+                       Limits                 limits );
+
+        /**
+         * Destructor.  Closes every socket.
+         */
+        ~Driver_Remote() override;
+
+        /**
+         * Nothing to do.  The wrapped driver is initialized by its own create().
+         */
+        bool initialize( core::Options& config ) override;
+
+        /**
+         * Close every socket and finalize the wrapped driver
+         */
+        int finalize() override;
+
+        /**
+         * Accept viewers, read their input, and check the wrapped driver for exit conditions
+         */
+        bool okay_to_run() override;
+
+        /**
+         * Check for viewer input or interaction with the wrapped driver
+         */
+        bool input_pending() override;
+
+        /**
+         * Take the key events from viewers and from the wrapped driver
+         */
+        std::vector<Input_Event> take_input_events() override;
+
+        /**
+         * Wait for input from viewers or the wrapped driver
+         */
+        bool wait_for_input( std::chrono::steady_clock::time_point until,
+                             std::chrono::steady_clock::duration   poll_interval ) override;
+
+        /**
+         * Forward the frame, then send the changes to every viewer
+         */
+        void show( img::Frame& frame ) override;
+
+        /**
+         * The wrapped driver's capabilities.  Sockets are serviced from the render thread,
+         * so presentation stays on it.
+         */
+        Driver_Capabilities capabilities() const override;
+
+        /**
+         * Get screen dimensions
+         */
+        img::Dimensions get_screen_dimensions() const override;
+
+        /**
+         * Load image through the wrapped driver, or without a display when headless
+         */
+        img::Frame::ptr_t load_image( const std::filesystem::path& path ) override;
+
+        /**
+         * Rasterize text through the wrapped driver, or without a display when headless
+         */
+        img::Frame::ptr_t rasterize_text( const std::string& message ) override;
+
+        /**
+         * Viewers currently connected
+         */
+        inline size_t client_count() const { return m_clients.size(); }
+
+        /**
+         * Usage counters
+         */
+        inline const Stats& stats() const { return m_stats; }
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Wrap a driver with the server, using the `[remote]` settings
+         */
+        static Driver_Remote::ptr_t create( core::Options&     config,
+                                            Driver_Base::ptr_t display );
+
+    private:
+
+        /**
+         * Accept new viewers, read their messages and send their backlog
+         *
+         * @returns True if any key events arrived
+         */
+        bool service();
+
+        /**
+         * Close the listening socket and every viewer
+         */
+        void close_sockets();
+
+        /// Driver to forward to
+        Driver_Base::ptr_t m_display;
+
+        /// Screen size when headless
+        img::Dimensions m_dims;
+
+        /// Address listened on
+        Remote_Endpoint m_endpoint;
+
+        /// Limits on the viewers
+        Limits m_limits;
+
+        /// Listening socket
+        int m_listen_fd { -1 };
+
+        /// Connected viewers
+        std::vector<Remote_Connection::ptr_t> m_clients;
+
+        /// Encodes the changes between frames, shared by every viewer
+        img::Delta_Encoder m_encoder;
+
+        /// Packet being sent
+        std::vector<uint8_t> m_packet;
+
+        /// Message being read
+        std::vector<uint8_t> m_payload;
+
+        /// Viewer input is waiting to be taken
+        bool m_input_waiting { false };
+
+        /// Usage counters
+        Stats m_stats;
+
+}; // End of Driver_Remote class
+
+} // End of tmns::drv namespace
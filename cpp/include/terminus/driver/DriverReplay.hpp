@@ -0,0 +1,274 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverReplay.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Records key input, or replays it, and times every frame.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/core/Options.hpp>
+#include <terminus/driver/DriverBase.hpp>
+#include <terminus/driver/Input_Recording.hpp>
+
+namespace tmns::drv {
+
+/**
+ * Whether input is being captured or played back
+ */
+enum class Replay_Mode : uint8_t
+{
+    RECORD = 0, ///< Forward the user's input and write it to the recording
+    REPLAY = 1, ///< Ignore the user and play the recording back
+}; // End of Replay_Mode Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( Replay_Mode mode );
+
+/**
+ * Frame-time summary of a run
+ */
+struct Frame_Time_Report {
+
+    /// Frames timed
+    size_t frames { 0 };
+
+    /// Average frame time
+    std::chrono::microseconds mean { 0 };
+
+    /// Percentiles
+    std::chrono::microseconds p50 { 0 };
+    std::chrono::microseconds p95 { 0 };
+    std::chrono::microseconds p99 { 0 };
+
+    /// Slowest frame
+    std::chrono::microseconds max { 0 };
+
+    /**
+     * Print information to log-friendly string
+     */
+    std::string to_log_string( size_t offset = 0 ) const;
+
+    /**
+     * Summarize a list of frame times
+     */
+    static Frame_Time_Report from_times( const std::vector<std::chrono::microseconds>& times );
+
+}; // End of Frame_Time_Report struct
+
+/**
+ * @class Driver_Replay
+ *
+ * Makes a session repeatable, so the same interaction can be timed before and after a change.
+ *
+ * When recording, everything is forwarded to the wrapped driver and each key event is written
+ * with the number of the frame that took it.  When replaying, the user is ignored and each
+ * event is delivered on the same frame it was recorded on, so the application goes through the
+ * same states no matter how fast the machine is.  The run ends after the recorded number of
+ * frames, and frames are not paced, so a replay runs as fast as it can draw.
+ *
+ * In both modes, each frame is timed from okay_to_run() to the end of show().  finalize()
+ * logs the summary, writes a per-frame CSV if asked, and fails the run if the 95th percentile
+ * is over budget.
+ *
+ * Without a display driver the replay runs headless.  The screen size comes from `[display]`,
+ * `.tfrm` images load normally, other images become placeholders and text renders blank.
+ *
+ * Configuration (`[input]` section):
+ *  - `record_path`:     Record input to this file.  Also set by `--record-input`.
+ *  - `replay_path`:     Replay input from this file.  Also set by `--replay-input`.
+ *  - `replay_headless`: Replay without opening the display.  Default true.
+ *  - `replay_report`:   Write per-frame times to this CSV file.
+ *  - `frame_budget_us`: Make finalize() fail if the 95th percentile frame time is higher.
+ */
+class Driver_Replay : public Driver_Base {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Driver_Replay>;
+
+        /**
+         * Record input
+         *
+         * @param display Driver to forward to, or null to run headless
+         * @param dims    Screen size when headless
+         * @param writer  Recording to write
+         */
+        Driver_Replay( Driver_Base::ptr_t            display,
+                       img::Dimensions               dims,
+                       Input_Recording_Writer::ptr_t writer );
+
+        /**
+         * Replay input
+         *
+         * @param display Driver to draw into, or null to run headless
+         * @param dims    Screen size when headless
+         * @param reader  Recording to play
+         */
+        Driver_Replay( Driver_Base::ptr_t            display,
+                       img::Dimensions               dims,
+                       Input_Recording_Reader::ptr_t reader );
+
+        /**
+         * Read the report settings.  The wrapped driver is initialized by its own create().
+         */
+        bool initialize( core::Options& config ) override;
+
+        /**
+         * Close the recording, report frame times and finalize the wrapped driver
+         *
+         * @returns Non-zero if the wrapped driver failed or the frame budget was exceeded
+         */
+        int finalize() override;
+
+        /**
+         * Start the next frame.  When replaying, returns false once the recorded frames are done.
+         */
+        bool okay_to_run() override;
+
+        /**
+         * Check for input on this frame
+         */
+        bool input_pending() override;
+
+        /**
+         * Take the key events for this frame, recording them or reading them from the recording
+         */
+        std::vector<Input_Event> take_input_events() override;
+
+        /**
+         * Wait on the wrapped driver.  When replaying, returns true at once so frames are not paced.
+         */
+        bool wait_for_input( std::chrono::steady_clock::time_point until,
+                             std::chrono::steady_clock::duration   poll_interval ) override;
+
+        /**
+         * Forward the frame and finish timing it
+         */
+        void show( img::Frame& frame ) override;
+
+        /**
+         * The wrapped driver's capabilities, without threaded presentation so show() can be timed
+         */
+        Driver_Capabilities capabilities() const override;
+
+        /**
+         * Get screen dimensions
+         */
+        img::Dimensions get_screen_dimensions() const override;
+
+        /**
+         * Load image through the wrapped driver, or from a `.tfrm` file when headless
+         */
+        img::Frame::ptr_t load_image( const std::filesystem::path& path ) override;
+
+        /**
+         * Rasterize text through the wrapped driver, or as a blank frame when headless
+         */
+        img::Frame::ptr_t rasterize_text( const std::string& message ) override;
+
+        /**
+         * Record or replay
+         */
+        inline Replay_Mode mode() const { return m_mode; }
+
+        /**
+         * Frames started so far
+         */
+        inline uint32_t frame() const { return m_frame; }
+
+        /**
+         * Time of every frame shown so far
+         */
+        inline const std::vector<std::chrono::microseconds>& frame_times() const { return m_frame_times; }
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Wrap a driver to record or replay, depending on the `[input]` settings
+         *
+         * @param display Driver to forward to, or null to replay headless
+         * @throws std::runtime_error if neither or both of recording and replay are configured.
+         */
+        static Driver_Replay::ptr_t create( core::Options&     config,
+                                            Driver_Base::ptr_t display );
+
+    private:
+
+        /**
+         * Log the settings which differ from the ones the recording was made with
+         */
+        void check_config( const core::Options& config ) const;
+
+        /**
+         * Write every frame time to a CSV file
+         */
+        void write_report( const std::filesystem::path& pathname ) const;
+
+        /// Driver to forward to
+        Driver_Base::ptr_t m_display;
+
+        /// Screen size when headless
+        img::Dimensions m_dims;
+
+        /// Record or replay
+        Replay_Mode m_mode;
+
+        /// Recording being written
+        Input_Recording_Writer::ptr_t m_writer;
+
+        /// Recording being played
+        Input_Recording_Reader::ptr_t m_reader;
+
+        /// Next recorded event to deliver
+        size_t m_next_event { 0 };
+
+        /// Last frame of the recording
+        uint32_t m_last_frame { 0 };
+
+        /// Current frame, counting from 1
+        uint32_t m_frame { 0 };
+
+        /// Start of the recording
+        std::chrono::steady_clock::time_point m_start;
+
+        /// Start of the current frame
+        std::chrono::steady_clock::time_point m_frame_start;
+
+        /// Time of every frame shown
+        std::vector<std::chrono::microseconds> m_frame_times;
+
+        /// Optional per-frame CSV
+        std::optional<std::filesystem::path> m_report_path;
+
+        /// Optional limit on the 95th percentile
+        std::optional<std::chrono::microseconds> m_frame_budget;
+
+}; // End of Driver_Replay class
+
+} // End of tmns::drv namespace
@@ -0,0 +1,317 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverSPISim.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Simulates pushing frames to an SPI display panel.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/core/Options.hpp>
+#include <terminus/driver/DriverBase.hpp>
+#include <terminus/image/Primitives.hpp>
+
+namespace tmns::drv {
+
+/**
+ * How much of the frame is sent to the panel on each show()
+ */
+enum class SPI_Update_Mode : uint8_t
+{
+    FULL  = 0, ///< The whole frame, every time
+    ROWS  = 1, ///< Full-width bands of changed rows
+    RECTS = 2, ///< Bands of changed rows, trimmed to the changed columns
+}; // End of SPI_Update_Mode Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( SPI_Update_Mode mode );
+
+/**
+ * Parse a mode name ("full", "rows" or "rects")
+ *
+ * @throws std::runtime_error if the name is not recognized.
+ */
+SPI_Update_Mode spi_update_mode_from_string( const std::string& name );
+
+/**
+ * Bus and panel parameters used by the simulator
+ */
+struct SPI_Bus_Config {
+
+    /// SPI clock.  The RP2040 tops out at half its 125 MHz system clock.
+    size_t clock_hz { 62'500'000 };
+
+    /// Fixed cost of every command: chip select, data/command line and driver call
+    std::chrono::nanoseconds command_overhead { 1'000 };
+
+    /// Largest single DMA transfer
+    size_t dma_chunk_bytes { 4096 };
+
+    /// Cost of setting up each DMA transfer
+    std::chrono::nanoseconds dma_setup { 2'000 };
+
+    /// Pixel format on the wire.  RGB565 (2 bytes) or RGB (3 bytes, as RGB666 panels expect).
+    img::PixelFormat wire_format { img::PixelFormat::RGB565 };
+
+    /// How much of each frame is sent
+    SPI_Update_Mode update_mode { SPI_Update_Mode::RECTS };
+
+    /// Sleep for the simulated transfer time in show(), so the app runs at the panel's pace
+    bool realtime { false };
+
+    /**
+     * Print information to log-friendly string
+     */
+    std::string to_log_string( size_t offset = 0 ) const;
+
+    /**
+     * Read the `[spi_sim]` settings.  Missing settings use the defaults above.
+     */
+    static SPI_Bus_Config from_config( core::Options& config );
+
+}; // End of SPI_Bus_Config struct
+
+/**
+ * @class Driver_SPI_Sim
+ *
+ * Estimates what each frame would cost to send to an SPI panel such as the PicoCalc's.
+ *
+ * A panel update is a window-set (column and row address commands), a memory-write command,
+ * then the pixels in the wire format, split into DMA chunks.  Time is the bytes on the wire at
+ * the bus clock, plus a fixed overhead per command and per DMA chunk.  Depending on the update
+ * mode, show() sends the whole frame or only the changed row bands, and reports the result as
+ * a `Transfer`.
+ *
+ * The simulator wraps the desktop driver.  Everything except the timing is forwarded, so the
+ * application still draws in its window.  Without a display driver it runs headless.
+ *
+ * `panel()` holds what the panel would show, after the round trip through the wire format,
+ * so the effect of partial updates and reduced color depth can be checked directly.
+ */
+class Driver_SPI_Sim : public Driver_Base {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Driver_SPI_Sim>;
+
+        /**
+         * Region of the panel written by one window-set
+         */
+        struct Rect {
+
+            size_t col  { 0 };
+            size_t row  { 0 };
+            size_t cols { 0 };
+            size_t rows { 0 };
+
+        }; // End of Rect struct
+
+        /**
+         * Cost of one show()
+         */
+        struct Transfer {
+
+            /// Windows written
+            size_t rects { 0 };
+
+            /// Commands sent, including the memory write of each window
+            size_t commands { 0 };
+
+            /// Pixel bytes sent
+            size_t pixel_bytes { 0 };
+
+            /// DMA transfers used for the pixels
+            size_t dma_chunks { 0 };
+
+            /// Simulated time on the bus
+            std::chrono::nanoseconds duration { 0 };
+
+        }; // End of Transfer struct
+
+        /**
+         * Totals over every show()
+         */
+        struct Stats {
+
+            /// Calls to show()
+            size_t shows { 0 };
+
+            /// Sum of every transfer
+            Transfer total;
+
+            /// Slowest single transfer
+            std::chrono::nanoseconds worst { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         *
+         * @param display Driver to forward to, or null to run headless
+         * @param dims    Panel size
+         * @param bus     Bus and panel parameters
+         */
+        Driver_SPI_Sim( Driver_Base::ptr_t display,
+                        img::Dimensions    dims,
+                        SPI_Bus_Config     bus );
+
+        /**
+         * Clear the panel.  The wrapped driver is initialized by its own create().
+         */
+        bool initialize( core::Options& config ) override;
+
+        /**
+         * Log the totals and finalize the wrapped driver
+         */
+        int finalize() override;
+
+        /**
+         * Check the wrapped driver for exit conditions
+         */
+        bool okay_to_run() override;
+
+        /**
+         * Check the wrapped driver for user interaction
+         */
+        bool input_pending() override;
+
+        /**
+         * Take the key events seen by the wrapped driver
+         */
+        std::vector<Input_Event> take_input_events() override;
+
+        /**
+         * Wait on the wrapped driver for user interaction
+         */
+        bool wait_for_input( std::chrono::steady_clock::time_point until,
+                             std::chrono::steady_clock::duration   poll_interval ) override;
+
+        /**
+         * Simulate sending the frame to the panel, then forward it
+         */
+        void show( img::Frame& frame ) override;
+
+        /**
+         * The panel's wire format and update granularity.  Threaded presentation is allowed
+         * if the wrapped driver allows it.
+         */
+        Driver_Capabilities capabilities() const override;
+
+        /**
+         * Get the panel size
+         */
+        img::Dimensions get_screen_dimensions() const override;
+
+        /**
+         * Load image from disk through the wrapped driver
+         *
+         * @throws std::runtime_error when running headless.
+         */
+        img::Frame::ptr_t load_image( const std::filesystem::path& path ) override;
+
+        /**
+         * Rasterize text through the wrapped driver
+         *
+         * @throws std::runtime_error when running headless.
+         */
+        img::Frame::ptr_t rasterize_text( const std::string& message ) override;
+
+        /**
+         * Cost of a set of windows, without sending anything
+         */
+        Transfer estimate( const std::vector<Rect>& rects ) const;
+
+        /**
+         * Cost of the last show()
+         */
+        inline const Transfer& last_transfer() const { return m_last_transfer; }
+
+        /**
+         * Windows written by the last show()
+         */
+        inline const std::vector<Rect>& last_rects() const { return m_rects; }
+
+        /**
+         * Totals over every show()
+         */
+        inline const Stats& stats() const { return m_stats; }
+
+        /**
+         * What the panel currently shows, in RGBA
+         */
+        inline const img::Frame& panel() const { return m_panel; }
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Wrap a driver with the simulator, using the `[spi_sim]` settings
+         */
+        static Driver_SPI_Sim::ptr_t create( core::Options&     config,
+                                             Driver_Base::ptr_t display );
+
+    private:
+
+        /**
+         * Find the windows to send for a frame
+         */
+        void find_damage( const img::Frame& frame );
+
+        /**
+         * Copy a window through the wire format into the panel
+         */
+        void write_panel( const img::Frame& frame,
+                          const Rect&       rect );
+
+        /// Driver to forward to
+        Driver_Base::ptr_t m_display;
+
+        /// Panel size
+        img::Dimensions m_dims;
+
+        /// Bus and panel parameters
+        SPI_Bus_Config m_bus;
+
+        /// Last frame sent, used to find changes
+        std::vector<uint8_t> m_previous;
+
+        /// What the panel shows
+        img::Frame m_panel;
+
+        /// Windows written by the last show()
+        std::vector<Rect> m_rects;
+
+        /// Pixels of one row in the wire format
+        std::vector<uint8_t> m_wire_row;
+
+        /// Cost of the last show()
+        Transfer m_last_transfer;
+
+        /// Totals over every show()
+        Stats m_stats;
+
+}; // End of Driver_SPI_Sim class
+
+} // End of tmns::drv namespace
@@ -0,0 +1,70 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Driver_Capabilities.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details What a display driver can do, so the session can set itself up to match.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Primitives.hpp>
+#include <terminus/math/Size.hpp>
+
+namespace tmns::drv {
+
+/**
+ * Capabilities reported by a display driver
+ */
+struct Driver_Capabilities {
+
+    /// Formats the display takes without conversion.  Sessions always composite in RGBA, and
+    /// drivers convert the rows they upload to one of these.
+    std::vector<img::PixelFormat> native_formats { img::PixelFormat::RGBA };
+
+    /// show() only uploads the rows that changed
+    bool partial_updates { false };
+
+    /// Byte alignment the driver prefers for the start of each row
+    size_t row_alignment { 1 };
+
+    /// show() waits for the vertical blank
+    bool vsync { false };
+
+    /// Largest frame the driver can show.  Zero means no known limit.
+    math::Size2i max_texture_size { { 0, 0 } };
+
+    /// show() may be called from a thread other than the one that initialized the driver
+    bool threaded_show { false };
+
+    /**
+     * Check if frames in this format reach the display without conversion
+     */
+    bool is_native( img::PixelFormat format ) const;
+
+    /**
+     * Check if a frame of this size can be shown
+     */
+    bool fits( const math::Size2i& size ) const;
+
+    /**
+     * Print log-friendly string
+     */
+    std::string to_log_string( size_t offset = 0 ) const;
+
+}; // End of Driver_Capabilities struct
+
+} // End of tmns::drv namespace
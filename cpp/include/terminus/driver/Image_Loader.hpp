@@ -0,0 +1,167 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Image_Loader.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Loads images on a pool of background threads.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+
+namespace tmns::drv {
+
+/**
+ * @class Image_Loader
+ *
+ * Runs a load function on a small pool of threads so that disk I/O and decoding never block
+ * the UI thread.
+ *
+ * Requests for a path that is already queued or loading share the same result rather than
+ * loading the file twice.  Finished images are not kept, so caching is left to the caller.
+ * Failures are reported through the future, as the exception the load function threw.
+ */
+class Image_Loader {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Image_Loader>;
+
+        /// Loads one image.  Called on a loader thread.
+        using Load_Func = std::function<img::Frame::ptr_t( const std::filesystem::path& )>;
+
+        /// Result of a request.  Any number of widgets may wait on the same one.
+        using Result = std::shared_future<img::Frame::ptr_t>;
+
+        /**
+         * Counters
+         */
+        struct Stats {
+
+            /// Calls to load()
+            size_t requested { 0 };
+
+            /// Requests that joined one already in flight
+            size_t deduplicated { 0 };
+
+            /// Images loaded successfully
+            size_t loaded { 0 };
+
+            /// Loads that threw, or were cancelled by stop()
+            size_t failed { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor.  Starts the threads.
+         *
+         * @param load    Function which loads a single image
+         * @param threads Number of loader threads, at least one
+         */
+        Image_Loader( Load_Func load,
+                      size_t    threads );
+
+        /**
+         * Destructor.  Stops the threads.
+         */
+        ~Image_Loader();
+
+        /// @brief This class must be non-copyable
+        Image_Loader( const Image_Loader& ) = delete;
+        Image_Loader& operator = ( const Image_Loader& ) = delete;
+
+        /**
+         * Queue an image to load, or join the request already in flight for the same path
+         */
+        Result load( const std::filesystem::path& path );
+
+        /**
+         * Finish the loads in progress, fail the ones still queued, and join the threads.
+         * Later requests fail immediately.
+         */
+        void stop();
+
+        /**
+         * Number of paths queued or loading
+         */
+        size_t in_flight() const;
+
+        /**
+         * Get the counters
+         */
+        Stats stats() const;
+
+        /**
+         * Print log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+    private:
+
+        /**
+         * A queued request
+         */
+        struct Job {
+
+            std::filesystem::path path;
+
+            std::promise<img::Frame::ptr_t> promise;
+
+        }; // End of Job struct
+
+        /**
+         * Thread body
+         */
+        void worker();
+
+        /// Function which loads a single image
+        Load_Func m_load;
+
+        /// Guards everything below
+        mutable std::mutex m_mutex;
+
+        /// Signalled when a job is queued or the loader stops
+        std::condition_variable m_job_ready;
+
+        /// Requests not yet started
+        std::deque<Job> m_queue;
+
+        /// Results of everything queued or loading, by path
+        std::map<std::filesystem::path,Result> m_in_flight;
+
+        /// Set once stop() is called
+        bool m_stopping { false };
+
+        /// Counters
+        Stats m_stats;
+
+        /// Loader threads
+        std::vector<std::thread> m_threads;
+
+}; // End of Image_Loader class
+
+} // End of tmns::drv namespace
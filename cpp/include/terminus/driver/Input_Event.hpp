@@ -0,0 +1,89 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Input_Event.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Keyboard input, independent of the driver it came from.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace tmns::drv {
+
+/**
+ * Physical keys.  Printable keys use their (upper case) ASCII code, so `Key('A')` is the A key.
+ */
+enum class Key : uint16_t
+{
+    NONE      = 0,
+    SPACE     = ' ',
+    COMMA     = ',',
+    MINUS     = '-',
+    PERIOD    = '.',
+    SLASH     = '/',
+    EQUAL     = '=',
+    UP        = 0x100,
+    DOWN      = 0x101,
+    LEFT      = 0x102,
+    RIGHT     = 0x103,
+    ENTER     = 0x104,
+    ESCAPE    = 0x105,
+    BACKSPACE = 0x106,
+    TAB       = 0x107,
+    HOME      = 0x108,
+    END       = 0x109,
+    PAGE_UP   = 0x10A,
+    PAGE_DOWN = 0x10B,
+    DELETE    = 0x10C,
+}; // End of Key Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( Key key );
+
+/**
+ * What happened to the key
+ */
+enum class Input_Action : uint8_t
+{
+    PRESS   = 1,
+    RELEASE = 2,
+    REPEAT  = 3, ///< Held long enough for the keyboard to repeat it
+}; // End of Input_Action Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( Input_Action action );
+
+/**
+ * A single key event
+ */
+struct Input_Event {
+
+    /// When the driver saw the event
+    std::chrono::steady_clock::time_point time;
+
+    /// What happened
+    Input_Action action { Input_Action::PRESS };
+
+    /// Which key
+    Key key { Key::NONE };
+
+}; // End of Input_Event struct
+
+} // End of tmns::drv namespace
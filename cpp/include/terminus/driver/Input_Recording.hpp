@@ -0,0 +1,195 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Input_Recording.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Files of recorded key events, for replaying a session.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/driver/Input_Event.hpp>
+
+namespace tmns::drv {
+
+/**
+ * @brief Layout of a `.tinp` input recording.
+ *
+ * A 12-byte header ("TINP", u16 version, u16 reserved, u32 config size), the text of the
+ * configuration file the session ran with, then 16-byte records of
+ * `u32 frame, u64 timestamp (us), u8 action, u8 reserved, u16 key`, all little-endian.
+ *
+ * Events are tied to the frame that took them, which is what makes replay deterministic.
+ * A final record with action 0 holds the number of frames the session ran.  Without it (a
+ * crash or power loss) the recording still replays up to its last event.
+ */
+struct Input_Recording
+{
+    /// File identifier
+    static constexpr std::array<char,4> MAGIC { 'T', 'I', 'N', 'P' };
+
+    /// Current file version
+    static constexpr uint16_t VERSION { 1 };
+
+    /// Size of the file header in bytes, before the configuration text
+    static constexpr size_t HEADER_BYTES { 12 };
+
+    /// Size of each record in bytes
+    static constexpr size_t RECORD_BYTES { 16 };
+
+    /// Action code of the closing record
+    static constexpr uint8_t END_ACTION { 0 };
+
+}; // End of Input_Recording struct
+
+/**
+ * A recorded key event
+ */
+struct Input_Record {
+
+    /// Frame which took the event, counting from 1
+    uint32_t frame { 0 };
+
+    /// Time since the recording started
+    std::chrono::microseconds timestamp { 0 };
+
+    /// What happened
+    Input_Action action { Input_Action::PRESS };
+
+    /// Which key
+    Key key { Key::NONE };
+
+}; // End of Input_Record struct
+
+/**
+ * @class Input_Recording_Writer
+ *
+ * Appends key events to a recording.  Every record is flushed, since input is rare and
+ * the end of a session is exactly what a crash report needs.
+ */
+class Input_Recording_Writer {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Input_Recording_Writer>;
+
+        /**
+         * Add an event to the recording
+         */
+        void write( const Input_Record& record );
+
+        /**
+         * Close the recording with the number of frames the session ran
+         */
+        void finish( uint32_t frames );
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Create a new recording, replacing any file at the path
+         *
+         * @param config_text Configuration the session runs with
+         * @throws std::runtime_error if the file cannot be opened.
+         */
+        static ptr_t create( const std::filesystem::path& pathname,
+                             const std::string&           config_text );
+
+    private:
+
+        /**
+         * Constructor
+         */
+        Input_Recording_Writer( const std::filesystem::path& pathname,
+                                const std::string&           config_text );
+
+        /**
+         * Write a single record
+         */
+        void write_record( uint32_t                  frame,
+                           std::chrono::microseconds timestamp,
+                           uint8_t                   action,
+                           uint16_t                  key );
+
+        /// Output path
+        std::filesystem::path m_pathname;
+
+        /// Output stream
+        std::ofstream m_fout;
+
+        /// Events written
+        size_t m_events { 0 };
+
+}; // End of Input_Recording_Writer class
+
+/**
+ * @class Input_Recording_Reader
+ *
+ * Reads a whole input recording.  They are small, so everything is loaded at once.
+ */
+class Input_Recording_Reader {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Input_Recording_Reader>;
+
+        /**
+         * Get the configuration the session ran with
+         */
+        inline const std::string& config_text() const { return m_config_text; }
+
+        /**
+         * Get the events, in order
+         */
+        inline const std::vector<Input_Record>& records() const { return m_records; }
+
+        /**
+         * Get the number of frames the session ran, if the recording was closed
+         */
+        inline std::optional<uint32_t> frame_count() const { return m_frame_count; }
+
+        /**
+         * Open a recording
+         *
+         * @throws std::runtime_error if the file is missing, not an input recording, or corrupt.
+         */
+        static ptr_t open( const std::filesystem::path& pathname );
+
+    private:
+
+        /// Configuration the session ran with
+        std::string m_config_text;
+
+        /// Events, in order
+        std::vector<Input_Record> m_records;
+
+        /// Frames the session ran
+        std::optional<uint32_t> m_frame_count;
+
+}; // End of Input_Recording_Reader class
+
+} // End of tmns::drv namespace
@@ -22,6 +22,9 @@
 // C++ Standard Libraries
 #include <string>
 
+// Project Libraries
+#include <terminus/image/Primitives.hpp>
+
 namespace tmns::drv {
 
 /**
@@ -29,6 +32,11 @@ namespace tmns::drv {
  */
 size_t raylib_format_to_channels( PixelFormat fmt );
 
+/**
+ * Convert an uncompressed 8-bit Raylib PixelFormat into the matching image pixel format
+ */
+img::PixelFormat raylib_format_to_pixel_format( PixelFormat fmt );
+
 /**
  * Convert a Raylib PixelFormat to a string
  */
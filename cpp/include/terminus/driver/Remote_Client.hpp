@@ -0,0 +1,129 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Remote_Client.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Viewer side of the remote display protocol.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/driver/Input_Event.hpp>
+#include <terminus/driver/Remote_Protocol.hpp>
+#include <terminus/image/Delta_Encoder.hpp>
+
+namespace tmns::drv {
+
+/**
+ * @class Remote_Client
+ *
+ * Connects to a `Driver_Remote`, rebuilds its screen and sends key events to it.
+ *
+ * If a packet cannot be decoded, the client asks for a keyframe and ignores deltas until
+ * one arrives.
+ */
+class Remote_Client {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Remote_Client>;
+
+        /**
+         * Wait for messages and apply them
+         *
+         * @param timeout Longest time to wait for something to arrive
+         * @returns False once the server has closed the connection
+         * @throws std::runtime_error if the server speaks a different protocol.
+         */
+        bool poll( std::chrono::milliseconds timeout );
+
+        /**
+         * Send a key event
+         */
+        void send_key( Input_Action action,
+                       Key          key );
+
+        /**
+         * Check if a full screen has arrived
+         */
+        bool has_frame() const;
+
+        /**
+         * Get the screen as last received
+         */
+        const img::Frame& frame() const;
+
+        /**
+         * Frames applied so far
+         */
+        inline size_t frames_received() const { return m_frames; }
+
+        /**
+         * Bytes of frame data received so far
+         */
+        inline size_t bytes_received() const { return m_bytes; }
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Connect to a server
+         *
+         * @throws std::runtime_error if the server cannot be reached.
+         */
+        static ptr_t connect( const Remote_Endpoint& endpoint );
+
+    private:
+
+        /**
+         * Constructor
+         */
+        Remote_Client( Remote_Connection::ptr_t connection );
+
+        /**
+         * Apply one message
+         */
+        void handle( Remote_Message type );
+
+        /// Connection to the server
+        Remote_Connection::ptr_t m_connection;
+
+        /// Rebuilds the screen
+        img::Delta_Decoder m_decoder;
+
+        /// Message being read
+        std::vector<uint8_t> m_payload;
+
+        /// Set once the server has said hello
+        bool m_greeted { false };
+
+        /// Set while waiting for a keyframe to recover
+        bool m_resyncing { false };
+
+        /// Frames applied
+        size_t m_frames { 0 };
+
+        /// Bytes of frame data received
+        size_t m_bytes { 0 };
+
+}; // End of Remote_Client class
+
+} // End of tmns::drv namespace
@@ -0,0 +1,253 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Remote_Protocol.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Messages and sockets shared by the remote display server and its viewers.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace tmns::drv {
+
+/**
+ * Kind of message on a remote display connection.
+ *
+ * Values are sent over the wire, so never renumber existing entries.
+ */
+enum class Remote_Message : uint8_t
+{
+    HELLO    = 0, ///< Server to viewer on connect: magic and protocol version
+    FRAME    = 1, ///< Server to viewer: a `img::Delta_Encoder` packet
+    INPUT    = 2, ///< Viewer to server: `u8 action, u16 key`
+    KEYFRAME = 3, ///< Viewer to server: ask for a full frame, after losing sync
+}; // End of Remote_Message Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( Remote_Message message );
+
+/**
+ * @brief Layout of the remote display protocol.
+ *
+ * Every message is `u8 type, u32 payload size`, then the payload, all little-endian.  The
+ * server greets each viewer with HELLO, then sends a keyframe and, after that, only the rows
+ * that changed, compressed.  Unchanged frames send nothing.
+ */
+struct Remote_Protocol
+{
+    /// Identifier at the start of HELLO
+    static constexpr std::array<char,4> MAGIC { 'T', 'R', 'M', 'T' };
+
+    /// Current protocol version
+    static constexpr uint16_t VERSION { 1 };
+
+    /// Bytes before each payload
+    static constexpr size_t HEADER_BYTES { 5 };
+
+    /// Size of a HELLO payload
+    static constexpr size_t HELLO_BYTES { 6 };
+
+    /// Size of an INPUT payload
+    static constexpr size_t INPUT_BYTES { 3 };
+
+    /// Largest payload accepted.  Bigger means a corrupt or hostile stream.
+    static constexpr size_t MAX_PAYLOAD_BYTES { 64 * 1024 * 1024 };
+
+    /// Largest payload a viewer sends.  Viewers only send INPUT and empty KEYFRAME messages.
+    static constexpr size_t MAX_VIEWER_PAYLOAD_BYTES { INPUT_BYTES };
+
+}; // End of Remote_Protocol struct
+
+/**
+ * Address of a remote display socket
+ */
+struct Remote_Endpoint {
+
+    /// Socket family
+    enum class Kind : uint8_t { UNIX, TCP };
+
+    /// Socket family
+    Kind kind { Kind::UNIX };
+
+    /// Socket path for Unix sockets, or host name for TCP
+    std::string address;
+
+    /// TCP port
+    uint16_t port { 0 };
+
+    /**
+     * Print as `unix:<path>` or `tcp:<host>:<port>`
+     */
+    std::string to_string() const;
+
+    /**
+     * Parse `unix:<path>` or `tcp:<host>:<port>`
+     *
+     * @throws std::runtime_error if the address is malformed.
+     */
+    static Remote_Endpoint parse( const std::string& text );
+
+}; // End of Remote_Endpoint struct
+
+/**
+ * @class Remote_Connection
+ *
+ * One non-blocking socket, with messages queued in both directions.
+ *
+ * Writes never block: messages are queued and flush() sends what the socket will take.  A
+ * viewer on a slow link therefore holds up nobody but itself.  Reads collect bytes until
+ * whole messages are available.
+ */
+class Remote_Connection {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Remote_Connection>;
+
+        /**
+         * Take ownership of a connected socket, and make it non-blocking
+         *
+         * @param fd                Connected socket
+         * @param max_payload_bytes Largest payload the peer may send.  This also bounds how
+         *                          much is buffered, so servers pass a small limit.
+         */
+        explicit Remote_Connection( int    fd,
+                                    size_t max_payload_bytes = Remote_Protocol::MAX_PAYLOAD_BYTES );
+
+        /**
+         * Destructor.  Closes the socket.
+         */
+        ~Remote_Connection();
+
+        /// This will be noncopyable
+        Remote_Connection( const Remote_Connection& ) = delete;
+        Remote_Connection& operator=( const Remote_Connection& ) = delete;
+
+        /**
+         * Queue a message.  Nothing is sent until flush().
+         */
+        void send( Remote_Message           type,
+                   std::span<const uint8_t> payload );
+
+        /**
+         * Send as much of the queue as the socket takes
+         *
+         * @returns False if the connection failed
+         */
+        bool flush();
+
+        /**
+         * Read whatever has arrived, until the largest message the peer may send is buffered.
+         *
+         * Reading stops once that much is buffered, and what is left on the socket is read
+         * by a later call after messages have been taken.  Messages taken since the last call
+         * are dropped from the buffer in one move.
+         *
+         * @returns False if the peer closed the connection or it failed
+         */
+        bool receive();
+
+        /**
+         * Take the next complete message
+         *
+         * @returns False if no complete message has arrived
+         * @throws std::runtime_error if the stream is corrupt, or a header announces more than
+         *         the peer may send.  This is found before the body is buffered.
+         */
+        bool next_message( Remote_Message&       type,
+                           std::vector<uint8_t>& payload );
+
+        /**
+         * Drop queued messages that have not started sending
+         *
+         * @returns Bytes dropped
+         */
+        size_t drop_queued();
+
+        /**
+         * Bytes queued and not yet sent
+         */
+        inline size_t pending_bytes() const { return m_pending_bytes; }
+
+        /**
+         * Socket descriptor, for polling
+         */
+        inline int fd() const { return m_fd; }
+
+        /**
+         * Open a listening socket
+         *
+         * Unix socket paths left over from an earlier run are replaced.
+         *
+         * @returns Non-blocking listening descriptor
+         * @throws std::runtime_error if the socket cannot be bound.
+         */
+        static int listen( const Remote_Endpoint& endpoint );
+
+        /**
+         * Accept a waiting connection
+         *
+         * @param listen_fd         Listening socket
+         * @param max_payload_bytes Largest payload the peer may send
+         *
+         * @returns The connection, or null if none is waiting
+         */
+        static ptr_t accept( int    listen_fd,
+                             size_t max_payload_bytes );
+
+        /**
+         * Connect to a server
+         *
+         * @throws std::runtime_error if the server cannot be reached.
+         */
+        static ptr_t connect( const Remote_Endpoint& endpoint );
+
+    private:
+
+        /// Socket descriptor
+        int m_fd { -1 };
+
+        /// Messages waiting to be sent, the first possibly in part
+        std::deque<std::vector<uint8_t>> m_outbound;
+
+        /// Bytes of the first message already sent
+        size_t m_front_sent { 0 };
+
+        /// Bytes waiting to be sent
+        size_t m_pending_bytes { 0 };
+
+        /// Bytes received.  Those before the read offset were already taken as messages.
+        std::vector<uint8_t> m_inbound;
+
+        /// Start of the first message not yet taken
+        size_t m_read_offset { 0 };
+
+        /// Largest payload the peer may send
+        size_t m_max_payload_bytes;
+
+        /// Most bytes buffered before reading stops
+        size_t m_max_inbound_bytes;
+
+}; // End of Remote_Connection class
+
+} // End of tmns::drv namespace
@@ -20,11 +20,13 @@
 #include <terminus/core/Options.hpp>
 #include <terminus/gui/core/Session.hpp>
 #include <terminus/gui/layout/LayoutStack.hpp>
+#include <terminus/gui/widget/Label.hpp>
 #include <terminus/gui/widget/WidgetLayout.hpp>
 #include <terminus/image/Frame.hpp>
 
 /// C++ Standard Libraries
 #include <memory>
+#include <string>
 
 namespace tmns::gui {
 
@@ -36,9 +38,14 @@ class App_Base : public WidgetLayout
         using ptr_t = std::shared_ptr<App_Base>;
 
         /**
-         * Get the menu icon to show on the main-menu
+         * Get the menu icon to show on the main-menu.  It may still be loading.
          */
-        virtual img::Frame::ptr_t menu_icon() = 0;
+        virtual gui::Label::ptr_t menu_icon() = 0;
+
+        /**
+         * Get the name to show under the icon on the main-menu
+         */
+        virtual std::string menu_name() const = 0;
 
     protected:
 
@@ -64,6 +71,14 @@ class App_Base : public WidgetLayout
          */
         gui::Session& session();
 
+        /**
+         * Find the largest image in `images/<name>/` which fits the `[menu] icon_size` setting,
+         * and start loading it.  The label is an `icon_size` square until the image arrives.
+         *
+         * @returns null if no image fits.
+         */
+        gui::Label::ptr_t find_menu_icon( const std::string& name );
+
     private:
 
         /// Configuration Information
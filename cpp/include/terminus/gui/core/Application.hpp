@@ -16,6 +16,7 @@
 
 // Project Libraries
 #include <terminus/core/Options.hpp>
+#include <terminus/gui/core/Frame_Pacer.hpp>
 #include <terminus/gui/core/Session.hpp>
 #include <terminus/gui/I_Main_Window.hpp>
 
@@ -29,7 +30,7 @@ class Application
         using ptr_t = std::shared_ptr<Application>;
 
         /**
-         * Run the application
+         * Run the application.  Frames are paced by the `[display]` frame-rate settings.
          * 
          * @return Exit code.
          */
@@ -63,6 +64,9 @@ class Application
         // Main Window context
         I_Main_Window::ptr_t m_main_window { nullptr };
 
+        /// @brief Decides when to draw the next frame
+        Frame_Pacer m_frame_pacer;
+
         /// Flag to keep running
         bool m_okay_to_run { true };
         
@@ -0,0 +1,172 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_Pacer.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Adaptive frame-rate control for the application loop.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <chrono>
+#include <functional>
+#include <string>
+
+// Project Libraries
+#include <terminus/core/Options.hpp>
+
+namespace tmns::gui {
+
+/**
+ * @class Frame_Pacer
+ *
+ * Decides when the application loop draws its next frame.
+ *
+ * While the user is interacting or something is animating, frames are drawn at the target
+ * rate.  Once activity stops, the rate holds for the burst period and then decays toward
+ * the idle rate, halving its distance to idle every decay period.  An idle screen therefore
+ * costs a handful of frames per second instead of a full-rate redraw.
+ *
+ * Deadlines are kept on a fixed schedule, so a slow frame does not shift every frame after
+ * it.  A frame that ends after the next deadline counts as missed, and the schedule restarts
+ * from that point instead of rushing to catch up.
+ */
+class Frame_Pacer {
+
+    public:
+
+        /// Clock used for all deadlines
+        using Clock = std::chrono::steady_clock;
+
+        /// Default rate while active
+        static constexpr double DEFAULT_TARGET_FPS { 60 };
+
+        /// Default rate once idle
+        static constexpr double DEFAULT_IDLE_FPS { 4 };
+
+        /// Default time at the target rate after the last activity
+        static constexpr std::chrono::milliseconds DEFAULT_BURST { 750 };
+
+        /// Default half-life of the decay toward idle
+        static constexpr std::chrono::milliseconds DEFAULT_DECAY { 500 };
+
+        /**
+         * Pacing counters
+         */
+        struct Stats {
+
+            /// Frames paced
+            size_t frames { 0 };
+
+            /// Frames that ended after the next deadline
+            size_t missed_deadlines { 0 };
+
+            /// Largest amount a frame ran past its deadline
+            std::chrono::microseconds worst_overrun { 0 };
+
+            /// Time from the last deadline to the end of the last frame
+            std::chrono::microseconds last_frame_time { 0 };
+
+            /// Rate the last frame was paced at
+            double current_fps { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         */
+        Frame_Pacer( double                    target_fps = DEFAULT_TARGET_FPS,
+                     double                    idle_fps   = DEFAULT_IDLE_FPS,
+                     std::chrono::milliseconds burst      = DEFAULT_BURST,
+                     std::chrono::milliseconds decay      = DEFAULT_DECAY );
+
+        /**
+         * Run at the target rate, starting now.  Call on user input or while animating.
+         */
+        void request_burst( Clock::time_point now = Clock::now() );
+
+        /**
+         * Rate to draw at, given the time since the last burst request
+         */
+        double fps( Clock::time_point now ) const;
+
+        /**
+         * Rate to draw at while busy
+         */
+        double target_fps() const;
+
+        /**
+         * Record the end of a frame and schedule the next one
+         *
+         * @returns When the next frame should start.
+         */
+        Clock::time_point end_frame( Clock::time_point now );
+
+        /**
+         * Blocks until the given time and returns true if activity ended the wait early.
+         * Waiters that cannot block on input should poll at the given interval.
+         */
+        using Waiter = std::function<bool( Clock::time_point until, Clock::duration poll_interval )>;
+
+        /**
+         * Record the end of a frame, then wait until the next one is due
+         *
+         * @param wait Waits for the next frame, normally `Driver_Base::wait_for_input`.  If it
+         *             returns true, the next frame starts immediately.  Without one, sleeps.
+         */
+        void wait_for_next_frame( const Waiter& wait = {} );
+
+        /**
+         * Get the pacing counters
+         */
+        Stats stats() const;
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Build from the `[display]` settings target_fps, idle_fps, burst_ms and decay_ms.
+         * Missing settings use the defaults.
+         */
+        static Frame_Pacer from_config( core::Options& config );
+
+    private:
+
+        /// Rate while active
+        double m_target_fps;
+
+        /// Rate once idle
+        double m_idle_fps;
+
+        /// Time at the target rate after the last activity
+        std::chrono::milliseconds m_burst;
+
+        /// Half-life of the decay toward idle
+        std::chrono::milliseconds m_decay;
+
+        /// Time of the last burst request
+        Clock::time_point m_last_activity;
+
+        /// When the current frame was due
+        Clock::time_point m_deadline;
+
+        /// Set once the first frame has ended
+        bool m_started { false };
+
+        /// Pacing counters
+        Stats m_stats;
+
+}; // End of Frame_Pacer class
+
+} // End of tmns::gui namespace
@@ -0,0 +1,233 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Presenter.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Hands finished frames to a presentation thread.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+
+namespace tmns::gui {
+
+/**
+ * What to do with a finished frame when the presentation thread is still busy
+ */
+enum class PresentPolicy : uint8_t
+{
+    DROP  = 0, ///< Replace frames that are still waiting.  Rendering never blocks.
+    QUEUE = 1, ///< Present every frame in order.  Rendering blocks while every buffer is full.
+}; // End of PresentPolicy Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( PresentPolicy policy );
+
+/**
+ * Parse a policy name ("drop" or "queue")
+ *
+ * @throws std::runtime_error if the name is not recognized.
+ */
+PresentPolicy present_policy_from_string( const std::string& name );
+
+/**
+ * @class Presenter
+ *
+ * Overlaps rendering with presentation using two or three frame buffers.
+ *
+ * The render thread draws into `back_buffer()` and calls `submit()`.  A dedicated thread
+ * passes each submitted buffer to the sink, normally `Driver_Base::show`, while the next frame
+ * is drawn into another buffer.  Buffers change hands through an atomic state per buffer, so
+ * neither thread takes a lock.  Threads only block on `std::atomic::wait` when there is
+ * nothing to present, or when a queued policy has run out of buffers.
+ *
+ * Renderers only redraw what changed, so a newly acquired back buffer starts as a copy of the
+ * last frame submitted.
+ */
+class Presenter {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Presenter>;
+
+        /// Receives each frame on the presentation thread
+        using Sink = std::function<void( img::Frame& )>;
+
+        /// Most buffers supported
+        static constexpr size_t MAX_BUFFERS { 3 };
+
+        /**
+         * Usage counters
+         */
+        struct Stats {
+
+            /// Frames passed to submit()
+            size_t submitted { 0 };
+
+            /// Frames given to the sink
+            size_t presented { 0 };
+
+            /// Frames replaced before they were presented
+            size_t dropped { 0 };
+
+            /// Times the render thread waited for a free buffer
+            size_t render_waits { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor.  Starts the presentation thread.
+         *
+         * @param sink         Called with every frame presented
+         * @param dims         Size of each buffer
+         * @param buffer_count Number of buffers, 2 or 3
+         * @param policy       What to do when the presentation thread falls behind
+         */
+        Presenter( Sink            sink,
+                   img::Dimensions dims,
+                   size_t          buffer_count,
+                   PresentPolicy   policy );
+
+        /**
+         * Destructor.  Presents anything still waiting and stops the thread.
+         */
+        ~Presenter();
+
+        /**
+         * Get the buffer to render the next frame into
+         */
+        img::Frame& back_buffer();
+
+        /**
+         * Hand the back buffer to the presentation thread and acquire the next one
+         */
+        void submit();
+
+        /**
+         * Wait until every submitted frame has been presented or dropped
+         */
+        void flush();
+
+        /**
+         * Present anything still waiting and stop the thread.  Safe to call more than once.
+         */
+        void stop();
+
+        /**
+         * Get the usage counters
+         */
+        Stats stats() const;
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+    private:
+
+        /// This will be noncopyable
+        Presenter( const Presenter& ) = delete;
+        Presenter& operator=( const Presenter& ) = delete;
+
+        /**
+         * Who currently owns a buffer
+         */
+        enum class State : uint8_t
+        {
+            FREE       = 0,
+            RENDERING  = 1,
+            READY      = 2,
+            PRESENTING = 3,
+        }; // End of State Enumeration
+
+        /**
+         * One frame buffer
+         */
+        struct Slot {
+
+            /// Current owner
+            std::atomic<State> state { State::FREE };
+
+            /// Submission number of the pixels held, 0 if never submitted
+            std::atomic<uint64_t> sequence { 0 };
+
+            /// Pixels
+            img::Frame frame;
+
+        }; // End of Slot struct
+
+        /**
+         * Take a buffer for rendering, waiting or dropping according to the policy
+         */
+        void acquire_back_buffer();
+
+        /**
+         * Presentation thread loop
+         */
+        void present_loop();
+
+        /// Receives each presented frame
+        Sink m_sink;
+
+        /// Number of buffers in use
+        size_t m_buffer_count;
+
+        /// Policy when the presentation thread falls behind
+        PresentPolicy m_policy;
+
+        /// Frame buffers
+        std::array<Slot,MAX_BUFFERS> m_slots;
+
+        /// Buffer owned by the render thread
+        size_t m_back { 0 };
+
+        /// Buffer holding the last frame submitted
+        size_t m_last_submitted { 0 };
+
+        /// Bumped on every submit and on stop.  The presentation thread waits on it.
+        std::atomic<uint64_t> m_submit_count { 0 };
+
+        /// Bumped whenever a buffer is freed.  The render thread waits on it.
+        std::atomic<uint64_t> m_release_count { 0 };
+
+        /// Set to stop the presentation thread
+        std::atomic<bool> m_stopping { false };
+
+        /// Frames given to the sink
+        std::atomic<size_t> m_presented { 0 };
+
+        /// Frames replaced before they were presented
+        std::atomic<size_t> m_dropped { 0 };
+
+        /// Render-thread counters
+        size_t m_submitted { 0 };
+        size_t m_render_waits { 0 };
+
+        /// Presentation thread
+        std::thread m_thread;
+
+}; // End of Presenter class
+
+} // End of tmns::gui namespace
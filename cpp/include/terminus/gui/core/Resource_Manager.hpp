@@ -16,10 +16,12 @@
 
 // C++ Standard Libraries
 #include <filesystem>
+#include <map>
 #include <optional>
 #include <string>
 
 // Project Libraries
+#include <terminus/core/Resource_Bundle.hpp>
 #include <terminus/driver/DriverBase.hpp>
 #include <terminus/image/Frame.hpp>
 #include <terminus/math/Size.hpp>
@@ -68,6 +70,23 @@ class Resource_Manager {
          */
         bool release_image( std::string name );
 
+        /**
+         * Load an image by its path relative to the resource root (ie `images/logo/logo_360_144.png`).
+         * 
+         * The bundle is checked first, falling back to the loose file under the resource root.
+         * Loaded images are cached until released.  RGBA images are converted to premultiplied
+         * alpha once, here, unless the asset was already stored that way.
+         */
+        std::optional<img::Frame::ptr_t> load_image( const std::string& name );
+
+        /**
+         * Load an image and return a private copy that is safe to modify (tinting, theming, ...).
+         *
+         * The copy shares the cached pixels until it is first written, so deriving a variant is free
+         * until it actually changes.
+         */
+        std::optional<img::Frame::ptr_t> derive_image( const std::string& name );
+
         /**
          * Retrieve an image with the given name.  This will search all images inside the folder
          * and only process the one with the correct characteristics.
@@ -78,11 +97,40 @@ class Resource_Manager {
         std::optional<img::Frame::ptr_t> find_image( std::string   image_name,
                                                      math::Size2i  max_size );
 
+        /**
+         * Pick the image `find_image()` would load, without loading it.  Loose PNG and `.tfrm`
+         * files are sized from their headers.  Other loose files are decoded to size them.
+         *
+         * @returns The resource name, or nothing if no image fits.
+         */
+        std::optional<std::string> find_image_name( const std::string& image_name,
+                                                    math::Size2i       max_size );
+
+        /**
+         * Load an image by name without blocking.
+         *
+         * Cached and bundled images are ready at once, since bundled pixels are mapped rather
+         * than decoded.  Loose files are decoded on the driver's loader threads.  Those results
+         * are not added to the cache, which is only touched from the UI thread.
+         *
+         * @returns The load result.  It fails with std::runtime_error if the resource is missing.
+         */
+        drv::Image_Loader::Result load_image_async( const std::string& name );
+
+        /**
+         * Get the resource bundle, if one was loaded
+         */
+        inline core::Resource_Bundle::ptr_t bundle() const { return m_bundle; }
 
         /**
          * Create a new instance of the resource-manager
+         * 
+         * @param resource_root Folder containing loose resources
+         * @param bundle        Packed resources to check before the loose folder.  May be null.
+         * @param driver        Driver used to decode loose images
          */
         static Resource_Manager::ptr_t create( const std::filesystem::path& resource_root,
+                                               core::Resource_Bundle::ptr_t bundle,
                                                drv::Driver_Base&            driver );
 
     private:
@@ -98,11 +146,15 @@ class Resource_Manager {
          * Parameterized Constructor
          */
         Resource_Manager( const std::filesystem::path& resource_root,
+                          core::Resource_Bundle::ptr_t bundle,
                           drv::Driver_Base&            driver );
 
         /// @brief Location of base folder for all resources
         std::filesystem::path m_resource_root;
 
+        /// @brief Packed resources, checked before the loose folder
+        core::Resource_Bundle::ptr_t m_bundle;
+
         /// @brief Underlying Driver for loading data.
         drv::Driver_Base& m_driver;
 
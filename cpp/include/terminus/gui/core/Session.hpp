@@ -18,12 +18,18 @@
 #include <chrono>
 #include <filesystem>
 #include <memory>
+#include <vector>
 
 // Project Libraries
 #include <terminus/core/Options.hpp>
 #include <terminus/driver/DriverBase.hpp>
+#include <terminus/gui/core/Frame_Pacer.hpp>
+#if TERMINUS_POSIX
+#include <terminus/gui/core/Presenter.hpp>
+#endif
 #include <terminus/gui/core/Resource_Manager.hpp>
 #include <terminus/image/Frame.hpp>
+#include <terminus/image/Frame_Recording.hpp>
 
 namespace tmns::gui {
 
@@ -45,7 +51,8 @@ class Session {
         drv::Driver_Base& driver() const;
 
         /**
-         * Get a copy of the current screen buffer
+         * Get the buffer to render the next frame into.  With a presentation thread this
+         * changes after every call to show().
          */
         img::Frame& active_frame();
 
@@ -59,6 +66,36 @@ class Session {
          */
         bool okay_to_run();
 
+        /**
+         * Get the key events taken by the last call to okay_to_run()
+         */
+        const std::vector<drv::Input_Event>& input_events() const;
+
+        /**
+         * Ask for frames at the full rate.  Call on every update while something is animating.
+         */
+        void request_animation();
+
+        /**
+         * Check and clear any animation request since the last call
+         */
+        bool take_animation_request();
+
+        /**
+         * Get the time on the frame clock, which is the number of frames shown times the
+         * frame interval.
+         *
+         * Animations step by this rather than the wall clock.  Recorded input is replayed by
+         * frame number, so a replay then reaches the same states on the same frames however
+         * fast it runs.  Animations request full-rate frames, so live runs stay close to real time.
+         */
+        std::chrono::duration<double> frame_clock() const;
+
+        /**
+         * Set the rate the frame clock assumes frames are shown at
+         */
+        void set_frame_rate( double fps );
+
         /**
          * Finalize and close session
          * 
@@ -72,7 +109,10 @@ class Session {
         void sleep_for( std::chrono::milliseconds sleep_time );
 
         /**
-         * Show the active frame
+         * Show the active frame, and add it to the recording if one is running.
+         *
+         * With a presentation thread, the frame is handed off and this returns without
+         * waiting for the driver.
          */
         void show();
 
@@ -104,9 +144,32 @@ class Session {
         // Active Frame
         img::Frame m_active_frame;
 
+#if TERMINUS_POSIX
+        /// @brief Optional presentation thread, which then owns the screen buffers
+        Presenter::ptr_t m_presenter;
+#endif
+
         /// @brief Resource-Management API
         Resource_Manager::ptr_t m_resource_manager;
 
+        /// @brief Key events for the current frame
+        std::vector<drv::Input_Event> m_input_events;
+
+        /// @brief Set when something asked for full-rate frames
+        bool m_animation_requested { false };
+
+        /// @brief Frames shown so far
+        uint64_t m_frames_shown { 0 };
+
+        /// @brief Frame clock step per frame shown
+        std::chrono::duration<double> m_frame_interval { 1.0 / Frame_Pacer::DEFAULT_TARGET_FPS };
+
+        /// @brief Optional recording of every frame shown
+        img::Recording_Writer::ptr_t m_recorder;
+
+        /// @brief When the recording started
+        std::chrono::steady_clock::time_point m_record_start;
+
 }; // End of Session class
 
 } // End of tmns::gui namespace
\ No newline at end of file
@@ -23,12 +23,23 @@
 
 // C++ Standard Libraries
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace tmns::gui {
 
 /**
  * @class LayoutBase
+ *
+ * Layouts size their widgets in two passes:
+ *  - `measure()` works bottom-up, combining each widget's `size_hint()` into the layout's
+ *    own minimum, preferred and maximum size.
+ *  - `arrange()` works top-down, splitting the size the layout is given between its widgets
+ *    (see `allocate_bboxes()`) and passing each its share.
+ *
+ * Both results are cached.  Adding widgets, changing the padding, size or stretch policies,
+ * or a widget calling `invalidate_layout()`, clears the cache here and in every layout above.
+ * Rendering an unchanged layout reuses the last arrangement.
  */
 class LayoutBase
 {
@@ -37,8 +48,8 @@ class LayoutBase
         /// Pointer Type
         using ptr_t = std::shared_ptr<LayoutBase>;
 
-        /// @brief Destructor
-        virtual ~LayoutBase() = default;
+        /// @brief Destructor.  Detaches the widgets from the layout.
+        virtual ~LayoutBase();
 
         /**
          * Show the contents of the layout on the screen
@@ -62,6 +73,70 @@ class LayoutBase
          */
         virtual void set_layout_size( math::Size2i size );
 
+        /**
+         * Get the Horizontal Stretch Policy
+         */
+        StretchPolicy horizontal_stretch_policy() const;
+
+        /**
+         * Set the Horizontal Stretch Policy
+         */
+        void set_horizontal_stretch_policy( StretchPolicy policy );
+
+        /**
+         * Get the Vertical Stretch Policy
+         */
+        StretchPolicy vertical_stretch_policy() const;
+
+        /**
+         * Set the Vertical Stretch Policy
+         */
+        void set_vertical_stretch_policy( StretchPolicy policy );
+
+        /**
+         * Set whether a widget's slot takes a share of spare room.  Widgets start as GROW.
+         *
+         * @throws std::runtime_error if the index is out of range.
+         */
+        void set_item_stretch( int           index,
+                               StretchPolicy policy );
+
+        /**
+         * Measure pass.  The size range of the layout, including padding.
+         *
+         * On a FIXED axis the range is the declared layout size, or the preferred size of the
+         * content if none was declared.  On a GROW axis the maximum is unbounded.
+         */
+        const SizeHint& measure() const;
+
+        /**
+         * Arrange pass.  Take a new size and place the widgets in it.
+         *
+         * Does nothing if the size is unchanged and nothing has been invalidated.
+         */
+        void arrange( math::Size2i size );
+
+        /**
+         * Where each widget is drawn, arranging first if needed.  Widgets with no room have
+         * an empty rectangle.
+         */
+        const std::vector<math::Rect2i>& arrangement();
+
+        /**
+         * Clear the cached measurement and arrangement, here and in every layout above
+         */
+        void invalidate();
+
+        /**
+         * Tell the widget holding this layout, and anything caching it, that it draws differently
+         */
+        void invalidate_render() const;
+
+        /**
+         * Number of times the layout has been arranged.  Useful for checking the cache.
+         */
+        size_t arrange_count() const;
+
         /**
          * Get the assigned padding
          */
@@ -91,6 +166,8 @@ class LayoutBase
 
         /**
          * Get access to widgets
+         *
+         * @note Call `invalidate()` after changing them.
          */
         std::vector<WidgetLayoutItem>& widgets();
 
@@ -114,17 +191,8 @@ class LayoutBase
          * @note:  This is not the space it'll use.  This is the space reserved
          *         - This takes into account the number of widgets, ratio, stretch policy, etc.
          * 
-         * Guidance on how rules are applied
-         * - If StretchPolicy is FIXED:
-         *    1. The total widget size is fetched
-         *    2. The size is adjusted according to padding
-         *        Rectangles are adjusted as well
-         *    3. Ratios (for widgets which have them) are summed to get total.
-         *      - Ratios are normalized so the ratios sum to 1  (in-ratio / sum-ratio)
-         *    4. Widgets without ratios get auto-assigned the leftover ratios
-         *    5. All widgets are assigned a box size
-         * 
-         * - non-Fixed is unsupported at this time
+         * Linear layouts split their length with `flex_distribute()`, using each widget's
+         * measured size and ratio, and give every widget the full width across.
          */
         virtual std::vector<math::Rect2i> allocate_bboxes() const = 0;
 
@@ -148,14 +216,75 @@ class LayoutBase
         
     protected:
 
+        /**
+         * Size range of the widgets alone, before padding and stretch policies
+         */
+        virtual SizeHint measure_content() const = 0;
+
+        /**
+         * Add a widget, taking ownership of its layout notifications
+         *
+         * @returns Index of the new widget
+         */
+        int add_item( WidgetLayoutItem item );
+
+        /**
+         * Swap in a new set of widgets, as virtualized layouts do when they scroll.
+         *
+         * Only this layout is arranged again.  Its measurement, and the layouts above it,
+         * are unaffected, but anything caching its pixels draws again.
+         */
+        void replace_items( std::vector<WidgetLayoutItem> items );
+
+        /**
+         * Content size range of a row (`axis` 0) or column (`axis` 1) of widgets
+         */
+        SizeHint measure_linear( size_t axis ) const;
+
+        /**
+         * Slots for a row (`axis` 0) or column (`axis` 1) of widgets
+         */
+        std::vector<math::Rect2i> allocate_linear( size_t axis ) const;
+
+        /**
+         * Render every widget with room into its arranged place
+         */
+        void render_widgets( Session&         session,
+                             img::Frame_View& image );
+
         /// List of widgets
         std::vector<WidgetLayoutItem> m_widgets;
         
     private:
 
-        /// @brief Declared Size
+        /// Widget layouts register themselves as the owner
+        friend class WidgetLayout;
+
+        /// Widget showing this layout, notified when the layout is invalidated
+        WidgetBase* m_owner { nullptr };
+
+        /// Cached measure pass
+        mutable std::optional<SizeHint> m_measured;
+
+        /// Cached arrange pass
+        std::vector<math::Rect2i> m_placed;
+
+        /// Set when the cached arrangement is out of date
+        bool m_arrange_dirty { true };
+
+        /// Times arranged
+        size_t m_arrange_count { 0 };
+
+        /// Stretch Policies
+        StretchPolicy m_horizontal_stretch_policy { StretchPolicy::FIXED };
+        StretchPolicy m_vertical_stretch_policy { StretchPolicy::FIXED };
+
+        /// @brief Current size, from the last arrange pass or the declared size
         math::Size2i m_layout_size;
 
+        /// @brief Declared Size.  Used by the measure pass on FIXED axes.
+        math::Size2i m_declared_size;
+
         /// @brief Padding to use
         math::Vector4i m_padding { { 0, 0, 0, 0 } };
 
@@ -0,0 +1,260 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    LayoutGrid.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Virtualized Grid Layout API
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// Project Libraries
+#include <terminus/driver/Input_Event.hpp>
+#include <terminus/gui/layout/LayoutBase.hpp>
+#include <terminus/gui/widget/WidgetBase.hpp>
+
+namespace tmns::gui {
+
+/**
+ * @class LayoutGrid
+ *
+ * Lays items out in rows of equal cells, as many columns as fit across, with keyboard focus.
+ *
+ * Only the rows which intersect the layout have widgets.  Items come from a cell factory,
+ * called as items scroll into view.  Cells which scroll out of view are handed back to the
+ * factory to be rebound, so the number of live widgets, and the cost of arranging and
+ * rendering, follows the size of the viewport rather than the number of items.  Widgets
+ * added with `append()` are shown the same way, without recycling.
+ *
+ * The view scrolls a row at a time to keep the focused item fully visible.
+ */
+class LayoutGrid : public LayoutBase
+{
+    public:
+
+        /// @brief Pointer Type
+        typedef std::shared_ptr<LayoutGrid> ptr_t;
+
+        /**
+         * Build the widget for an item.  `recycled` is a cell which has scrolled out of view,
+         * or null.  Return it rebound to the item, or a new widget.
+         */
+        using Cell_Factory = std::function<WidgetBase::ptr_t( size_t index, WidgetBase::ptr_t recycled )>;
+
+        /// Called when the focused item is activated (Enter or Space)
+        using Activate_Callback = std::function<void( size_t index )>;
+
+        /**
+         * Cell widget counts
+         */
+        struct Stats {
+
+            /// Cells built from scratch
+            size_t cells_created { 0 };
+
+            /// Cells rebound from the recycle pool
+            size_t cells_recycled { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         *
+         * @param cell_size Size of every cell
+         * @param spacing   Gap between cells, in both directions
+         */
+        LayoutGrid( math::Size2i cell_size,
+                    int          spacing = 0 );
+
+        // Destructor
+        ~LayoutGrid() override = default;
+
+        /**
+         * Add a widget as the next item
+         */
+        int append( WidgetBase::ptr_t new_widget ) override;
+
+        /**
+         * Add a widget as the next item.  The widget is aligned within its cell, and the ratio
+         * is ignored.
+         */
+        int append( WidgetBase::ptr_t          new_widget,
+                    std::set<AlignmentPolicy>  alignment,
+                    std::optional<double>      ratio ) override;
+
+        /**
+         * Build cells on demand instead of holding a widget per item
+         */
+        void set_cell_factory( size_t       item_count,
+                               Cell_Factory factory );
+
+        /**
+         * Number of items in the grid
+         */
+        size_t item_count() const;
+
+        /**
+         * Size of every cell
+         */
+        math::Size2i cell_size() const;
+
+        /**
+         * Columns which fit in the current layout size.  At least one.
+         */
+        size_t columns() const;
+
+        /**
+         * Rows needed for every item
+         */
+        size_t rows() const;
+
+        /**
+         * First row in view
+         */
+        size_t first_visible_row() const;
+
+        /**
+         * Rows which intersect the view, including a partly visible last row
+         */
+        size_t visible_rows() const;
+
+        /**
+         * Item with keyboard focus, if any
+         */
+        std::optional<size_t> focus() const;
+
+        /**
+         * Focus an item and scroll it into view
+         *
+         * @throws std::runtime_error if the index is out of range.
+         */
+        void set_focus( size_t index );
+
+        /**
+         * Move the focus with the arrow, Home, End and Page keys, and activate the focused
+         * item with Enter or Space.
+         *
+         * @returns True if the event was used.
+         */
+        bool handle_input( const drv::Input_Event& event );
+
+        /**
+         * Set the function called when an item is activated
+         */
+        void set_activate_callback( Activate_Callback callback );
+
+        /**
+         * Set the color of the focus outline
+         */
+        void set_focus_color( math::Vector4u color );
+
+        /**
+         * Items which currently have a widget, in order
+         */
+        const std::vector<size_t>& bound_items() const;
+
+        /**
+         * Cell widget counts
+         */
+        const Stats& stats() const;
+
+        /**
+         * Bind the items in view, then draw them and the focus outline
+         */
+        bool render( Session&         session,
+                     img::Frame_View& image ) override;
+
+        /**
+         * Get allocated region for the widgets in view.  Cells run left to right, then top to
+         * bottom, starting from the first visible row.
+         */
+        std::vector<math::Rect2i> allocate_bboxes() const override;
+
+        /**
+         * Print to Log-Friendly String
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Bind widgets to the items in view.  Does nothing if the view has not moved.
+         */
+        void update_view();
+
+    protected:
+
+        /**
+         * One cell minimum, and a roughly square grid of every item preferred
+         */
+        SizeHint measure_content() const override;
+
+    private:
+
+        /**
+         * Rows which fit completely in the view.  At least one.
+         */
+        size_t full_rows() const;
+
+        /**
+         * Get the widget for an item
+         */
+        WidgetBase::ptr_t bind_item( size_t index );
+
+        /// Size of every cell
+        math::Size2i m_cell_size;
+
+        /// Gap between cells
+        int m_spacing { 0 };
+
+        /// Widgets added with append()
+        std::vector<WidgetLayoutItem> m_items;
+
+        /// Cell factory, if set
+        Cell_Factory m_factory;
+
+        /// Number of factory items
+        size_t m_factory_count { 0 };
+
+        /// Items bound to the current widgets
+        std::vector<size_t> m_bound;
+
+        /// Cells waiting to be rebound
+        std::vector<WidgetBase::ptr_t> m_recycled;
+
+        /// First row in view
+        size_t m_first_row { 0 };
+
+        /// Set when the bound items need to be checked
+        bool m_view_dirty { true };
+
+        /// Column count the bound items were arranged for
+        size_t m_bound_columns { 0 };
+
+        /// Focused item
+        std::optional<size_t> m_focus;
+
+        /// Activation callback
+        Activate_Callback m_activate;
+
+        /// Focus outline color
+        math::Vector4u m_focus_color { { 255, 255, 255, 255 } };
+
+        /// Cell widget counts
+        Stats m_stats;
+
+};// End of LayoutGrid class
+
+} // End of tmns::gui namespace
@@ -20,6 +20,11 @@
 #include <cinttypes>
 #include <optional>
 #include <set>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/math/Size.hpp>
 
 namespace tmns::gui {
 
@@ -43,21 +48,91 @@ enum class AlignmentPolicy : uint32_t {
 
 /**
  * Set the stretch policy
+ *
+ * On a layout axis, FIXED keeps the declared layout size (or the content size if none was
+ * declared) and GROW accepts whatever the parent offers.  On a layout item, GROW lets the
+ * item's slot take a share of any spare room, and FIXED keeps the slot at its preferred size.
  */
 enum class StretchPolicy {
     FIXED = 0,
     GROW  = 1,
 }; // End of StretchPolicy Enum
 
+/**
+ * Size range a widget or layout can work with, found by the measure pass
+ */
+struct SizeHint {
+
+    /// Maximum for anything that will take any size
+    static constexpr int UNBOUNDED { 1 << 24 };
+
+    /// Smallest usable size
+    math::Size2i minimum;
+
+    /// Size it would like to have
+    math::Size2i preferred;
+
+    /// Largest size it can use.  Anything larger is aligned inside the extra space.
+    math::Size2i maximum { { UNBOUNDED, UNBOUNDED } };
+
+    /**
+     * Print to a log-friendly string
+     */
+    std::string to_string() const;
+
+    /**
+     * A hint which only accepts a single size
+     */
+    static SizeHint fixed( math::Size2i size );
+
+}; // End of SizeHint struct
+
 struct WidgetLayoutInfo {
     
-    // Where in the structure to align the asset
+    // Where in the structure to align the asset.  Items without an alignment fill their slot.
     std::set<AlignmentPolicy> alignment; 
 
     // How much of the layout do you want this widget to take
     std::optional<double> ratio;
 
-    // 
+    // Whether the item's slot takes a share of any spare room
+    StretchPolicy stretch { StretchPolicy::GROW };
 };
 
+/**
+ * One item along the main axis of a linear layout
+ */
+struct FlexItem {
+
+    /// Smallest, preferred and largest length of the item
+    int minimum   { 0 };
+    int preferred { 0 };
+    int maximum   { SizeHint::UNBOUNDED };
+
+    /// Fraction of the whole axis, when set
+    std::optional<double> ratio;
+
+    /// Whether the item takes a share of spare room
+    StretchPolicy stretch { StretchPolicy::GROW };
+
+}; // End of FlexItem struct
+
+/**
+ * Split the length of a linear layout between its items.
+ *
+ * 1. Items with a ratio get that fraction of `available`.  If the ratios add up to more
+ *    than one they are scaled to fill the whole axis, leaving nothing for the rest.
+ * 2. The other items start at their preferred length.
+ * 3. If that is too much, they shrink towards their minimum in proportion to how far they
+ *    can shrink.  If even the minimums do not fit, items are filled in order and the last
+ *    ones get clipped.
+ * 4. Spare room is shared equally between the GROW items.  Items stop growing at their
+ *    maximum, and what they could not take is shared between the others.  Room nothing can
+ *    take is left unused.
+ *
+ * @returns Length of each item, in order
+ */
+std::vector<int> flex_distribute( const std::vector<FlexItem>& items,
+                                  int                          available );
+
 } // End of tmns::gui namespace
@@ -17,16 +17,73 @@
 #pragma once
 
 // C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <list>
 #include <memory>
+#include <optional>
+#include <string>
 
 // Project Libraries
 #include <terminus/gui/layout/LayoutBase.hpp>
 #include <terminus/gui/widget/WidgetBase.hpp>
+#include <terminus/image/Frame.hpp>
 
 namespace tmns::gui {
 
+/**
+ * Animation used when a LayoutStack switches pages
+ */
+enum class PageTransition : uint8_t
+{
+    NONE      = 0, ///< Show the new page straight away
+    SLIDE     = 1, ///< The new page pushes the old one out sideways
+    CROSSFADE = 2, ///< The new page fades in over the old one
+}; // End of PageTransition Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( PageTransition transition );
+
+/**
+ * Parse a transition name ("none", "slide" or "crossfade")
+ *
+ * @throws std::runtime_error if the name is not recognized.
+ */
+PageTransition page_transition_from_string( const std::string& name );
+
+/**
+ * Draw one step of a page transition from two page images
+ *
+ * @param transition Animation to draw.  NONE draws the new page.
+ * @param progress   Fraction of the animation done, from 0 (old page) to 1 (new page)
+ * @param forward    Slide the new page in from the right, instead of the left
+ * @param from       Image of the page being left
+ * @param to         Image of the page being shown
+ * @param image      View to draw into, the size of both pages
+ */
+void render_page_transition( PageTransition    transition,
+                             double            progress,
+                             bool              forward,
+                             const img::Frame& from,
+                             const img::Frame& to,
+                             img::Frame_View&  image );
+
 /**
  * @class LayoutStack
+ *
+ * Shows one of its widgets at a time, each filling the area inside the padding.
+ *
+ * With `set_page_cache()`, the stack keeps the last image of the most recently shown pages.
+ * Switching to a cached page copies its image on the first frame and renders the live page on
+ * the next one, so the switch never waits on a heavy page.  A cached image may be a frame
+ * behind, which a page that is not on screen rarely is.  Keeping the images costs one copy of
+ * the page area per live render.
+ *
+ * With `set_transition()`, switches animate between the image of the page being left and the
+ * page being shown.  Each step is two copies, whatever the pages hold.  The page being left
+ * must have been rendered with the cache on, otherwise the switch is immediate.
  */
 class LayoutStack : public LayoutBase
 {
@@ -35,6 +92,25 @@ class LayoutStack : public LayoutBase
         /// @brief Pointer Type
         typedef std::shared_ptr<LayoutStack> ptr_t;
 
+        /**
+         * Page switching counts
+         */
+        struct Stats {
+
+            /// Frames where the current page rendered itself
+            size_t renders { 0 };
+
+            /// Switches shown from a cached image
+            size_t cache_hits { 0 };
+
+            /// Switches which had to render the new page
+            size_t cache_misses { 0 };
+
+            /// Frames drawn by a transition
+            size_t transition_frames { 0 };
+
+        }; // End of Stats struct
+
         // Default Constructor
         LayoutStack() = default;
 
@@ -63,11 +139,55 @@ class LayoutStack : public LayoutBase
         bool render( Session&         session,
                      img::Frame_View& image ) override;
 
+        /**
+         * Index of the page being shown, if any pages were added
+         */
+        std::optional<size_t> current() const;
+
+        /**
+         * Show another page, starting the transition if one is set
+         *
+         * @throws std::runtime_error if the index is out of range.
+         */
+        void set_current( size_t index );
+
+        /**
+         * Keep the last image of up to `capacity` pages, dropping the least recently shown.
+         * Zero, the default, turns the cache off and releases the images.
+         */
+        void set_page_cache( size_t capacity );
+
+        /**
+         * Number of page images kept
+         */
+        size_t page_cache_capacity() const;
+
+        /**
+         * Check if an image of the page is kept
+         */
+        bool is_page_cached( size_t index ) const;
+
+        /**
+         * Animate page switches.  A zero duration turns the animation off.
+         */
+        void set_transition( PageTransition            transition,
+                             std::chrono::milliseconds duration );
+
+        /**
+         * Check if a page switch is still animating
+         */
+        bool in_transition() const;
+
+        /**
+         * Page switching counts
+         */
+        const Stats& stats() const;
+
         /**
          * Get allocated region for widgets
          * 
          * @note:  This is not the space it'll use.  This is the space reserved
-         *         - This takes into account the number of widgets, ratio, stretch policy, etc.
+         *         - Every page gets the whole area inside the padding.
          */
         std::vector<math::Rect2i> allocate_bboxes() const override;
 
@@ -76,11 +196,73 @@ class LayoutStack : public LayoutBase
          */
         std::string to_log_string( size_t offset = 0 ) const override;
 
+    protected:
+
+        /**
+         * Size range of the largest page
+         */
+        SizeHint measure_content() const override;
+
     private:
 
+        /**
+         * Last image of a page
+         */
+        struct Cached_Page {
+
+            /// Page index
+            size_t index { 0 };
+
+            /// Page area as last shown
+            img::Frame image;
+
+        }; // End of Cached_Page struct
+
+        /**
+         * Find the image of a page, and mark it most recently used
+         *
+         * @returns null if there is none.
+         */
+        img::Frame* find_page( size_t index );
+
+        /**
+         * Keep a copy of the page as drawn in the view, dropping the oldest image if full
+         */
+        void store_page( size_t index, const img::Frame_View& image );
+
         /// Index of current frame to show.  Optional since it's invalid until used.
         std::optional<size_t> m_current_frame {};
 
+        /// Page images, most recently used first
+        std::list<Cached_Page> m_page_cache;
+
+        /// Most page images kept
+        size_t m_page_cache_capacity { 0 };
+
+        /// Show the cached image of the current page on the next frame
+        bool m_show_cached { false };
+
+        /// Animation used for page switches
+        PageTransition m_transition { PageTransition::NONE };
+
+        /// Length of the animation
+        std::chrono::milliseconds m_transition_duration { 0 };
+
+        /// Image of the page being left, while animating
+        std::optional<img::Frame> m_transition_from;
+
+        /// Image of the page being shown, once drawn
+        std::optional<img::Frame> m_transition_to;
+
+        /// Frame clock time of the first animation frame
+        std::optional<std::chrono::duration<double>> m_transition_start;
+
+        /// Moving to a later page
+        bool m_transition_forward { true };
+
+        /// Page switching counts
+        Stats m_stats;
+
 };// End of LayoutStack class
 
 } // End of tmns::gui namespace
@@ -38,16 +38,6 @@ class LayoutVertical : public LayoutBase
         // Default Constructor
         LayoutVertical() = default;
 
-        /**
-         * Get the Vertical Stretch Policy
-         */
-        StretchPolicy vertical_stretch_policy() const;
-
-        /**
-         * Set the Vertical Stretch Policy
-         */
-        void set_vertical_stretch_policy( StretchPolicy policy );
-
         /**
          * Add Widget to Lyout
          */
@@ -72,17 +62,8 @@ class LayoutVertical : public LayoutBase
          * @note:  This is not the space it'll use.  This is the space reserved
          *         - This takes into account the number of widgets, ratio, stretch policy, etc.
          * 
-         * Guidance on how rules are applied
-         * - If StretchPolicy is FIXED:
-         *    1. The total widget size is fetched
-         *    2. The size is adjusted according to padding
-         *        Rectangles are adjusted as well
-         *    3. Ratios (for widgets which have them) are summed to get total.
-         *      - Ratios are normalized so the ratios sum to 1  (in-ratio / sum-ratio)
-         *    4. Widgets without ratios get auto-assigned the leftover ratios
-         *    5. All widgets are assigned a box size
-         * 
-         * - non-Fixed is unsupported at this time
+         * Widgets share the layout's height with `flex_distribute()`, and each gets the full
+         * width across.
          */
         std::vector<math::Rect2i> allocate_bboxes() const override;
 
@@ -91,10 +72,12 @@ class LayoutVertical : public LayoutBase
          */
         std::string to_log_string( size_t offset = 0 ) const override;
 
-    protected: 
-    
-        /// Vertical Stretch Policy
-        StretchPolicy m_vertical_stretch_policy { StretchPolicy::FIXED };
+    protected:
+
+        /**
+         * Size range of the column of widgets
+         */
+        SizeHint measure_content() const override;
 
 };// End of LayoutVertical class
 
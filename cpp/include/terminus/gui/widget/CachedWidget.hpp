@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    CachedWidget.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Render-to-Texture Widget Cache
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <memory>
+
+// Project Libraries
+#include <terminus/gui/widget/WidgetBase.hpp>
+#include <terminus/image/Frame.hpp>
+
+namespace tmns::gui {
+
+/**
+ * @class CachedWidget
+ *
+ * Draws a widget, and everything inside it, once into an off-screen frame, then copies that
+ * frame on later renders instead of drawing the widget again.
+ *
+ * Meant for composites which rarely change, such as a header made of a layout, padding,
+ * borders and several labels.  A fully opaque cache is copied a row at a time with no
+ * blending.
+ *
+ * The cache is dropped when the size it is drawn at changes, or when the widget or anything
+ * inside it calls `invalidate_layout()` or `invalidate_render()`.  A widget which asks the
+ * session for animation while being drawn is drawn again on every render.
+ */
+class CachedWidget : public WidgetBase {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<CachedWidget>;
+
+        /**
+         * Cache use counts
+         */
+        struct Stats {
+
+            /// Renders which drew the widget
+            size_t renders { 0 };
+
+            /// Renders which copied the cache
+            size_t hits { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         *
+         * @throws std::runtime_error if `child` is null.
+         */
+        CachedWidget( WidgetBase::ptr_t child );
+
+        /**
+         * Destructor.  Detaches the child.
+         */
+        ~CachedWidget() override;
+
+        /**
+         * Get the child's size
+         */
+        math::Size2i size_pixels() const override;
+
+        /**
+         * Get the child's size hint
+         */
+        SizeHint size_hint() const override;
+
+        /**
+         * Pass the arranged size to the child
+         */
+        void arrange( math::Size2i size ) override;
+
+        /// Keep the opacity overload visible next to the override below
+        using WidgetBase::render;
+
+        /**
+         * Copy the cache, drawing the child into it first if needed
+         */
+        bool render( Session&         session,
+                     img::Frame_View& image ) override;
+
+        /**
+         * Get the wrapped widget
+         */
+        WidgetBase::ptr_t child() const;
+
+        /**
+         * Check if the next render can use the cache
+         */
+        bool is_cached() const;
+
+        /**
+         * Get the cache use counts
+         */
+        const Stats& stats() const;
+
+        /**
+         * Print Log-Friendly String
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Wrap a widget in a cache
+         */
+        static CachedWidget::ptr_t create( WidgetBase::ptr_t child );
+
+    protected:
+
+        /**
+         * Drop the cache
+         */
+        void render_invalidated() const override;
+
+    private:
+
+        /// Wrapped widget
+        WidgetBase::ptr_t m_child;
+
+        /// Child as last drawn, premultiplied
+        img::Frame m_cache;
+
+        /// Set when the cache must be drawn again
+        mutable bool m_dirty { true };
+
+        /// Set when every cached pixel is opaque
+        bool m_opaque { false };
+
+        /// Cache use counts
+        Stats m_stats;
+
+}; // End of CachedWidget Class
+
+} // End of tmns::gui namespace
@@ -16,8 +16,12 @@
  */
 #pragma once
 
+// C++ Standard Libraries
+#include <optional>
+
 // Project Libraries
 #include <terminus/driver/DriverBase.hpp>
+#include <terminus/gui/core/Resource_Manager.hpp>
 #include <terminus/gui/widget/WidgetBase.hpp>
 #include <terminus/image/Frame.hpp>
 #include <terminus/math/Size.hpp>
@@ -39,6 +43,9 @@ class Label : public WidgetBase {
          */
         math::Size2i size_pixels() const override;
 
+        /// Keep the opacity overload visible next to the override below
+        using WidgetBase::render;
+
         /**
          * Show the label
          */
@@ -56,6 +63,41 @@ class Label : public WidgetBase {
         static Label::ptr_t from_image( const std::filesystem::path& image_path,
                                         drv::Driver_Base&            driver );
 
+        /**
+         * Load an image on the driver's loader threads and return at once.
+         *
+         * Until the image arrives the label takes `placeholder_size` and draws a faint box,
+         * then it switches to the image at its own size.  If loading fails the placeholder
+         * stays and a warning is logged.
+         */
+        static Label::ptr_t from_image_async( const std::filesystem::path& image_path,
+                                              drv::Driver_Base&            driver,
+                                              math::Size2i                 placeholder_size );
+
+        /**
+         * Check if the label is still waiting on its image.  The image is taken from the loader
+         * when the label is next rendered.
+         */
+        bool is_loading() const;
+
+        /**
+         * Load a named resource (ie `images/logo/logo_235_65.png`) through the resource-manager.
+         * 
+         * Works without a filesystem when the resource is embedded in the binary.
+         * 
+         * @throws std::runtime_error if the resource cannot be found.
+         */
+        static Label::ptr_t from_resource( const std::string& name,
+                                           Resource_Manager&  resources );
+
+        /**
+         * Load a named resource without blocking.  Behaves like `from_image_async()`, and the
+         * image is premultiplied on arrival like resources loaded through `from_resource()`.
+         */
+        static Label::ptr_t from_resource_async( const std::string& name,
+                                                 Resource_Manager&  resources,
+                                                 math::Size2i       placeholder_size );
+
         /**
          * Render as text
          */
@@ -69,9 +111,25 @@ class Label : public WidgetBase {
 
     private:
 
-        /// Pixel Data
+        /**
+         * Take the image once the loader has finished with it
+         *
+         * @returns True if the image arrived and the label changed size.
+         */
+        bool resolve_pending();
+
+        /// Pixel Data.  Filled in from the loader by the first render after it finishes.
         img::Frame::ptr_t m_image { nullptr };
 
+        /// Image still being loaded
+        std::optional<drv::Image_Loader::Result> m_pending;
+
+        /// Convert the loaded image to premultiplied alpha
+        bool m_premultiply_on_load { false };
+
+        /// Size while the image is loading, or if it failed
+        math::Size2i m_placeholder_size;
+
 }; // End of Label Class
 
 } // End of tmns::gui namespace
\ No newline at end of file
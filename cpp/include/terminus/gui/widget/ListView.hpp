@@ -0,0 +1,291 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    ListView.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Virtualized Scrolling List Widget
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Project Libraries
+#include <terminus/driver/Input_Event.hpp>
+#include <terminus/gui/widget/WidgetBase.hpp>
+#include <terminus/image/Frame.hpp>
+#include <terminus/math/Size.hpp>
+
+namespace tmns::gui {
+
+/**
+ * @class ListView
+ *
+ * Vertical list of rows built on demand from a data source.
+ *
+ * The data source is a row count and a builder.  Only the rows in view have widgets.  Rows
+ * which scroll out of view go to a small pool and are handed back to the builder to be
+ * rebound, so the cost of a list follows the viewport rather than the number of items.
+ *
+ * Row heights are measured the first time a row is built, from its size hint.  Rows not yet
+ * measured count as `estimated_row_height`, so opening a list, or jumping to any row, takes
+ * the same time for ten rows as for a hundred thousand.  The scroll position is kept as the
+ * top row and how far it is scrolled off, rather than as a pixel offset from the top.
+ *
+ * Rendered rows are kept in an off-screen frame.  Scrolling moves the frame's pixels and
+ * only draws the rows uncovered at the edge, so row widgets are not redrawn every frame.
+ * Call `refresh()` when the rows' content changes.
+ */
+class ListView : public WidgetBase {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<ListView>;
+
+        /**
+         * Build the widget for a row.  `recycled` is a row which has scrolled out of view,
+         * or null.  Return it rebound to the row, or a new widget.
+         */
+        using Row_Builder = std::function<WidgetBase::ptr_t( size_t index, WidgetBase::ptr_t recycled )>;
+
+        /**
+         * Row widget and drawing counts
+         */
+        struct Stats {
+
+            /// Row widgets built from scratch
+            size_t rows_built { 0 };
+
+            /// Row widgets rebound from the pool
+            size_t rows_recycled { 0 };
+
+            /// Rows drawn into the off-screen frame
+            size_t rows_rendered { 0 };
+
+            /// Renders which drew every row in view
+            size_t full_redraws { 0 };
+
+            /// Renders which moved the pixels and drew only the uncovered rows
+            size_t scroll_blits { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         *
+         * @param size                 Initial size, until the layout arranges the list
+         * @param estimated_row_height Height assumed for rows not measured yet
+         */
+        ListView( math::Size2i size,
+                  int          estimated_row_height );
+
+        /**
+         * Get the list size
+         */
+        math::Size2i size_pixels() const override;
+
+        /**
+         * Lists grow to whatever room they are given
+         */
+        SizeHint size_hint() const override;
+
+        /**
+         * Take the size given by the layout
+         */
+        void arrange( math::Size2i size ) override;
+
+        /// Keep the opacity overload visible next to the override below
+        using WidgetBase::render;
+
+        /**
+         * Draw the rows in view
+         */
+        bool render( Session&         session,
+                     img::Frame_View& image ) override;
+
+        /**
+         * Show a new data source, scrolled to the top
+         */
+        void set_data_source( size_t      row_count,
+                              Row_Builder builder );
+
+        /**
+         * Get the number of rows
+         */
+        size_t item_count() const;
+
+        /**
+         * Rebind, measure and redraw the rows in view, after their content changed
+         */
+        void refresh();
+
+        /**
+         * Scroll down by `pixels`, or up if negative.  Stops at either end.
+         *
+         * @returns True if the list moved.
+         */
+        bool scroll_by( int pixels );
+
+        /**
+         * Put a row at the top of the view, or as close as the end of the list allows
+         */
+        void scroll_to( size_t index );
+
+        /**
+         * Row at the top of the view
+         */
+        size_t first_visible_row() const;
+
+        /**
+         * Pixels of the top row scrolled off the view
+         */
+        int first_row_offset() const;
+
+        /**
+         * Rows in view, from the top
+         */
+        const std::vector<size_t>& visible_rows() const;
+
+        /**
+         * Height of every row, using the estimate for rows not measured yet
+         */
+        size_t content_height() const;
+
+        /**
+         * Scroll with the arrow, page, Home and End keys
+         *
+         * @returns True if the event was used.
+         */
+        bool handle_input( const drv::Input_Event& event );
+
+        /**
+         * Set the color behind the rows
+         */
+        void set_background( math::Vector4u color );
+
+        /**
+         * Get the row and drawing counts
+         */
+        const Stats& stats() const;
+
+        /**
+         * Print Log-Friendly String
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Create an empty list
+         */
+        static ListView::ptr_t create( math::Size2i size,
+                                       int          estimated_row_height );
+
+    private:
+
+        /**
+         * Get a widget for a row, from the pool if possible
+         */
+        WidgetBase::ptr_t build_row( size_t index );
+
+        /**
+         * Get a row's height, binding the row if it has not been measured
+         */
+        int row_height( size_t index );
+
+        /**
+         * Send a bound row back to the pool
+         */
+        void release_row( size_t index );
+
+        /**
+         * Send every bound row back to the pool
+         */
+        void release_all();
+
+        /**
+         * Scroll back up if the rows below the top no longer fill the view
+         */
+        void clamp_to_end();
+
+        /**
+         * Pixels from a previous scroll position to the current one
+         */
+        int distance_from( size_t first,
+                           int    offset );
+
+        /**
+         * Bind the rows in view and pool the rest
+         */
+        void update_window();
+
+        /**
+         * Draw the rows which cross rows `y0` to `y1` of the off-screen frame
+         */
+        void draw_band( Session& session,
+                        int      y0,
+                        int      y1 );
+
+        /// List size
+        math::Size2i m_size;
+
+        /// Height assumed for rows not measured yet
+        int m_estimated_row_height;
+
+        /// Number of rows
+        size_t m_count { 0 };
+
+        /// Row builder
+        Row_Builder m_builder;
+
+        /// Measured row heights
+        std::unordered_map<size_t,int> m_heights;
+
+        /// Sum of the measured row heights
+        size_t m_measured_total { 0 };
+
+        /// Rows with widgets
+        std::map<size_t,WidgetBase::ptr_t> m_bound;
+
+        /// Row widgets waiting to be rebound
+        std::vector<WidgetBase::ptr_t> m_pool;
+
+        /// Rows in view
+        std::vector<size_t> m_window;
+
+        /// Row at the top of the view
+        size_t m_first { 0 };
+
+        /// Pixels of the top row scrolled off the view
+        int m_offset { 0 };
+
+        /// Scrolling since the last render
+        int m_pending_scroll { 0 };
+
+        /// Set when every row in view must be drawn again
+        bool m_redraw_all { true };
+
+        /// Rows as last drawn
+        img::Frame m_cache;
+
+        /// Color behind the rows
+        math::Vector4u m_background { { 0, 0, 0, 255 } };
+
+        /// Row widget and drawing counts
+        Stats m_stats;
+
+}; // End of ListView Class
+
+} // End of tmns::gui namespace
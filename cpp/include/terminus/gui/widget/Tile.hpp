@@ -0,0 +1,103 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Tile.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Launcher Tile Widget
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <memory>
+
+// Project Libraries
+#include <terminus/gui/widget/Label.hpp>
+#include <terminus/gui/widget/WidgetBase.hpp>
+#include <terminus/image/Frame.hpp>
+#include <terminus/math/Size.hpp>
+
+namespace tmns::gui {
+
+/**
+ * @class Tile
+ *
+ * An icon over a caption, centered in a fixed-size cell.  Grid layouts rebind the same tile
+ * to different items as they scroll, so the icon and caption are swapped with `bind()` rather
+ * than building a new widget.  The icon is a label so it can still be loading, in which case
+ * it draws its own placeholder.  Without an icon a grey box is drawn in its place.
+ */
+class Tile : public WidgetBase {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<Tile>;
+
+        /**
+         * Constructor
+         */
+        Tile( math::Size2i size );
+
+        /**
+         * Get the tile size
+         */
+        math::Size2i size_pixels() const override;
+
+        /// Keep the opacity overload visible next to the override below
+        using WidgetBase::render;
+
+        /**
+         * Draw the icon and caption
+         */
+        bool render( Session&         session,
+                     img::Frame_View& image ) override;
+
+        /**
+         * Show a new icon and caption.  Either may be null.
+         */
+        void bind( Label::ptr_t      icon,
+                   img::Frame::ptr_t caption );
+
+        /**
+         * Get the icon
+         */
+        Label::ptr_t icon() const;
+
+        /**
+         * Get the caption
+         */
+        img::Frame::ptr_t caption() const;
+
+        /**
+         * Print Log-Friendly String
+         */
+        std::string to_log_string( size_t offset = 0 ) const override;
+
+        /**
+         * Create an empty tile
+         */
+        static Tile::ptr_t create( math::Size2i size );
+
+    private:
+
+        /// Tile size
+        math::Size2i m_size;
+
+        /// Icon label
+        Label::ptr_t m_icon;
+
+        /// Caption image
+        img::Frame::ptr_t m_caption;
+
+}; // End of Tile Class
+
+} // End of tmns::gui namespace
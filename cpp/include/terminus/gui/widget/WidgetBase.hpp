@@ -23,11 +23,15 @@
 // Project Libraries
 #include <terminus/gui/core/Session.hpp>
 #include <terminus/gui/I_Renderable.hpp>
+#include <terminus/gui/layout/LayoutPrimitives.hpp>
 #include <terminus/image/Frame_View.hpp>
 #include <terminus/math/Size.hpp>
 
 namespace tmns::gui {
 
+/// Layouts keep track of the widgets they hold
+class LayoutBase;
+
 /**
  * @class WidgetBase
  */
@@ -48,6 +52,62 @@ class WidgetBase : public I_Renderable
          */
         virtual math::Size2i size_pixels() const = 0;
 
+        /**
+         * @brief Size range for the layout's measure pass.  Defaults to exactly `size_pixels()`.
+         */
+        virtual SizeHint size_hint() const;
+
+        /**
+         * @brief Take the size given by the layout's arrange pass.
+         *
+         * Widgets with their own layout arrange it here.  Others keep their size.
+         */
+        virtual void arrange( math::Size2i size );
+
+        /**
+         * @brief Tell the layout holding this widget that its size hint has changed.
+         *
+         * The layout and everything above it measure and arrange again on the next frame.
+         * Cached measurements are otherwise kept between frames.
+         */
+        void invalidate_layout() const;
+
+        /**
+         * @brief Tell anything caching this widget's pixels that its appearance has changed.
+         *
+         * Call when a widget draws differently without changing size.  The notice passes up
+         * through layouts and wrapping widgets, so a `CachedWidget` above draws again.
+         * `invalidate_layout()` sends the same notice.
+         */
+        void invalidate_render() const;
+
+        /// Widgets render through the two-argument overload
+        using I_Renderable::render;
+
+        /**
+         * @brief Render the widget faded by a whole-widget opacity.
+         *
+         * The view's opacity is scaled by `opacity` and by the widget's own opacity, and
+         * everything the widget blends or rasterizes is faded by the result.  Containers
+         * render their children through this overload.
+         *
+         * @note Opacity is applied per draw, so overlapping draws inside one faded widget
+         *       show through each other.
+         */
+        bool render( Session&         session,
+                     img::Frame_View& image,
+                     uint8_t          opacity );
+
+        /**
+         * Get the widget's opacity
+         */
+        uint8_t opacity() const;
+
+        /**
+         * Set the widget's opacity, from 0 (invisible) to 255 (opaque)
+         */
+        void set_opacity( uint8_t opacity );
+
         /**
          * Primarily a troubleshooting tool to draw a border around the label
          */
@@ -73,14 +133,36 @@ class WidgetBase : public I_Renderable
         virtual bool render_border( Session&         session,
                                     img::Frame_View& image );
 
+        /**
+         * @brief Called as an invalidation from this widget or one below passes through.
+         *
+         * Widgets holding rendered pixels drop them here.
+         */
+        virtual void render_invalidated() const;
+
     private:
 
+        /// Layouts set the parent pointer as widgets are added and removed
+        friend class LayoutBase;
+
+        /// Wrappers set the parent widget pointer on the widget they hold
+        friend class CachedWidget;
+
+        /// Layout holding this widget, if any
+        LayoutBase* m_parent_layout { nullptr };
+
+        /// Widget wrapping this one, if any
+        WidgetBase* m_parent_widget { nullptr };
+
         /// Flag if we want to render a border
         std::optional<math::Vector4u> m_border {};
 
         /// Log-Friendly String
         std::string m_log_tag;
 
+        /// Whole-widget opacity
+        uint8_t m_opacity { 255 };
+
 };// End of WidgetBase class
 
 } // End of tmns::gui namespace
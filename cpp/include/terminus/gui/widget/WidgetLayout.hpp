@@ -35,20 +35,33 @@ class WidgetLayout : public WidgetBase {
         using ptr_t = std::shared_ptr<WidgetLayout>;
         
         /**
-         * Destructor
+         * Destructor.  Stops the layout notifying this widget.
          */
-        ~WidgetLayout() override = default;
+        ~WidgetLayout() override;
 
         /**
          * Get the label size
          */
         math::Size2i size_pixels() const override;
 
+        /**
+         * The layout's measured size range
+         */
+        SizeHint size_hint() const override;
+
+        /**
+         * Arrange the layout at the given size
+         */
+        void arrange( math::Size2i size ) override;
+
         /**
          * Get the layout info
          */
         LayoutBase::ptr_t layout();
 
+        /// Keep the opacity overload visible next to the override below
+        using WidgetBase::render;
+
         /**
          * Render the contents of the underlying layout
          * onto the input frame.
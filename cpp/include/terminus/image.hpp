@@ -16,7 +16,13 @@
  */
 #pragma once
 
+#include <terminus/image/Composite.hpp>
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Delta_Encoder.hpp>
+#include <terminus/image/Frame_Pool.hpp>
+#include <terminus/image/Frame_Recording.hpp>
 #include <terminus/image/Frame_View.hpp>
 #include <terminus/image/Frame.hpp>
 #include <terminus/image/Pixels.hpp>
 #include <terminus/image/Primitives.hpp>
+#include <terminus/image/Raster.hpp>
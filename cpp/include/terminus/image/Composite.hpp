@@ -0,0 +1,63 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Composite.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Premultiplied-alpha compositing.
+ */
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+namespace tmns::img {
+
+/**
+ * @brief Draw a run of premultiplied RGBA pixels over another, in place ("source over").
+ *
+ * Both runs must be premultiplied.  Each channel costs one multiply-add:
+ *
+ *     dst = src + dst * ( 255 - src.alpha ) / 255
+ *
+ * Opaque source pixels are copied and fully transparent ones skipped.  The multiply uses the
+ * same exact rounding as `premultiply_alpha()`.  SIMD kernels are used where the target has
+ * them (NEON on ARM, SSE2 on x86).
+ *
+ * @param dst     First destination pixel
+ * @param src     First source pixel
+ * @param count   Number of pixels
+ * @param opacity Extra opacity applied to every source pixel, 255 for none
+ */
+void composite_row( uint8_t*       dst,
+                    const uint8_t* src,
+                    size_t         count,
+                    uint8_t        opacity = 255 );
+
+/**
+ * @brief Scale every channel of a run of premultiplied RGBA pixels by an opacity
+ */
+void scale_row( uint8_t*       dst,
+                const uint8_t* src,
+                size_t         count,
+                uint8_t        opacity );
+
+/**
+ * @brief Multiply two 8-bit fractions of 255, rounding to nearest
+ */
+inline uint8_t multiply_255( unsigned a, unsigned b )
+{
+    const unsigned t = a * b + 128u;
+    return static_cast<uint8_t>( ( t + ( t >> 8 ) ) >> 8 );
+}
+
+} // End of tmns::img namespace
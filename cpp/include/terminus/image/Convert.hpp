@@ -0,0 +1,96 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Convert.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Pixel format conversion.
+ */
+#pragma once
+
+// C++ Libraries
+#include <cstdint>
+#include <span>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+#include <terminus/image/Primitives.hpp>
+
+namespace tmns::img {
+
+/**
+ * @brief Convert a run of pixels from one format to another.
+ *
+ * Every pair of formats is supported.  Conversions to and from RGBA use SIMD kernels
+ * where the target has them (NEON on ARM, SSE2/SSSE3 on x86) with a scalar fallback
+ * for the remainder.  Other pairs go through RGBA one small chunk at a time.
+ *
+ * Color to gray uses the integer Rec.601 luma approximation.  RGB565 expands back to
+ * 8 bits by replicating the high bits, so white stays white.
+ *
+ * `src` and `dst` may point to the same buffer, which converts in place.  The buffer
+ * must be large enough for the larger of the two formats.
+ *
+ * @param src        First source pixel
+ * @param src_format Format of the source pixels
+ * @param dst        First destination pixel
+ * @param dst_format Format of the destination pixels
+ * @param count      Number of pixels
+ */
+void convert_row( const uint8_t* src,
+                  PixelFormat    src_format,
+                  uint8_t*       dst,
+                  PixelFormat    dst_format,
+                  size_t         count );
+
+/**
+ * @brief Convert a strided image one row at a time.
+ *
+ * Useful for streaming rows into a display buffer without building an intermediate frame.
+ */
+void convert( const uint8_t* src,
+              size_t         src_stride,
+              PixelFormat    src_format,
+              uint8_t*       dst,
+              size_t         dst_stride,
+              PixelFormat    dst_format,
+              size_t         cols,
+              size_t         rows );
+
+/**
+ * @brief Convert a strided image into a new, tightly packed frame.
+ *
+ * The frame's buffer comes from `Frame_Pool::instance()`.
+ *
+ * @throws std::runtime_error if `pixels` is smaller than `stride x rows`.
+ */
+Frame::ptr_t convert( std::span<const uint8_t> pixels,
+                      size_t                   cols,
+                      size_t                   rows,
+                      size_t                   stride,
+                      PixelFormat              src_format,
+                      PixelFormat              dst_format );
+
+/**
+ * @brief Multiply the color channels of RGBA pixels by their alpha, in place.
+ */
+void premultiply_alpha( uint8_t* rgba,
+                        size_t   count );
+
+/**
+ * @brief Divide the color channels of premultiplied RGBA pixels by their alpha, in place.
+ *
+ * Fully transparent pixels become transparent black.
+ */
+void unpremultiply_alpha( uint8_t* rgba,
+                          size_t   count );
+
+} // End of tmns::img namespace
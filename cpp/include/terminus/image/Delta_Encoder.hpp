@@ -0,0 +1,224 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Delta_Encoder.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Encodes a sequence of frames as compressed changes from the previous frame.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+
+namespace tmns::img {
+
+/**
+ * Kind of packet produced by the delta encoder.
+ *
+ * Values are persisted in recordings, so never renumber existing entries.
+ */
+enum class DeltaPacket : uint8_t
+{
+    KEY   = 0,
+    DELTA = 1,
+}; // End of DeltaPacket Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( DeltaPacket packet_type );
+
+/**
+ * @class Delta_Encoder
+ *
+ * Turns consecutive frames into small packets holding only what changed.
+ *
+ * Each row is compared against the previous frame.  For a row that differs, only the span
+ * between its first and last changed pixel is kept, XORed with the previous pixels so that
+ * unchanged pixels inside the span become zeros.  The spans are then compressed with
+ * `core::lz_compress`.  A UI that redraws a clock or a cursor therefore produces packets
+ * of a few dozen bytes, and an unchanged frame produces no packet at all.
+ *
+ * Packet layout (little-endian):
+ *
+ * | Offset | Size | Field                                         |
+ * |--------|------|-----------------------------------------------|
+ * | 0      | 1    | DeltaPacket type                              |
+ * | 1      | 4    | Uncompressed body size                        |
+ * | 5      | ...  | LZ-compressed body                            |
+ *
+ * A key body is `u32 cols, u32 rows, u8 channels` followed by every pixel.  A delta body is
+ * a list of `u32 row, u32 first col, u32 count` spans, each followed by `count` XORed pixels.
+ *
+ * A keyframe is sent first, whenever the frame size changes, and in place of every
+ * `keyframe_interval`-th delta so a reader can recover from a damaged stream.
+ */
+class Delta_Encoder {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<Delta_Encoder>;
+
+        /// Default number of packets between keyframes
+        static constexpr size_t DEFAULT_KEYFRAME_INTERVAL { 300 };
+
+        /// Bytes before the compressed body of a packet
+        static constexpr size_t PACKET_HEADER_BYTES { 5 };
+
+        /**
+         * Usage counters
+         */
+        struct Stats {
+
+            /// Frames passed to encode()
+            size_t frames { 0 };
+
+            /// Keyframes written
+            size_t keyframes { 0 };
+
+            /// Frames skipped because nothing changed
+            size_t unchanged { 0 };
+
+            /// Rows that differed from the previous frame
+            size_t changed_rows { 0 };
+
+            /// Uncompressed size of every frame passed in
+            size_t raw_bytes { 0 };
+
+            /// Size of every packet produced
+            size_t encoded_bytes { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         *
+         * @param keyframe_interval Packets between keyframes, 0 for only the first
+         */
+        Delta_Encoder( size_t keyframe_interval = DEFAULT_KEYFRAME_INTERVAL );
+
+        /**
+         * Encode the next frame
+         *
+         * @param frame  Frame to encode
+         * @param packet Replaced with the packet to store
+         *
+         * @returns False if the frame matches the previous one, in which case there is no packet.
+         */
+        bool encode( const Frame&          frame,
+                     std::vector<uint8_t>& packet );
+
+        /**
+         * Make the next packet a keyframe
+         */
+        void request_keyframe();
+
+        /**
+         * Get the usage counters
+         */
+        Stats stats() const;
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+    private:
+
+        /**
+         * Build a keyframe packet from the previous pixels
+         */
+        void write_keyframe( std::vector<uint8_t>& packet );
+
+        /**
+         * Compress the body into a packet
+         */
+        void finish_packet( DeltaPacket           packet_type,
+                            std::vector<uint8_t>& packet );
+
+        /// Packets between keyframes
+        size_t m_keyframe_interval;
+
+        /// Packets since the last keyframe
+        size_t m_since_keyframe { 0 };
+
+        /// Force the next packet to be a keyframe
+        bool m_need_keyframe { true };
+
+        /// Size of the previous frame
+        Dimensions m_dims;
+
+        /// Pixels of the previous frame
+        std::vector<uint8_t> m_previous;
+
+        /// Uncompressed body of the packet being built
+        std::vector<uint8_t> m_body;
+
+        /// Usage counters
+        Stats m_stats;
+
+}; // End of Delta_Encoder class
+
+/**
+ * @class Delta_Decoder
+ *
+ * Rebuilds frames from packets written by `Delta_Encoder`.
+ */
+class Delta_Decoder {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<Delta_Decoder>;
+
+        /**
+         * Apply the next packet to the frame
+         *
+         * @throws std::runtime_error if the packet is corrupt or a delta arrives before any keyframe.
+         */
+        void decode( std::span<const uint8_t> packet );
+
+        /**
+         * Get the current frame
+         */
+        const Frame& frame() const;
+
+        /**
+         * Type of the last packet decoded
+         */
+        DeltaPacket last_packet() const;
+
+    private:
+
+        /// Current frame
+        Frame m_frame;
+
+        /// Uncompressed body of the current packet
+        std::vector<uint8_t> m_body;
+
+        /// Type of the last packet decoded
+        DeltaPacket m_last_packet { DeltaPacket::KEY };
+
+        /// Set once a keyframe has been decoded
+        bool m_has_keyframe { false };
+
+}; // End of Delta_Decoder class
+
+} // End of tmns::img namespace
@@ -28,6 +28,17 @@ namespace tmns::img {
 
 /**
  * @class Frame
+ *
+ * Pixel storage is copy-on-write.  Copying a frame shares its buffer, and the first write
+ * through either copy (`set_pixel`, non-const `data()`, a `Frame_View` blit, ...) gives the writer
+ * a private buffer.  Reads never copy.  Deriving a tinted variant of a cached icon therefore
+ * costs nothing until the variant is actually modified.
+ *
+ * Sharing is tracked with the reference count of the buffer.  Frames that share a buffer may be
+ * read from several threads, but a frame must not be written while another thread copies it.
+ *
+ * No mutable references into the pixels are handed out except the pointer from `data()`,
+ * which only stays private until the frame is next copied.
  */
 struct Frame {
 
@@ -55,6 +66,33 @@ struct Frame {
         Frame( std::span<char>   pixel_data,
                const Dimensions& dims );
 
+        /**
+         * Take ownership of an existing buffer.  The buffer is resized to fit and zeroed,
+         * reusing its capacity where possible.
+         */
+        Frame( std::shared_ptr<std::vector<uint8_t>> storage,
+               const Dimensions&                     dims );
+
+        /**
+         * Copy Constructor.  Shares the pixels until either frame is written.
+         */
+        Frame( const Frame& other );
+
+        /**
+         * Assignment Operator.  Shares the pixels until either frame is written.
+         */
+        Frame& operator = ( const Frame& other );
+
+        /**
+         * Move Constructor
+         */
+        Frame( Frame&& other ) = default;
+
+        /**
+         * Move Assignment Operator
+         */
+        Frame& operator = ( Frame&& other ) = default;
+
         /**
          * Return image cols
          */
@@ -82,18 +120,69 @@ struct Frame {
 
         /**
          * Get a copy of the pixel data
+         *
+         * @note Prefer `pixels()`, which does not copy.
          */
         inline std::vector<uint8_t> image() const{
-            return m_image;
+            return std::vector<uint8_t>( data(), data() + dims().size_bytes() );
         }
 
         /**
-         * Get a reference of the pixel data
+         * Get read-only access to the pixel data without copying
          */
-        inline std::vector<uint8_t>& image_ref() {
-            return m_image;
+        inline std::span<const uint8_t> pixels() const {
+            return std::span<const uint8_t>( data(), dims().size_bytes() );
         }
 
+        /**
+         * Get read-only access to the pixel data
+         */
+        inline const uint8_t* data() const {
+            if( !m_external.empty() ){
+                return m_external.data();
+            }
+            return m_storage ? m_storage->data() : nullptr;
+        }
+
+        /**
+         * Get writable access to the pixel data
+         *
+         * @note External or shared pixels are copied into a private buffer first.
+         * @warning The pointer is invalidated by any copy or assignment of the frame, as well as
+         *          by `resize()` and `clear()`.  A copy shares the buffer, so writing through a
+         *          pointer taken before the copy would change the copy too.  Call `data()`
+         *          again after copying.
+         */
+        inline uint8_t* data() {
+            if( !m_external.empty() ){
+                copy_external();
+            }
+            else if( is_shared() ){
+                unshare();
+            }
+            return m_storage ? m_storage->data() : nullptr;
+        }
+
+        /**
+         * Check if the color channels have been multiplied by alpha
+         */
+        inline bool is_premultiplied() const { return m_premultiplied; }
+
+        /**
+         * Mark whether the color channels have been multiplied by alpha.  Does not touch the pixels.
+         */
+        inline void set_premultiplied( bool premultiplied ) { m_premultiplied = premultiplied; }
+
+        /**
+         * Check if another frame shares this frame's pixel buffer
+         */
+        inline bool is_shared() const { return m_storage && m_storage.use_count() > 1; }
+
+        /**
+         * Check if the pixel data lives outside of this frame (memory-map, flash, etc)
+         */
+        inline bool is_external() const { return !m_external.empty(); }
+
         /**
          * Set to an empty image.
          */
@@ -104,12 +193,6 @@ struct Frame {
          */
         void resize( Dimensions new_dims, uint8_t pixel );
 
-        /**
-         * Get a specific pixel
-         *
-         */
-        uint8_t& get_pixel( size_t col, size_t row, size_t channel );
-
         /**
          * Get a specific pixel
          *
@@ -139,18 +222,65 @@ struct Frame {
          */
         void set_all_pixels( math::Vector4u value );
 
+        /**
+         * Move every row up by `delta` rows, or down if negative, with one memory move.
+         *
+         * The rows uncovered at the other edge keep their old pixels, ready to be redrawn.
+         */
+        void scroll_rows( int delta );
+
         /**
          * Print information about frame data
          */
         std::string to_log_string( size_t offset = 0 ) const;
 
+        /**
+         * @brief Wrap read-only pixels owned by someone else without copying them.
+         *
+         * The frame reads straight from the span.  The first write copies the pixels
+         * into owned storage, so the external memory is never modified.
+         *
+         * @param pixels Tightly packed pixel rows.  Must hold at least dims.size_bytes().
+         * @param dims   Image dimensions
+         * @param owner  Keeps the memory behind the span alive.  May be null for static data.
+         */
+        static Frame::ptr_t from_external( std::span<const uint8_t> pixels,
+                                           const Dimensions&        dims,
+                                           std::shared_ptr<const void> owner );
+
     private:
 
-        /// @brief  Pixel Data
-        std::vector<uint8_t> m_image;
+        /**
+         * Byte offset of the first channel of a pixel
+         */
+        inline size_t offset( size_t col, size_t row ) const {
+            return ( row * m_dims.cols() + col ) * m_dims.channels();
+        }
+
+        /**
+         * Copy external pixels into owned storage and release the external reference
+         */
+        void copy_external();
+
+        /**
+         * Replace a shared buffer with a private copy
+         */
+        void unshare();
+
+        /// @brief  Pixel Data.  Shared between copies until one of them writes.
+        std::shared_ptr<std::vector<uint8_t>> m_storage;
+
+        /// @brief Read-only pixels not owned by this frame
+        std::span<const uint8_t> m_external;
+
+        /// @brief Keeps the external pixels alive
+        std::shared_ptr<const void> m_external_owner;
 
         // Image Dimensions
         Dimensions m_dims {};
+
+        /// @brief Color channels are premultiplied by alpha
+        bool m_premultiplied { false };
     
 };// End of Frame class
 
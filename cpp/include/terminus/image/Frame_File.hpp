@@ -0,0 +1,154 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_File.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Native Terminus Frame (.tfrm) asset format.
+ */
+#pragma once
+
+// C++ Libraries
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+#include <terminus/image/Primitives.hpp>
+
+namespace tmns::img {
+
+/**
+ * Compression applied to the pixel payload of a frame file.
+ *
+ * Values are persisted in asset files, so never renumber existing entries.
+ */
+enum class FrameCompression : uint8_t
+{
+    NONE = 0,
+    RLE  = 1,
+}; // End of FrameCompression Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( FrameCompression compression );
+
+/**
+ * @brief On-disk header for a `.tfrm` file.
+ *
+ * All fields are little-endian.  The pixel payload starts at `data_offset`, which is
+ * 16-byte aligned.  Rows are packed with no padding (`stride` is `cols` times the pixel
+ * size), which is what lets an uncompressed payload be used straight out of a memory-map
+ * as a frame.  Readers still honor a larger stride, at the cost of a copy.
+ *
+ * | Offset | Size | Field        |
+ * |--------|------|--------------|
+ * | 0      | 4    | magic "TFRM" |
+ * | 4      | 2    | version      |
+ * | 6      | 1    | format       |
+ * | 7      | 1    | compression  |
+ * | 8      | 4    | cols         |
+ * | 12     | 4    | rows         |
+ * | 16     | 4    | stride       |
+ * | 20     | 4    | payload size |
+ * | 24     | 4    | data offset  |
+ * | 28     | 4    | flags        |
+ *
+ * Files written before flags existed have zero there, so new flags must default to off.
+ */
+struct Frame_File_Header
+{
+    /// File identifier
+    static constexpr std::array<char,4> MAGIC { 'T', 'F', 'R', 'M' };
+
+    /// Current file version
+    static constexpr uint16_t VERSION { 1 };
+
+    /// Size of the serialized header in bytes
+    static constexpr size_t SIZE_BYTES { 32 };
+
+    /// Alignment of the pixel payload
+    static constexpr size_t DATA_ALIGNMENT { 16 };
+
+    /// Flag: color channels are premultiplied by alpha
+    static constexpr uint32_t FLAG_PREMULTIPLIED { 0x1 };
+
+    uint16_t         version     { VERSION };
+    PixelFormat      format      { PixelFormat::RGBA };
+    FrameCompression compression { FrameCompression::NONE };
+    uint32_t         cols        { 0 };
+    uint32_t         rows        { 0 };
+    uint32_t         stride      { 0 };
+    uint32_t         payload_size { 0 };
+    uint32_t         data_offset { 0 };
+    uint32_t         flags       { 0 };
+
+    /**
+     * Parse and validate a header from the front of a buffer
+     *
+     * @throws std::runtime_error if the buffer is not a valid frame file.
+     */
+    static Frame_File_Header parse( std::span<const uint8_t> buffer );
+
+    /**
+     * Serialize the header into SIZE_BYTES bytes
+     */
+    std::vector<uint8_t> serialize() const;
+
+    /**
+     * Print log-friendly string
+     */
+    std::string to_log_string( size_t offset = 0 ) const;
+
+}; // End of Frame_File_Header struct
+
+/**
+ * @brief Build a frame from an in-memory `.tfrm` buffer.
+ *
+ * Uncompressed, tightly packed files reference the buffer directly, with `owner`
+ * keeping it alive.  Anything else is decoded into an owned frame.  Frames only carry a
+ * channel count, so BGR and RGB565 files load as RGB and BGRA files as RGBA.
+ *
+ * @throws std::runtime_error if the buffer is malformed.
+ */
+Frame::ptr_t frame_from_buffer( std::span<const uint8_t>    buffer,
+                                std::shared_ptr<const void> owner );
+
+/**
+ * @brief Memory-map a `.tfrm` file into a frame.
+ *
+ * @throws std::runtime_error if the file cannot be mapped or is malformed, or if this build
+ *         cannot memory-map files.  Such builds load frames with frame_from_buffer().
+ */
+Frame::ptr_t read_frame_file( const std::filesystem::path& pathname );
+
+/**
+ * @brief Encode a frame into a `.tfrm` buffer.
+ */
+std::vector<uint8_t> encode_frame_file( const Frame&     frame,
+                                        FrameCompression compression );
+
+/**
+ * @brief Write a frame to disk as a `.tfrm` file.
+ *
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void write_frame_file( const Frame&                 frame,
+                       const std::filesystem::path& pathname,
+                       FrameCompression             compression );
+
+} // End of tmns::img namespace
@@ -0,0 +1,175 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_Pool.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Recycles frame pixel buffers.
+ */
+#pragma once
+
+// C++ Libraries
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+
+namespace tmns::img {
+
+/**
+ * @class Frame_Pool
+ *
+ * Hands out frames whose pixel buffers go back into the pool when the last
+ * reference to the buffer is dropped, instead of back to the heap.  Since frame copies
+ * share their buffer, that is when the last copy is destroyed or written to.
+ *
+ * Buffers are binned into size classes, four per octave, so a buffer is reused by any image
+ * that fits in it and is never more than a quarter larger than the request it serves.  Text
+ * labels and decoded images that are rebuilt every update therefore stop allocating once the
+ * pool has warmed up, and the heap does not fragment into odd sizes.  Buffers larger than the
+ * biggest class are not pooled.  The cache is capped by the capacity of the buffers it holds,
+ * anything returned past the cap is freed.
+ *
+ * Frames may outlive their pool, their buffers are simply freed.  Safe to use from multiple threads.
+ */
+class Frame_Pool {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::shared_ptr<Frame_Pool>;
+
+        /// Smallest size class (bytes)
+        static constexpr size_t MIN_CLASS_BYTES { 256 };
+
+        /// Size classes between each power of two
+        static constexpr size_t CLASSES_PER_OCTAVE { 4 };
+
+        /// Number of size classes.  The largest is 256 B << 18 = 64 MB.
+        static constexpr size_t NUM_CLASSES { 18 * CLASSES_PER_OCTAVE + 1 };
+
+        /// Default cap on cached bytes
+        static constexpr size_t DEFAULT_MAX_CACHED_BYTES { 8 * 1024 * 1024 };
+
+        /**
+         * Usage counters
+         */
+        struct Stats {
+
+            /// Requests served from the cache
+            size_t hits { 0 };
+
+            /// Requests that had to allocate
+            size_t misses { 0 };
+
+            /// Buffers freed because the cache was full
+            size_t evictions { 0 };
+
+            /// Capacity of the buffers currently cached
+            size_t cached_bytes { 0 };
+
+        }; // End of Stats struct
+
+        /**
+         * Constructor
+         *
+         * @param max_cached_bytes Most bytes to hold in the cache
+         */
+        Frame_Pool( size_t max_cached_bytes = DEFAULT_MAX_CACHED_BYTES );
+
+        /**
+         * Get a zeroed frame
+         */
+        Frame::ptr_t acquire( const Dimensions& dims );
+
+        /**
+         * Get an empty pixel buffer with room for at least `bytes`
+         */
+        std::shared_ptr<std::vector<uint8_t>> acquire_storage( size_t bytes );
+
+        /**
+         * Change the cap on cached bytes.  Evicts buffers if the cache is now over the cap.
+         */
+        void set_max_cached_bytes( size_t max_cached_bytes );
+
+        /**
+         * Free every cached buffer
+         */
+        void trim();
+
+        /**
+         * Get the usage counters
+         */
+        Stats stats() const;
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Get the shared pool used by drivers and image decoders
+         */
+        static Frame_Pool& instance();
+
+        /**
+         * Size class for a number of bytes
+         *
+         * @returns NUM_CLASSES if the buffer is too large to pool.
+         */
+        static size_t size_class( size_t bytes );
+
+        /**
+         * Bytes held by buffers of a size class
+         */
+        static size_t class_bytes( size_t index );
+
+    private:
+
+        /**
+         * Cache state.  Shared with the buffer deleters so frames can outlive the pool.
+         */
+        struct State {
+
+            /// Protects everything below
+            std::mutex mutex;
+
+            /// Free buffers for each size class
+            std::array<std::vector<std::vector<uint8_t>>,NUM_CLASSES> free_lists;
+
+            /// Most bytes to cache
+            size_t max_cached_bytes { 0 };
+
+            /// Usage counters
+            Stats stats;
+
+            /**
+             * Take a buffer back.  Requires the mutex.
+             */
+            void recycle( std::vector<uint8_t>&& buffer );
+
+            /**
+             * Free buffers, largest first, until the cache fits the cap.  Requires the mutex.
+             */
+            void evict();
+
+        }; // End of State struct
+
+        /// Cache state
+        std::shared_ptr<State> m_state;
+
+}; // End of Frame_Pool class
+
+} // End of tmns::img namespace
@@ -0,0 +1,193 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_Recording.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Streaming recording (.trec) of displayed frames.
+ */
+#pragma once
+
+// C++ Standard Libraries
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Delta_Encoder.hpp>
+
+namespace tmns::img {
+
+/**
+ * @brief Layout of a `.trec` recording.
+ *
+ * An 8-byte header ("TREC", u16 version, u16 reserved) followed by records of
+ * `u64 timestamp (us), u32 packet size, packet`, all little-endian.  Packets come from
+ * `Delta_Encoder`.  Records are only ever appended, so a recording cut short by a crash
+ * or power loss is still readable up to its last complete record.
+ */
+struct Frame_Recording
+{
+    /// File identifier
+    static constexpr std::array<char,4> MAGIC { 'T', 'R', 'E', 'C' };
+
+    /// Current file version
+    static constexpr uint16_t VERSION { 1 };
+
+    /// Size of the file header in bytes
+    static constexpr size_t HEADER_BYTES { 8 };
+
+    /// Size of each record header in bytes
+    static constexpr size_t RECORD_HEADER_BYTES { 12 };
+
+}; // End of Frame_Recording struct
+
+/**
+ * @class Recording_Writer
+ *
+ * Appends displayed frames to a recording.  Frames identical to the previous one cost a
+ * row comparison and write nothing.  The stream is flushed after every keyframe.
+ */
+class Recording_Writer {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Recording_Writer>;
+
+        /**
+         * Add a frame to the recording
+         *
+         * @param timestamp Time since the recording started
+         */
+        void write( const Frame&              frame,
+                    std::chrono::microseconds timestamp );
+
+        /**
+         * Write anything buffered to disk
+         */
+        void flush();
+
+        /**
+         * Get the encoder, for its counters
+         */
+        const Delta_Encoder& encoder() const;
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+        /**
+         * Create a new recording, replacing any file at the path
+         *
+         * @throws std::runtime_error if the file cannot be opened.
+         */
+        static ptr_t create( const std::filesystem::path& pathname,
+                             size_t                       keyframe_interval = Delta_Encoder::DEFAULT_KEYFRAME_INTERVAL );
+
+    private:
+
+        /**
+         * Constructor
+         */
+        Recording_Writer( const std::filesystem::path& pathname,
+                          size_t                       keyframe_interval );
+
+        /// Output path
+        std::filesystem::path m_pathname;
+
+        /// Output stream
+        std::ofstream m_fout;
+
+        /// Frame encoder
+        Delta_Encoder m_encoder;
+
+        /// Packet being written, reused between frames
+        std::vector<uint8_t> m_packet;
+
+}; // End of Recording_Writer class
+
+/**
+ * @class Recording_Reader
+ *
+ * Plays back a recording, one record at a time.  The file is memory-mapped.
+ */
+class Recording_Reader {
+
+    public:
+
+        /// Pointer Type
+        using ptr_t = std::unique_ptr<Recording_Reader>;
+
+        /**
+         * Decode the next record
+         *
+         * @returns False at the end of the recording, or at a trailing partial record.
+         * @throws std::runtime_error if a complete record is corrupt.
+         */
+        bool next();
+
+        /**
+         * Get the current frame
+         */
+        const Frame& frame() const;
+
+        /**
+         * Get the time of the current frame since the recording started
+         */
+        std::chrono::microseconds timestamp() const;
+
+        /**
+         * Get the decoder, for the type of the last packet
+         */
+        const Delta_Decoder& decoder() const;
+
+        /**
+         * Open a recording
+         *
+         * @throws std::runtime_error if the file is missing or not a recording, or if this
+         *         build cannot memory-map files.
+         */
+        static ptr_t open( const std::filesystem::path& pathname );
+
+    private:
+
+        /**
+         * Constructor
+         */
+        Recording_Reader( std::span<const uint8_t>    buffer,
+                          std::shared_ptr<const void> owner );
+
+        /// Recording bytes
+        std::span<const uint8_t> m_buffer;
+
+        /// Keeps the mapping alive
+        std::shared_ptr<const void> m_owner;
+
+        /// Offset of the next record
+        size_t m_position { Frame_Recording::HEADER_BYTES };
+
+        /// Time of the current frame
+        std::chrono::microseconds m_timestamp { 0 };
+
+        /// Frame decoder
+        Delta_Decoder m_decoder;
+
+}; // End of Recording_Reader class
+
+} // End of tmns::img namespace
@@ -16,6 +16,9 @@
  */
 #pragma once
 
+// C++ Libraries
+#include <vector>
+
 // Project Libraries
 #include <terminus/image/Frame.hpp>
 #include <terminus/image/Primitives.hpp>
@@ -25,6 +28,16 @@ namespace tmns::img {
 
 /**
  * @class Frame_View
+ *
+ * A window onto part of a frame.  Pixel coordinates are relative to the view's bounding box.
+ *
+ * Every view also carries a clip rectangle: the part of its bounding box that lies inside
+ * both its frame and the clip of the view it was cut from.  Writes outside the clip are
+ * dropped, so a widget larger than its allocated box cannot draw over its neighbors.  The
+ * clip can be narrowed further with `push_clip()` and restored with `pop_clip()`.
+ *
+ * Views also carry an opacity, inherited by their subviews, which fades everything
+ * composited or rasterized into them.  Plain copies ignore it.
  */
 struct Frame_View {
 
@@ -65,28 +78,76 @@ struct Frame_View {
         inline math::Rect2i bbox() const { return m_bbox; }
 
         /**
-         * Get a specific pixel value
+         * Return the clip rectangle in this view's coordinates
+         */
+        math::Rect2i clip() const;
+
+        /**
+         * Check if a pixel lies inside the clip rectangle
+         */
+        inline bool is_visible( int col, int row ) const {
+            const int x = col + m_bbox.bl().x();
+            const int y = row + m_bbox.bl().y();
+            return x >= m_clip.bl().x() && x < m_clip.bl().x() + m_clip.width() &&
+                   y >= m_clip.bl().y() && y < m_clip.bl().y() + m_clip.height();
+        }
+
+        /**
+         * Narrow the clip rectangle until the matching `pop_clip()`
+         *
+         * @param rect Region in this view's coordinates.  The new clip is its intersection with the current clip.
+         */
+        void push_clip( const math::Rect2i& rect );
+
+        /**
+         * Restore the clip rectangle from before the last `push_clip()`
+         *
+         * @throws std::runtime_error if the clip stack is empty.
+         */
+        void pop_clip();
+
+        /**
+         * Return the opacity applied when compositing into this view
+         */
+        inline uint8_t opacity() const { return m_opacity; }
+
+        /**
+         * Set the opacity applied when compositing into this view.  Subviews inherit it.
+         */
+        inline void set_opacity( uint8_t opacity ) { m_opacity = opacity; }
+
+        /**
+         * Return the frame this view references
          */
-        uint8_t& get_pixel( size_t col, size_t row, size_t channel );
+        inline Frame& frame() { return m_frame; }
+
+        /**
+         * Return the frame this view references
+         */
+        inline const Frame& frame() const { return m_frame; }
 
         /**
          * Get a specific pixel value
+         *
+         * @throws std::runtime_error if the pixel is outside the clip rectangle.
          */
         uint8_t get_pixel( size_t col, size_t row, size_t channel ) const;
 
         /**
          * Get a specific pixel value
+         *
+         * @throws std::runtime_error if the pixel is outside the clip rectangle.
          */
         math::Vector4u get_pixel( size_t col, size_t row ) const;
 
         /**
-         * Set a specific pixel
+         * Set a specific pixel.  Pixels outside the clip rectangle are ignored.
          *
          */
         void set_pixel( size_t col, size_t row, size_t channel, uint8_t value );
 
         /**
-         * Set a specific pixel
+         * Set a specific pixel.  Pixels outside the clip rectangle are ignored.
          *
          */
         void set_pixel( size_t col, size_t row, math::Vector4u value );
@@ -95,11 +156,17 @@ struct Frame_View {
          * @brief Return another view of the frame, given a smaller window.
          * @note  Window input is in this view's perspective, but the resulting
          *        view will be kept in the perspective of the original frame.
+         *        The new view is clipped to the intersection of this view's clip
+         *        and the window, so it can extend past its parent without drawing
+         *        outside of it.
          */
         Frame_View subview( const math::Rect2i& bbox );
 
         /**
          * Copy the input frame into this view.  
+         *
+         * The overlap with the clip rectangle is computed once, then copied a row at a time.
+         *
          * @param frame Input image to copy
          * @param copy_policy  Rules for copying imagery.
          */
@@ -108,6 +175,13 @@ struct Frame_View {
         
         /**
          * Copy the input frame into this view.  
+         *
+         * Frames with fewer than 4 channels are expanded to RGBA as they are copied.
+         *
+         * `CopyPolicy::BLEND` composites the frame over this view with premultiplied alpha,
+         * faded by the view's opacity.  Frames that are not premultiplied are converted a row
+         * at a time as they are drawn, so cached assets should be premultiplied up front.
+         *
          * @param frame Input image to copy
          * @param copy_policy  Rules for copying imagery.
          */
@@ -122,11 +196,38 @@ struct Frame_View {
 
     private:
 
+        /**
+         * Copy rows of pixels into the clipped part of this view
+         *
+         * @param pixels First pixel of the source, at view position `dest_bl`
+         * @param stride Bytes between source rows
+         * @param format Source pixel format
+         * @param size   Source size in pixels
+         * @param policy        Overwrite or composite
+         * @param premultiplied Source color is already premultiplied by alpha
+         */
+        void copy_rows( const uint8_t*       pixels,
+                        size_t               stride,
+                        PixelFormat          format,
+                        const math::Point2i& dest_bl,
+                        const math::Size2i&  size,
+                        CopyPolicy           policy,
+                        bool                 premultiplied );
+
         /// Internal Frame Handle
         Frame& m_frame;
 
         /// Bounding box (Original frame's view)
         math::Rect2i m_bbox;
+
+        /// Writable region (Original frame's view)
+        math::Rect2i m_clip;
+
+        /// Clip rectangles saved by push_clip()
+        std::vector<math::Rect2i> m_clip_stack;
+
+        /// Opacity applied when compositing
+        uint8_t m_opacity { 255 };
     
 };// End of Frame_View class
 
@@ -17,7 +17,9 @@
 #pragma once
 
 // C++ Libraries
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 // Terminus Libraries
@@ -32,6 +34,7 @@ namespace tmns::img {
 enum class CopyPolicy : uint8_t 
 {
     FLEXIBILE = 0,
+    BLEND     = 1, ///< Composite premultiplied alpha over the destination
 }; // End of CopyPolicy Enumeration
 
 /**
@@ -39,6 +42,39 @@ enum class CopyPolicy : uint8_t
  */
 std::string to_string( CopyPolicy policy );
 
+/**
+ * Memory layout of a single pixel.
+ *
+ * Values are persisted in asset files, so never renumber existing entries.
+ */
+enum class PixelFormat : uint8_t
+{
+    GRAY       = 1,
+    GRAY_ALPHA = 2,
+    RGB        = 3,
+    RGBA       = 4,
+    BGR        = 5,
+    BGRA       = 6,
+    RGB565     = 7,
+}; // End of PixelFormat Enumeration
+
+/**
+ * Convert to string
+ */
+std::string to_string( PixelFormat format );
+
+/**
+ * Number of bytes used to store a single pixel of the given format.
+ */
+size_t bytes_per_pixel( PixelFormat format );
+
+/**
+ * Get the default pixel format for an interleaved 8-bit image with the given channel count.
+ *
+ * @throws std::runtime_error if no format matches.
+ */
+PixelFormat pixel_format_from_channels( size_t channels );
+
 /**
  * @brief Represents Image Characteristics
  */
@@ -0,0 +1,327 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Raster.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details 2D rasterization primitives.
+ */
+#pragma once
+
+// C++ Libraries
+#include <array>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Frame_View.hpp>
+#include <terminus/math/Point.hpp>
+#include <terminus/math/Vector.hpp>
+
+namespace tmns::img {
+
+/**
+ * How thick polylines are joined at interior vertices.
+ *
+ * MITER extends the outer edges until they meet, falling back to BEVEL on sharp turns.
+ */
+enum class LineJoin : uint8_t
+{
+    MITER = 1,
+    ROUND = 2,
+    BEVEL = 3,
+}; // End of LineJoin Enumeration
+
+/**
+ * Convert LineJoin to string
+ */
+std::string to_string( LineJoin join );
+
+/**
+ * @class Raster
+ *
+ * Draws lines, curves and filled shapes into a `Frame_View`.
+ *
+ * Coordinates are relative to the view, with pixel centers on integer coordinates.  Every
+ * primitive is clipped against the view's clip rectangle (taken when the raster is created)
+ * before any pixels are touched, and the inner loops write whole horizontal spans where they can.
+ * Colors are straight RGBA; anything with alpha below 255 (or partial antialiased coverage)
+ * is blended over the existing pixels, which are treated as premultiplied.  The view's
+ * opacity fades every color.  Shapes are filled in a single pass, so overlapping
+ * parts of a polyline or stroke are never blended twice.
+ *
+ * The frame must have 4 channels.
+ */
+class Raster {
+
+    public:
+
+        /// Color type
+        using Color = math::Vector4u;
+
+        /// Miter joins longer than this multiple of the half-width become bevels
+        static constexpr double MITER_LIMIT { 4.0 };
+
+        /**
+         * Constructor
+         *
+         * @throws std::runtime_error if the frame does not have 4 channels.
+         */
+        Raster( Frame_View view );
+
+        /**
+         * Draw directly into a whole frame
+         */
+        Raster( Frame& frame );
+
+        /**
+         * Return the drawable area in view coordinates
+         */
+        math::Rect2i clip_box() const;
+
+        /**
+         * Fill the entire drawable area
+         */
+        void fill( const Color& color );
+
+        /**
+         * Fill a rectangle
+         */
+        void fill_rect( const math::Rect2i& rect,
+                        const Color&        color );
+
+        /**
+         * Draw a horizontal line from x0 to x1 inclusive
+         */
+        void draw_hline( int          x0,
+                         int          x1,
+                         int          y,
+                         const Color& color );
+
+        /**
+         * Draw a vertical line from y0 to y1 inclusive
+         */
+        void draw_vline( int          x,
+                         int          y0,
+                         int          y1,
+                         const Color& color );
+
+        /**
+         * Draw a single pixel wide line using Bresenham's algorithm
+         */
+        void draw_line( const math::Point2i& p0,
+                        const math::Point2i& p1,
+                        const Color&         color );
+
+        /**
+         * Draw an antialiased line using Wu's algorithm
+         */
+        void draw_line_aa( const math::Point2d& p0,
+                           const math::Point2d& p1,
+                           const Color&         color );
+
+        /**
+         * Draw a line of any width with flat ends
+         */
+        void draw_thick_line( const math::Point2d& p0,
+                              const math::Point2d& p1,
+                              double               width,
+                              const Color&         color );
+
+        /**
+         * Draw connected line segments
+         *
+         * Widths of 1 or less draw single pixel Bresenham segments.  Wider lines are
+         * filled as one shape, with joins at each interior vertex.
+         *
+         * @param points Vertices of the line
+         * @param width  Line width in pixels
+         * @param color  Line color
+         * @param join   Join style for wide lines
+         * @param closed Connect the last point back to the first
+         */
+        void draw_polyline( const std::vector<math::Point2d>& points,
+                            double                            width,
+                            const Color&                      color,
+                            LineJoin                          join   = LineJoin::MITER,
+                            bool                              closed = false );
+
+        /**
+         * Draw the outline of a circle using the midpoint algorithm
+         */
+        void draw_circle( const math::Point2i& center,
+                          int                  radius,
+                          const Color&         color );
+
+        /**
+         * Fill a circle
+         */
+        void fill_circle( const math::Point2i& center,
+                          int                  radius,
+                          const Color&         color );
+
+        /**
+         * Draw the outline of an axis-aligned ellipse using the midpoint algorithm
+         */
+        void draw_ellipse( const math::Point2i& center,
+                           int                  radius_x,
+                           int                  radius_y,
+                           const Color&         color );
+
+        /**
+         * Fill an axis-aligned ellipse
+         */
+        void fill_ellipse( const math::Point2i& center,
+                           int                  radius_x,
+                           int                  radius_y,
+                           const Color&         color );
+
+        /**
+         * Fill a polygon using the even-odd rule.  Self-intersecting polygons are allowed.
+         */
+        void fill_polygon( const std::vector<math::Point2d>& points,
+                           const Color&                      color );
+
+        /**
+         * Print information to log-friendly string
+         */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+    private:
+
+        /// Color unpacked once per primitive, so inner loops avoid the virtual accessors
+        using Pixel = std::array<uint8_t,4>;
+
+        /// Polygon vertex
+        struct Vertex {
+            double x;
+            double y;
+        }; // End of Vertex struct
+
+        /// Polygon edge for the scanline filler
+        struct Edge {
+            double y_top;
+            double y_bottom;
+            double x_top;
+            double slope;
+            int    winding;
+        }; // End of Edge struct
+
+        /// Fill rule for the scanline filler
+        enum class FillRule : uint8_t
+        {
+            EVEN_ODD = 1,
+            NON_ZERO = 2,
+        }; // End of FillRule Enumeration
+
+        /**
+         * Unpack a color, applying the view opacity
+         */
+        Pixel unpack( const Color& color ) const;
+
+        /**
+         * Get a pointer to a pixel in view coordinates.  No bounds checking is performed.
+         */
+        uint8_t* pixel_ptr( int x, int y );
+
+        /**
+         * Blend a span [x0,x1) on row y.  Clips to the drawable area.
+         */
+        void blend_span( int          x0,
+                         int          x1,
+                         int          y,
+                         const Pixel& color );
+
+        /**
+         * Blend one pixel with partial coverage.  Clips to the drawable area.
+         */
+        void blend_pixel( int          x,
+                          int          y,
+                          const Pixel& color,
+                          uint8_t      coverage = 255 );
+
+        /**
+         * Plot a point and its mirror images about a center, skipping duplicates
+         */
+        void plot_symmetric( int          cx,
+                             int          cy,
+                             int          dx,
+                             int          dy,
+                             const Pixel& color );
+
+        /**
+         * Run Bresenham's algorithm on a clipped segment
+         *
+         * @param skip_first Leave out the first pixel, so polylines do not blend shared vertices twice.
+         * @param skip_last  Leave out the last pixel, for the segment closing a polyline.
+         */
+        void bresenham( const math::Point2i& p0,
+                        const math::Point2i& p1,
+                        const Pixel&         color,
+                        bool                 skip_first,
+                        bool                 skip_last );
+
+        /**
+         * Append the edges of a closed polygon
+         *
+         * @param orient Reverse the points if needed so every sub-shape winds the same way.
+         */
+        static void add_edges( std::vector<Edge>&         edges,
+                               const std::vector<Vertex>& points,
+                               bool                       orient );
+
+        /**
+         * Fill a set of edges in one scanline pass
+         */
+        void fill_edges( std::vector<Edge>& edges,
+                         const Pixel&       color,
+                         FillRule           rule );
+
+        /**
+         * Fill one span per row, symmetric about a center
+         *
+         * @param half_widths Half-width of the span for each row offset from the center
+         */
+        void fill_rows( int                     cx,
+                        int                     cy,
+                        const std::vector<int>& half_widths,
+                        const Pixel&            color );
+
+        /**
+         * Clip a segment to the drawable area expanded by a margin
+         *
+         * @returns False if nothing is left.
+         */
+        bool clip_segment( double& x0,
+                           double& y0,
+                           double& x1,
+                           double& y1,
+                           double  margin ) const;
+
+        /// View being drawn into
+        Frame_View m_view;
+
+        /// Offset of the view inside its frame
+        int m_offset_x { 0 };
+        int m_offset_y { 0 };
+
+        /// Drawable area in view coordinates [min, max)
+        int m_clip_x0 { 0 };
+        int m_clip_y0 { 0 };
+        int m_clip_x1 { 0 };
+        int m_clip_y1 { 0 };
+
+        /// Opacity taken from the view
+        uint8_t m_opacity { 255 };
+
+}; // End of Raster class
+
+} // End of tmns::img namespace
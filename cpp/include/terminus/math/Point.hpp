@@ -233,7 +233,7 @@ class Point_ : public Vector_<ValueT,Dims>
                     result[i] = std::min( point1[i],
                                           static_cast<typename Point1::value_type>( point2[i] ) );
                 }
-                return std::move( result );
+                return result;
             }
             else
             {
@@ -261,7 +261,7 @@ class Point_ : public Vector_<ValueT,Dims>
                     result[i] = std::max( point1[i],
                                           static_cast<typename Point1::value_type>( point2[i] ) );
                 }
-                return std::move( result );
+                return result;
             }
             else
             {
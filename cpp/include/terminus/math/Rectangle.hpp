@@ -19,7 +19,10 @@
 #include "Size.hpp"
 
 // C++ Libraries
+#include <algorithm>
 #include <cmath>
+#include <tuple>
+#include <vector>
 
 namespace tmns::math {
 
@@ -471,10 +474,17 @@ class Rectangle
         static Rectangle<ValueT1,Dims> intersection( const Rectangle<ValueT1,RDims>& rect1,
                                                      const Rectangle<ValueT2,RDims>& rect2 )
         {
-            return Rectangle<ValueT1,RDims>( Point_<ValueT1,RDims>::elementwise_max( rect1.min(),
-                                                                                     rect2.min() ),
-                                             Point_<ValueT1,RDims>::elementwise_min( rect1.max(),
-                                                                                     rect2.max() ) );
+            auto min_point = Point_<ValueT1,RDims>::elementwise_max( rect1.min(),
+                                                                     rect2.min() );
+            auto max_point = Point_<ValueT1,RDims>::elementwise_min( rect1.max(),
+                                                                     rect2.max() );
+
+            // Collapse disjoint axes, otherwise the corner constructor would swap them
+            for( size_t i = 0; i < RDims; i++ )
+            {
+                max_point[i] = std::max( max_point[i], min_point[i] );
+            }
+            return Rectangle<ValueT1,RDims>( min_point, max_point );
         }
 
         /**
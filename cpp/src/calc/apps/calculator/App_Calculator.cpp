@@ -24,8 +24,15 @@ namespace tmns::calc::app {
 /****************************************************/
 /*          Load the application menu icon          */
 /****************************************************/
-img::Frame::ptr_t App_Calculator::menu_icon() {
-    return nullptr;
+gui::Label::ptr_t App_Calculator::menu_icon() {
+    return find_menu_icon( "calculator" );
+}
+
+/************************************/
+/*          Get the Menu Name       */
+/************************************/
+std::string App_Calculator::menu_name() const {
+    return "Calculator";
 }
 
 /****************************************************/
@@ -21,10 +21,18 @@ namespace tmns::calc::app {
 /************************************/
 /*          Get the Menu Icon       */
 /************************************/
-img::Frame::ptr_t App_Editor::menu_icon() {
+gui::Label::ptr_t App_Editor::menu_icon() {
+    // No artwork yet.  The launcher draws a placeholder.
     return nullptr;
 }
 
+/************************************/
+/*          Get the Menu Name       */
+/************************************/
+std::string App_Editor::menu_name() const {
+    return "Editor";
+}
+
 /****************************************************/
 /*          Create the calculator instance          */
 /****************************************************/
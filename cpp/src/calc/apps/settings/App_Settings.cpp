@@ -21,8 +21,15 @@ namespace tmns::calc::app {
 /************************************/
 /*          Get the Menu Icon       */
 /************************************/
-img::Frame::ptr_t App_Settings::menu_icon() {
-    return nullptr;
+gui::Label::ptr_t App_Settings::menu_icon() {
+    return find_menu_icon( "settings" );
+}
+
+/************************************/
+/*          Get the Menu Name       */
+/************************************/
+std::string App_Settings::menu_name() const {
+    return "Settings";
 }
 
 /****************************************************/
@@ -28,20 +28,16 @@ namespace tmns::calc::page {
 /*          Create Footer Widget          */
 /******************************************/
 Footer_Widget::ptr_t Footer_Widget::create( const core::Options& config,
-                                            gui::Session&        session,
-                                            math::Size2i         parent_size )
+                                            gui::Session&        session )
 {
-    // Construct the layout.
-    int footer_width  = parent_size.width();
-    int footer_height = std::min( parent_size.height(),
-                                  config.check_and_get_setting<int>("display","footer_height") );
+    // Construct the layout.  The footer keeps its configured height and spans whatever
+    // width the window gives it.
+    int footer_height = config.check_and_get_setting<int>("display","footer_height");
 
-    LOG_TRACE( "Setting Footer Size: " + std::to_string(footer_width) + " x " + std::to_string(footer_height) );
-    LOG_TRACE( "Parent Size: " + parent_size.to_string() );
+    LOG_TRACE( "Setting Footer Height: " + std::to_string(footer_height) );
     auto layout = std::make_shared<gui::LayoutHorizontal>();
-    layout->set_layout_size( math::Size2i( { footer_width,
-                                             footer_height } ) );
-
+    layout->set_layout_size( math::Size2i( { 0, footer_height } ) );
+    layout->set_horizontal_stretch_policy( gui::StretchPolicy::GROW );
 
     // Commands for the footer will be provided by the context manager
     std::string commands = "some-text to be solved later.";
@@ -32,19 +32,16 @@ namespace tmns::calc::page {
 /*          Create Header Widget          */
 /******************************************/
 Header_Widget::ptr_t Header_Widget::create( const core::Options& config,
-                                            gui::Session&        session,
-                                            math::Size2i         parent_size )
+                                            gui::Session&        session )
 {
-    // Construct the layout.
-    int header_width  = parent_size.width();
-    int header_height = std::min( config.check_and_get_setting<int>("display","header_height"),
-                                  parent_size.height() );
+    // Construct the layout.  The header keeps its configured height and spans whatever
+    // width the window gives it.
+    int header_height = config.check_and_get_setting<int>("display","header_height");
 
-    LOG_TRACE( "Setting Header Size: " + std::to_string(header_width) + " x " + std::to_string(header_height) );
-    LOG_TRACE( "Parent Size: " + parent_size.to_string() );
+    LOG_TRACE( "Setting Header Height: " + std::to_string(header_height) );
     auto layout = std::make_shared<gui::LayoutHorizontal>();
-    layout->set_layout_size( math::Size2i( { header_width,
-                                             header_height } ) );
+    layout->set_layout_size( math::Size2i( { 0, header_height } ) );
+    layout->set_horizontal_stretch_policy( gui::StretchPolicy::GROW );
 
     ///////////////////////////////////
     // Create the title label
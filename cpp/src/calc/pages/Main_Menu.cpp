@@ -15,7 +15,7 @@
 #include <terminus/calc/pages/Main_Menu.hpp>
 
 // Project Libraries
-#include <terminus/gui/widget/Label.hpp>
+#include <terminus/gui/widget/Tile.hpp>
 #include <terminus/image.hpp>
 #include <terminus/log.hpp>
 
@@ -29,32 +29,64 @@ void Main_Menu::set_layout_size( math::Size2i layout_size )
     layout()->set_layout_size( layout_size );
 }
 
+/************************************/
+/*          Handle Key Input        */
+/************************************/
+bool Main_Menu::handle_input( const drv::Input_Event& event )
+{
+    return m_grid->handle_input( event );
+}
+
+/************************************/
+/*          Get the Grid            */
+/************************************/
+gui::LayoutGrid::ptr_t Main_Menu::grid() const {
+    return m_grid;
+}
+
 /************************************/
 /*          Create the Menu         */
 /************************************/
-Main_Menu::ptr_t Main_Menu::create( [[maybe_unused]] core::Options& config,
-                                    gui::Session&  session,
-                                    math::Size2i   parent_size )
+Main_Menu::ptr_t Main_Menu::create( core::Options&                    config,
+                                    gui::Session&                     session,
+                                    std::vector<gui::App_Base::ptr_t> apps )
 {
-    // Construct layout
-    auto layout = std::make_shared<gui::LayoutVertical>();
+    const math::Size2i cell_size( { config.setting<int>( "menu", "cell_width" ).value_or( 128 ),
+                                    config.setting<int>( "menu", "cell_height" ).value_or( 128 ) } );
+    const int spacing = config.setting<int>( "menu", "cell_spacing" ).value_or( 8 );
+
+    // Construct layout.  The menu fills whatever room the app stack has.
+    auto layout = std::make_shared<gui::LayoutGrid>( cell_size, spacing );
     layout->set_padding( 10, 10, 10, 10 );
     layout->set_padding_color( img::PIXEL_RED() );
+    layout->set_horizontal_stretch_policy( gui::StretchPolicy::GROW );
+    layout->set_vertical_stretch_policy( gui::StretchPolicy::GROW );
 
-    // Height of the menu as we add items
-    int layout_height = 0;
+    // Create instance
+    auto inst = std::shared_ptr<Main_Menu>( new Main_Menu( layout ) );
+    inst->m_apps = std::move( apps );
 
-    // Add temp widget
-    auto label = gui::Label::from_text("HELLO WORLD", session.driver());
-    layout->append( label );
-    layout_height += label->size_pixels().height();
+    // Icons and captions are loaded once.  The tiles only point at them.
+    for( const auto& app : inst->m_apps ){
+        inst->m_icons.push_back( app->menu_icon() );
+        inst->m_captions.push_back( session.driver().rasterize_text( app->menu_name() ) );
+    }
 
-    // Update layout height
-    layout->set_layout_size( math::Size2i( { parent_size.width(),
-                                             layout_height } ) );
+    // Tiles are rebound as they scroll.  The menu outlives its grid's factory.
+    auto menu = inst.get();
+    layout->set_cell_factory( inst->m_apps.size(),
+                              [menu, cell_size]( size_t index, gui::WidgetBase::ptr_t recycled ) -> gui::WidgetBase::ptr_t {
+                                  auto tile = std::dynamic_pointer_cast<gui::Tile>( recycled );
+                                  if( !tile ){
+                                      tile = gui::Tile::create( cell_size );
+                                  }
+                                  tile->bind( menu->m_icons[index], menu->m_captions[index] );
+                                  return tile;
+                              } );
 
-    // Create instance
-    auto inst = std::shared_ptr<Main_Menu>( new Main_Menu( layout ) );
+    layout->set_activate_callback( [menu]( size_t index ){
+        LOG_INFO( "Launching " + menu->m_apps[index]->menu_name() );
+    } );
 
     return inst;
 }
@@ -62,8 +94,9 @@ Main_Menu::ptr_t Main_Menu::create( [[maybe_unused]] core::Options& config,
 /************************************/
 /*          Constructor             */
 /************************************/
-Main_Menu::Main_Menu( gui::LayoutVertical::ptr_t main_layout )
-    : gui::WidgetLayout( main_layout )
+Main_Menu::Main_Menu( gui::LayoutGrid::ptr_t main_layout )
+    : gui::WidgetLayout( main_layout ),
+      m_grid { main_layout }
 {}
 
 } // End of tmns::calc::page namespace
\ No newline at end of file
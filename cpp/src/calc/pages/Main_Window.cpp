@@ -15,6 +15,7 @@
 #include <terminus/calc/pages/Main_Window.hpp>
 
 // Project Libraries
+#include <terminus/gui/widget/CachedWidget.hpp>
 #include <terminus/gui/widget/WidgetLayout.hpp>
 #include <terminus/image.hpp>
 #include <terminus/log.hpp>
@@ -25,9 +26,14 @@ namespace tmns::calc::page {
 /*          Update Main Window          */
 /****************************************/
 void Main_Window::update( [[maybe_unused]] core::Options& config,
-                          [[maybe_unused]] gui::Session&  session )
+                          gui::Session&                   session )
 {
     LOG_DEBUG( "Updating Main Window" );
+
+    // Keys go to the launcher
+    for( const auto& event : session.input_events() ){
+        m_main_app_menu->handle_input( event );
+    }
 }
 
 /************************************/
@@ -36,7 +42,7 @@ void Main_Window::update( [[maybe_unused]] core::Options& config,
 bool Main_Window::render( gui::Session&    session,
                           img::Frame_View& image )
 {
-    return m_base_widget->render( session, image );
+    return m_base_widget->render( session, image, 255 );
 }
 
 /****************************************/
@@ -52,42 +58,42 @@ Main_Window::ptr_t Main_Window::create( core::Options&                    config
     master_layout->set_padding( 10, 10, 10, 10 );
     master_layout->set_padding_color( img::PIXEL_PINK() );
 
-    // Get the area inside the bbox without padding
-    auto master_bbox = master_layout->get_bbox_with_padding( math::Rect2i( { math::Vector2i({0,0}),
-                                                                             master_layout->layout_size() }));
-    math::Size2i master_render_size( { master_bbox.width(), master_bbox.height() } );
-
     /// Create window instance
     auto window = std::shared_ptr<Main_Window>( new Main_Window( master_layout ) );
 
     /// Create the header
-    window->m_header = Header_Widget::create( config, session, master_render_size );
+    window->m_header = Header_Widget::create( config, session );
     window->m_header->set_border( img::PIXEL_BLACK() );
     
     /// Create the footer
-    window->m_footer = Footer_Widget::create( config, session, master_render_size );
+    window->m_footer = Footer_Widget::create( config, session );
     window->m_footer->set_border( img::PIXEL_BLACK() );
 
-    // Create the primary app stack
+    // Create the primary app stack.  It takes all the height the header and footer leave.
     window->m_stack_layout = std::make_shared<gui::LayoutStack>();
     window->m_stack_layout->set_padding( 10, 10, 10, 10 );
     window->m_stack_layout->set_padding_color( img::PIXEL_GREEN() );
+    window->m_stack_layout->set_horizontal_stretch_policy( gui::StretchPolicy::GROW );
+    window->m_stack_layout->set_vertical_stretch_policy( gui::StretchPolicy::GROW );
 
-    // Reduce the master render size by the header and footer so it knows what it's max can be
-    master_render_size.height() -= ( window->m_header->size_pixels().height() + 
-                                     window->m_footer->size_pixels().height() );
+    // Keep recent page images, so switching apps shows something at once
+    window->m_stack_layout->set_page_cache( config.setting<size_t>( "menu", "page_cache" ).value_or( 0 ) );
+    window->m_stack_layout->set_transition( gui::page_transition_from_string( config.setting<std::string>( "menu", "page_transition" ).value_or( "none" ) ),
+                                            std::chrono::milliseconds( config.setting<int>( "menu", "page_transition_ms" ).value_or( 0 ) ) );
 
-    // Add our main menu
-    window->m_main_app_menu = Main_Menu::create( config, session, master_render_size );
-    window->m_stack_layout->append( window->m_main_app_menu );
-
-    // Add subsequent apps here!
+    // Add our main menu, with a tile for each app
     window->m_apps = apps;
+    window->m_main_app_menu = Main_Menu::create( config, session, apps );
+    window->m_stack_layout->append( window->m_main_app_menu );
 
-    // Add the primary widgets to the main layout
-    window->m_base_widget->layout()->append( window->m_header, gui::ALIGN_TOP_CENTER(), {} );
-    window->m_base_widget->layout()->append( gui::WidgetLayout::from_layout( window->m_stack_layout ) );
-    window->m_base_widget->layout()->append( window->m_footer, gui::ALIGN_BOTTOM_CENTER(), {} );
+    // Add the primary widgets to the main layout.  The header and footer keep their height,
+    // and rarely change, so they are drawn once and copied on later frames.
+    auto main_layout = window->m_base_widget->layout();
+    auto header_idx  = main_layout->append( gui::CachedWidget::create( window->m_header ), gui::ALIGN_TOP_CENTER(), {} );
+    main_layout->append( gui::WidgetLayout::from_layout( window->m_stack_layout ) );
+    auto footer_idx  = main_layout->append( gui::CachedWidget::create( window->m_footer ), gui::ALIGN_BOTTOM_CENTER(), {} );
+    main_layout->set_item_stretch( header_idx, gui::StretchPolicy::FIXED );
+    main_layout->set_item_stretch( footer_idx, gui::StretchPolicy::FIXED );
 
     return window;
 }
@@ -62,9 +62,17 @@ Splash::ptr_t Splash::create( const core::Options& config,
     // Set the dimensions to screen size
     splash->set_layout_size( session.driver().get_screen_dimensions().size() );
     
-    // Load the icon first
-    auto icon_label = gui::Label::from_image( config.check_and_get_setting<std::filesystem::path>("menu","splash_icon_path"),
-                                              session.driver() );
+    // Load the icon first.  Prefer a file on disk, otherwise use the bundled or embedded resource.
+    gui::Label::ptr_t icon_label;
+    auto icon_path = config.setting<std::filesystem::path>( "menu", "splash_icon_path" );
+    if( icon_path && std::filesystem::exists( icon_path.value() ) ){
+        icon_label = gui::Label::from_image( icon_path.value(),
+                                             session.driver() );
+    }
+    else {
+        icon_label = gui::Label::from_resource( config.check_and_get_setting<std::string>( "menu", "splash_icon" ),
+                                                session.resource_manager() );
+    }
     splash->append( icon_label );
 
 
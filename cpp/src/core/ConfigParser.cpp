@@ -30,8 +30,6 @@ namespace tmns::core {
 /************************************************/
 ConfigParser::SETTINGS_TYPE ConfigParser::parse( const std::filesystem::path& path ){
 
-    ConfigParser::SETTINGS_TYPE settings;
-
     // Verify the file exists
     if( !std::filesystem::exists( path ) ){
         throw std::runtime_error( "Config file does not exist: " + path.native() );
@@ -41,6 +39,19 @@ ConfigParser::SETTINGS_TYPE ConfigParser::parse( const std::filesystem::path& pa
     std::ifstream fin;
     fin.open( path );
 
+    auto settings = parse( fin );
+    fin.close();
+
+    return settings;
+}
+
+/************************************************/
+/*          Parse Configuration Text            */
+/************************************************/
+ConfigParser::SETTINGS_TYPE ConfigParser::parse( std::istream& fin ){
+
+    ConfigParser::SETTINGS_TYPE settings;
+
     std::string line;
 
     std::getline( fin, line );
@@ -80,9 +91,23 @@ ConfigParser::SETTINGS_TYPE ConfigParser::parse( const std::filesystem::path& pa
         std::getline( fin, line );
     }
 
-    fin.close();
-
     return settings;
 }
 
+/************************************************/
+/*          Write Configuration Text            */
+/************************************************/
+std::string ConfigParser::to_string( const SETTINGS_TYPE& settings ){
+
+    std::stringstream sout;
+    for( const auto& [section, values] : settings ){
+        sout << "[" << section << "]" << std::endl;
+        for( const auto& [key, value] : values ){
+            sout << key << "=" << value << std::endl;
+        }
+        sout << std::endl;
+    }
+    return sout.str();
+}
+
 } // End of tmns::core namespace
\ No newline at end of file
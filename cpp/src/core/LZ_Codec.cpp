@@ -0,0 +1,214 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    LZ_Codec.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Fast byte-oriented LZ77 compression.
+ */
+#include <terminus/core/LZ_Codec.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+
+namespace tmns::core {
+
+namespace {
+
+/// Shortest match worth encoding
+constexpr size_t MIN_MATCH { 4 };
+
+/// Largest distance an offset can describe
+constexpr size_t MAX_OFFSET { 65535 };
+
+/// Size of the match-finder hash table, as a power of two
+constexpr size_t HASH_BITS { 12 };
+
+/// Largest count that fits in a token nibble
+constexpr size_t NIBBLE_MAX { 15 };
+
+/************************************************/
+/*          Hash the next four bytes            */
+/************************************************/
+uint32_t hash4( const uint8_t* data )
+{
+    uint32_t value;
+    std::memcpy( &value, data, sizeof( value ) );
+    return ( value * 2654435761u ) >> ( 32 - HASH_BITS );
+}
+
+/************************************************/
+/*          Write an extended length            */
+/************************************************/
+void write_length( std::vector<uint8_t>& output, size_t length )
+{
+    for( ; length >= 255; length -= 255 ){
+        output.push_back( 255 );
+    }
+    output.push_back( static_cast<uint8_t>( length ) );
+}
+
+/************************************************/
+/*          Read an extended length             */
+/************************************************/
+size_t read_length( std::span<const uint8_t> input, size_t& pos )
+{
+    size_t length = 0;
+    uint8_t value = 255;
+    while( value == 255 ){
+        if( pos >= input.size() ){
+            throw std::runtime_error( "LZ stream ends inside a length" );
+        }
+        value   = input[pos++];
+        length += value;
+    }
+    return length;
+}
+
+/************************************************/
+/*          Write one sequence                  */
+/*                                              */
+/*  A zero match length marks the last sequence */
+/************************************************/
+void write_sequence( std::vector<uint8_t>& output,
+                     const uint8_t*        literals,
+                     size_t                literal_count,
+                     size_t                offset,
+                     size_t                match_length )
+{
+    const size_t match_code = match_length > 0 ? match_length - MIN_MATCH : 0;
+    output.push_back( static_cast<uint8_t>( ( std::min( literal_count, NIBBLE_MAX ) << 4 ) |
+                                              std::min( match_code, NIBBLE_MAX ) ) );
+    if( literal_count >= NIBBLE_MAX ){
+        write_length( output, literal_count - NIBBLE_MAX );
+    }
+    output.insert( output.end(), literals, literals + literal_count );
+
+    if( match_length == 0 ){
+        return;
+    }
+    output.push_back( static_cast<uint8_t>( offset & 0xff ) );
+    output.push_back( static_cast<uint8_t>( offset >> 8 ) );
+    if( match_code >= NIBBLE_MAX ){
+        write_length( output, match_code - NIBBLE_MAX );
+    }
+}
+
+} // End of anonymous namespace
+
+/************************************/
+/*          Compress a buffer       */
+/************************************/
+void lz_compress( std::span<const uint8_t> input,
+                  std::vector<uint8_t>&    output )
+{
+    const uint8_t* base  = input.data();
+    const size_t   count = input.size();
+
+    std::array<uint32_t,( 1u << HASH_BITS )> table;
+    table.fill( 0 );
+
+    size_t anchor = 0;
+    size_t pos    = 0;
+    while( pos + MIN_MATCH <= count ){
+
+        // A single probe: the last position with the same hash
+        const uint32_t hash      = hash4( base + pos );
+        const size_t   candidate = table[hash];
+        table[hash] = static_cast<uint32_t>( pos );
+
+        if( candidate >= pos || pos - candidate > MAX_OFFSET ||
+            std::memcmp( base + candidate, base + pos, MIN_MATCH ) != 0 )
+        {
+            pos++;
+            continue;
+        }
+
+        // Matches may overlap the bytes they produce, which is how runs are encoded
+        size_t length = MIN_MATCH;
+        while( pos + length < count && base[candidate + length] == base[pos + length] ){
+            length++;
+        }
+        write_sequence( output, base + anchor, pos - anchor, pos - candidate, length );
+        pos   += length;
+        anchor = pos;
+    }
+    write_sequence( output, base + anchor, count - anchor, 0, 0 );
+}
+
+/************************************/
+/*          Decompress a buffer     */
+/************************************/
+void lz_decompress( std::span<const uint8_t> input,
+                    std::span<uint8_t>       output )
+{
+    size_t in_pos  = 0;
+    size_t out_pos = 0;
+    while( in_pos < input.size() ){
+
+        const uint8_t token = input[in_pos++];
+
+        // Literals
+        size_t literal_count = token >> 4;
+        if( literal_count == NIBBLE_MAX ){
+            literal_count += read_length( input, in_pos );
+        }
+        if( in_pos + literal_count > input.size() || out_pos + literal_count > output.size() ){
+            throw std::runtime_error( "LZ literals run past the end of the buffer" );
+        }
+        std::memcpy( output.data() + out_pos, input.data() + in_pos, literal_count );
+        in_pos  += literal_count;
+        out_pos += literal_count;
+
+        // The last sequence has no match
+        if( in_pos == input.size() ){
+            break;
+        }
+
+        // Match
+        if( in_pos + 2 > input.size() ){
+            throw std::runtime_error( "LZ stream ends inside an offset" );
+        }
+        const size_t offset = read_le<uint16_t>( input.data() + in_pos );
+        in_pos += 2;
+
+        size_t length = ( token & 0x0f ) + MIN_MATCH;
+        if( ( token & 0x0f ) == NIBBLE_MAX ){
+            length += read_length( input, in_pos );
+        }
+        if( offset == 0 || offset > out_pos || out_pos + length > output.size() ){
+            throw std::runtime_error( "LZ match is out of range" );
+        }
+
+        uint8_t* dst = output.data() + out_pos;
+        if( offset >= length ){
+            std::memcpy( dst, dst - offset, length );
+        }
+        else {
+            for( size_t i = 0; i < length; i++ ){
+                dst[i] = dst[i - offset];
+            }
+        }
+        out_pos += length;
+    }
+
+    if( out_pos != output.size() ){
+        throw std::runtime_error( "LZ stream is truncated" );
+    }
+}
+
+} // End of tmns::core namespace
@@ -0,0 +1,101 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Memory_Map.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Read-only memory-mapped file.
+ */
+#include <terminus/core/Memory_Map.hpp>
+
+// C++ Standard Libraries
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace tmns::core {
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Memory_Map::~Memory_Map()
+{
+    if( m_data != nullptr ){
+        munmap( m_data, m_size );
+    }
+}
+
+/****************************************/
+/*          Get the mapped bytes        */
+/****************************************/
+std::span<const uint8_t> Memory_Map::data() const
+{
+    return std::span<const uint8_t>( static_cast<const uint8_t*>( m_data ), m_size );
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Memory_Map::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Memory_Map:" << std::endl;
+    sout << gap << "  - Path: " << m_path.native() << std::endl;
+    sout << gap << "  - Size: " << m_size << " bytes" << std::endl;
+    return sout.str();
+}
+
+/****************************************/
+/*          Map a file into memory      */
+/****************************************/
+Memory_Map::ptr_t Memory_Map::open( const std::filesystem::path& path )
+{
+    int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+    if( fd < 0 ){
+        std::stringstream sout;
+        sout << "Unable to open file for mapping: " << path.native() << ", error: " << std::strerror( errno );
+        throw std::runtime_error( sout.str() );
+    }
+
+    struct stat file_info {};
+    if( fstat( fd, &file_info ) != 0 || file_info.st_size <= 0 ){
+        ::close( fd );
+        throw std::runtime_error( "Unable to map empty or unreadable file: " + path.native() );
+    }
+
+    auto inst = Memory_Map::ptr_t( new Memory_Map() );
+    inst->m_path = path;
+    inst->m_size = static_cast<size_t>( file_info.st_size );
+    inst->m_data = mmap( nullptr, inst->m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+    // The mapping holds its own reference to the file
+    ::close( fd );
+
+    if( inst->m_data == MAP_FAILED ){
+        inst->m_data = nullptr;
+        std::stringstream sout;
+        sout << "Unable to map file: " << path.native() << ", error: " << std::strerror( errno );
+        throw std::runtime_error( sout.str() );
+    }
+
+    return inst;
+}
+
+} // End of tmns::core namespace
@@ -78,6 +78,9 @@ std::string Options::usage() const{
     sout << std::endl;
     sout << "  -l <path> | --log-path <path> : Write output to log file." << std::endl;
     sout << std::endl;
+    sout << "  --record-input <path> : Record key input to a file for later replay." << std::endl;
+    sout << "  --replay-input <path> : Replay recorded key input and report frame times." << std::endl;
+    sout << std::endl;
 
     // Print examples of the app
 
@@ -93,6 +96,9 @@ Options Options::parse( int argc, char* argv[] )
     auto app_name = std::filesystem::path( argv[0] );
     auto options = Options( app_name );
 
+    // Settings given on the command-line, applied over the config-file
+    std::map<std::string,std::map<std::string,std::string>> overrides;
+
     // Get all arguments
     std::deque<std::string> args;
     for( int i = 1; i < argc; i++ ){
@@ -138,6 +144,18 @@ Options Options::parse( int argc, char* argv[] )
             args.pop_front();
         }
 
+        // Check if input should be recorded or replayed
+        else if( arg == "--record-input" || arg == "--replay-input" ){
+
+            if( args.empty() ){
+                throw std::runtime_error( "Cannot get " + arg + " path as arg list is empty" );
+            }
+
+            auto key = ( arg == "--record-input" ) ? "record_path" : "replay_path";
+            overrides["input"][key] = args.front();
+            args.pop_front();
+        }
+
         else {
             std::cerr << "error: Unsupported argument (" << arg << ")" << std::endl;
             std::cerr << options.usage() << std::endl;
@@ -160,6 +178,11 @@ Options Options::parse( int argc, char* argv[] )
 
     // Parse the configuration file
     options.m_settings = ConfigParser::parse( options.m_config_path );
+    for( const auto& [section, values] : overrides ){
+        for( const auto& [key, value] : values ){
+            options.m_settings[section][key] = value;
+        }
+    }
 
     return options;
 }
@@ -210,7 +233,10 @@ void Options::generate_config_file( const std::filesystem::path& pathname )
     fout << "[menu]" << std::endl;
     fout << std::endl;
     fout << "#  Icon to use for the splash screen" << std::endl;
-    fout << "splash_icon_path=./cpp/resources/images/logo/logo_360_144.png" << std::endl;
+    fout << "splash_icon_path=./build/resources/images/logo/logo_360_144.tfrm" << std::endl;
+    fout << std::endl;
+    fout << "#  Resource to use for the splash screen when splash_icon_path is not on disk" << std::endl;
+    fout << "splash_icon=images/logo/logo_360_144.png" << std::endl;
     fout << std::endl;
     fout << "#  Sleep time in ms for splash screen" << std::endl;
     fout << "splash_time_sleep_ms=5000" << std::endl;
@@ -221,6 +247,9 @@ void Options::generate_config_file( const std::filesystem::path& pathname )
     fout << std::endl;
     fout << "# Base directory for all resource data." << std::endl;
     fout << "root_dir=./cpp/resources" << std::endl;    
+    fout << std::endl;
+    fout << "# Packed resources, checked before root_dir." << std::endl;
+    fout << "bundle_path=./build/resources/resources.tbdl" << std::endl;
 
 }
 
@@ -0,0 +1,299 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Resource_Bundle.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Single-file, indexed archive of application resources.
+ */
+#include <terminus/core/Resource_Bundle.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#if TERMINUS_POSIX
+#include <terminus/core/Memory_Map.hpp>
+#endif
+
+namespace tmns::core {
+
+namespace {
+
+/// Size of the bundle header in bytes
+constexpr size_t HEADER_SIZE { 32 };
+
+/// Number of fan-out buckets
+constexpr size_t FANOUT_SIZE { 256 };
+
+/// Size of a single index entry in bytes
+constexpr size_t ENTRY_SIZE { 24 };
+
+/**
+ * Decoded index entry
+ */
+struct Index_Entry
+{
+    uint64_t hash;
+    uint32_t name_offset;
+    uint32_t name_size;
+    uint32_t data_offset;
+    uint32_t data_size;
+};
+
+/********************************************/
+/*          Read an index entry             */
+/********************************************/
+Index_Entry read_entry( const uint8_t* data )
+{
+    return Index_Entry{ read_le<uint64_t>( data ),
+                        read_le<uint32_t>( data + 8 ),
+                        read_le<uint32_t>( data + 12 ),
+                        read_le<uint32_t>( data + 16 ),
+                        read_le<uint32_t>( data + 20 ) };
+}
+
+/********************************************/
+/*          Round up to the alignment       */
+/********************************************/
+size_t align_up( size_t value, size_t alignment )
+{
+    return ( value + alignment - 1 ) / alignment * alignment;
+}
+
+} // End of anonymous namespace
+
+/************************************************/
+/*          Find the blob stored for a name     */
+/************************************************/
+std::optional<std::span<const uint8_t>> Resource_Bundle::find( std::string_view name ) const
+{
+    const uint64_t key    = hash( name );
+    const size_t   bucket = static_cast<size_t>( key >> 56 );
+
+    const uint8_t* fanout = m_buffer.data() + m_fanout_offset;
+    size_t first = ( bucket == 0 ) ? 0 : read_le<uint32_t>( fanout + 4 * ( bucket - 1 ) );
+    size_t last  = read_le<uint32_t>( fanout + 4 * bucket );
+
+    for( size_t idx = first; idx < last; idx++ ){
+        auto entry = read_entry( m_buffer.data() + m_index_offset + idx * ENTRY_SIZE );
+        if( entry.hash > key ){
+            break;
+        }
+        if( entry.hash == key && entry_name( idx ) == name ){
+            return m_buffer.subspan( entry.data_offset, entry.data_size );
+        }
+    }
+    return {};
+}
+
+/****************************************/
+/*          Get all entry names         */
+/****************************************/
+std::vector<std::string_view> Resource_Bundle::names() const
+{
+    std::vector<std::string_view> output;
+    output.reserve( m_count );
+    for( size_t idx = 0; idx < m_count; idx++ ){
+        output.push_back( entry_name( idx ) );
+    }
+    return output;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Resource_Bundle::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Resource_Bundle:" << std::endl;
+    sout << gap << "  - Entries: " << m_count << std::endl;
+    sout << gap << "  - Size: " << m_buffer.size() << " bytes" << std::endl;
+    return sout.str();
+}
+
+/********************************/
+/*          Hash a name         */
+/********************************/
+uint64_t Resource_Bundle::hash( std::string_view name )
+{
+    uint64_t value = 0xcbf29ce484222325ULL;
+    for( char c : name ){
+        value ^= static_cast<uint8_t>( c );
+        value *= 0x100000001b3ULL;
+    }
+    return value;
+}
+
+/************************************************/
+/*          Memory-map a bundle from disk       */
+/************************************************/
+Resource_Bundle::ptr_t Resource_Bundle::open( const std::filesystem::path& pathname )
+{
+#if !TERMINUS_POSIX
+    throw std::runtime_error( "Opening bundles needs memory mapping, which this build does not have: " + pathname.native() );
+#else
+    auto mapping = Memory_Map::open( pathname );
+    try {
+        return from_buffer( mapping->data(), mapping );
+    }
+    catch( const std::runtime_error& e ){
+        throw std::runtime_error( std::string( e.what() ) + ": " + pathname.native() );
+    }
+#endif
+}
+
+/************************************************/
+/*          Wrap an in-memory bundle            */
+/************************************************/
+Resource_Bundle::ptr_t Resource_Bundle::from_buffer( std::span<const uint8_t>    buffer,
+                                                     std::shared_ptr<const void> owner )
+{
+    auto bundle = Resource_Bundle::ptr_t( new Resource_Bundle() );
+    bundle->m_buffer = buffer;
+    bundle->m_owner  = std::move( owner );
+    bundle->parse();
+    return bundle;
+}
+
+/****************************************/
+/*          Build a new bundle          */
+/****************************************/
+std::vector<uint8_t> Resource_Bundle::pack( const std::map<std::string,std::vector<uint8_t>>& entries )
+{
+    // Sort entries by hash, then name, so lookups can stop early
+    std::vector<std::pair<uint64_t,const std::string*>> order;
+    order.reserve( entries.size() );
+    for( const auto& [name, data] : entries ){
+        order.emplace_back( hash( name ), &name );
+    }
+    std::sort( order.begin(), order.end(),
+               []( const auto& a, const auto& b ){
+                   return a.first != b.first ? a.first < b.first : *a.second < *b.second;
+               } );
+
+    const size_t fanout_offset = HEADER_SIZE;
+    const size_t index_offset  = fanout_offset + FANOUT_SIZE * 4;
+    const size_t names_offset  = index_offset + entries.size() * ENTRY_SIZE;
+    size_t names_size = 0;
+    for( const auto& [name, data] : entries ){
+        names_size += name.size();
+    }
+
+    std::vector<uint8_t> output( align_up( names_offset + names_size, DATA_ALIGNMENT ), 0 );
+
+    // Header
+    std::copy( MAGIC.begin(), MAGIC.end(), output.begin() );
+    write_le<uint16_t>( output.data() + 4,  VERSION );
+    write_le<uint32_t>( output.data() + 8,  static_cast<uint32_t>( entries.size() ) );
+    write_le<uint32_t>( output.data() + 12, static_cast<uint32_t>( fanout_offset ) );
+    write_le<uint32_t>( output.data() + 16, static_cast<uint32_t>( index_offset ) );
+    write_le<uint32_t>( output.data() + 20, static_cast<uint32_t>( names_offset ) );
+    write_le<uint32_t>( output.data() + 24, static_cast<uint32_t>( names_size ) );
+
+    // Fan-out table
+    std::array<uint32_t,FANOUT_SIZE> counts {};
+    for( const auto& [key, name] : order ){
+        counts[ static_cast<size_t>( key >> 56 ) ]++;
+    }
+    uint32_t running = 0;
+    for( size_t bucket = 0; bucket < FANOUT_SIZE; bucket++ ){
+        running += counts[bucket];
+        write_le<uint32_t>( output.data() + fanout_offset + 4 * bucket, running );
+    }
+
+    // Index, names, and blobs
+    size_t name_pos = names_offset;
+    for( size_t idx = 0; idx < order.size(); idx++ ){
+        const auto& [key, name] = order[idx];
+        const auto& data = entries.at( *name );
+
+        std::copy( name->begin(), name->end(), output.begin() + static_cast<long>( name_pos ) );
+
+        const size_t data_pos = output.size();
+        output.insert( output.end(), data.begin(), data.end() );
+        output.resize( align_up( output.size(), DATA_ALIGNMENT ), 0 );
+
+        uint8_t* entry = output.data() + index_offset + idx * ENTRY_SIZE;
+        write_le<uint64_t>( entry,      key );
+        write_le<uint32_t>( entry + 8,  static_cast<uint32_t>( name_pos - names_offset ) );
+        write_le<uint32_t>( entry + 12, static_cast<uint32_t>( name->size() ) );
+        write_le<uint32_t>( entry + 16, static_cast<uint32_t>( data_pos ) );
+        write_le<uint32_t>( entry + 20, static_cast<uint32_t>( data.size() ) );
+
+        name_pos += name->size();
+    }
+    return output;
+}
+
+/********************************************/
+/*          Parse and validate bundle       */
+/********************************************/
+void Resource_Bundle::parse()
+{
+    if( m_buffer.size() < HEADER_SIZE ||
+        !std::equal( MAGIC.begin(), MAGIC.end(), m_buffer.begin(),
+                     []( char a, uint8_t b ){ return static_cast<uint8_t>( a ) == b; } ) )
+    {
+        throw std::runtime_error( "Buffer is not a Terminus resource bundle" );
+    }
+
+    const uint8_t* header = m_buffer.data();
+    const auto version = read_le<uint16_t>( header + 4 );
+    if( version != VERSION ){
+        std::stringstream sout;
+        sout << "Unsupported resource bundle version: " << version;
+        throw std::runtime_error( sout.str() );
+    }
+
+    m_count         = read_le<uint32_t>( header + 8 );
+    m_fanout_offset = read_le<uint32_t>( header + 12 );
+    m_index_offset  = read_le<uint32_t>( header + 16 );
+    m_names_offset  = read_le<uint32_t>( header + 20 );
+    const size_t names_size = read_le<uint32_t>( header + 24 );
+
+    if( m_fanout_offset + FANOUT_SIZE * 4 > m_buffer.size() ||
+        m_index_offset + m_count * ENTRY_SIZE > m_buffer.size() ||
+        m_names_offset + names_size > m_buffer.size() ||
+        read_le<uint32_t>( m_buffer.data() + m_fanout_offset + 4 * ( FANOUT_SIZE - 1 ) ) != m_count )
+    {
+        throw std::runtime_error( "Resource bundle index is truncated or corrupt" );
+    }
+
+    // Check every entry once so lookups never have to
+    for( size_t idx = 0; idx < m_count; idx++ ){
+        auto entry = read_entry( m_buffer.data() + m_index_offset + idx * ENTRY_SIZE );
+        if( static_cast<size_t>( entry.name_offset ) + entry.name_size > names_size ||
+            static_cast<size_t>( entry.data_offset ) + entry.data_size > m_buffer.size() )
+        {
+            std::stringstream sout;
+            sout << "Resource bundle entry " << idx << " points outside of the bundle";
+            throw std::runtime_error( sout.str() );
+        }
+    }
+}
+
+/****************************************/
+/*          Get an entry's name         */
+/****************************************/
+std::string_view Resource_Bundle::entry_name( size_t index ) const
+{
+    auto entry = read_entry( m_buffer.data() + m_index_offset + index * ENTRY_SIZE );
+    return std::string_view( reinterpret_cast<const char*>( m_buffer.data() + m_names_offset + entry.name_offset ),
+                             entry.name_size );
+}
+
+} // End of tmns::core namespace
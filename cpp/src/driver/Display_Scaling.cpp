@@ -0,0 +1,93 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Display_Scaling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Display_Scaling.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/StringUtilities.hpp>
+
+namespace tmns::drv {
+
+/********************************/
+/*          Convert to string   */
+/********************************/
+std::string to_string( Scale_Mode mode )
+{
+    switch( mode ){
+        case Scale_Mode::INTEGER: return "INTEGER";
+        case Scale_Mode::FIT:     return "FIT";
+        case Scale_Mode::STRETCH: return "STRETCH";
+    }
+    return "UNKNOWN";
+}
+
+/************************************/
+/*          Parse a mode name       */
+/************************************/
+Scale_Mode scale_mode_from_string( const std::string& name )
+{
+    auto lower = core::to_lower( name );
+    if( lower == "integer" ){
+        return Scale_Mode::INTEGER;
+    }
+    if( lower == "fit" ){
+        return Scale_Mode::FIT;
+    }
+    if( lower == "stretch" ){
+        return Scale_Mode::STRETCH;
+    }
+    throw std::runtime_error( "Unknown scale mode: " + name + ". Expected integer, fit or stretch." );
+}
+
+/************************************************/
+/*          Place the frame in the window       */
+/************************************************/
+math::Rect2i present_viewport( const math::Size2i& frame,
+                               const math::Size2i& window,
+                               Scale_Mode          mode )
+{
+    if( frame.width() <= 0 || frame.height() <= 0 || mode == Scale_Mode::STRETCH ){
+        return math::Rect2i( 0, 0, window.width(), window.height() );
+    }
+
+    int cols = window.width();
+    int rows = window.height();
+
+    const int whole = std::min( window.width() / frame.width(), window.height() / frame.height() );
+    if( mode == Scale_Mode::INTEGER && whole >= 1 ){
+        cols = frame.width() * whole;
+        rows = frame.height() * whole;
+    }
+
+    // Fit the limiting side and scale the other, keeping the aspect ratio
+    else if( static_cast<int64_t>( window.width() ) * frame.height() <
+             static_cast<int64_t>( window.height() ) * frame.width() )
+    {
+        rows = static_cast<int>( static_cast<int64_t>( window.width() ) * frame.height() / frame.width() );
+    }
+    else {
+        cols = static_cast<int>( static_cast<int64_t>( window.height() ) * frame.width() / frame.height() );
+    }
+
+    return math::Rect2i( ( window.width() - cols ) / 2,
+                         ( window.height() - rows ) / 2,
+                         cols,
+                         rows );
+}
+
+} // End of tmns::drv namespace
@@ -8,19 +8,69 @@
 /*                                                                                    */
 /**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
 /**
- * @file    Allegro.cpp
+ * @file    DriverAllegro.cpp
  * @author  Marvin Smith
  * @date    03/21/2025
  *
- * @details Vertical Layout API
+ * @details Allegro Graphics API Wrapper
  */
-#include <terminus/app/calc/drivers/DriverAllegro.hpp>
+#include <terminus/driver/DriverAllegro.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_File.hpp>
+#include <terminus/log/Logger.hpp>
 
 // OpenCV Libraries
 #include <opencv4/opencv2/imgcodecs.hpp>
 
 namespace tmns::drv {
 
+namespace {
+
+/************************************************/
+/*          Map an Allegro keycode to a Key     */
+/************************************************/
+Key translate_key( int keycode )
+{
+    if( keycode >= ALLEGRO_KEY_A && keycode <= ALLEGRO_KEY_Z ){
+        return static_cast<Key>( 'A' + ( keycode - ALLEGRO_KEY_A ) );
+    }
+    if( keycode >= ALLEGRO_KEY_0 && keycode <= ALLEGRO_KEY_9 ){
+        return static_cast<Key>( '0' + ( keycode - ALLEGRO_KEY_0 ) );
+    }
+    switch( keycode ){
+        case ALLEGRO_KEY_SPACE:     return Key::SPACE;
+        case ALLEGRO_KEY_COMMA:     return Key::COMMA;
+        case ALLEGRO_KEY_MINUS:     return Key::MINUS;
+        case ALLEGRO_KEY_FULLSTOP:  return Key::PERIOD;
+        case ALLEGRO_KEY_SLASH:     return Key::SLASH;
+        case ALLEGRO_KEY_EQUALS:    return Key::EQUAL;
+        case ALLEGRO_KEY_UP:        return Key::UP;
+        case ALLEGRO_KEY_DOWN:      return Key::DOWN;
+        case ALLEGRO_KEY_LEFT:      return Key::LEFT;
+        case ALLEGRO_KEY_RIGHT:     return Key::RIGHT;
+        case ALLEGRO_KEY_ENTER:     return Key::ENTER;
+        case ALLEGRO_KEY_ESCAPE:    return Key::ESCAPE;
+        case ALLEGRO_KEY_BACKSPACE: return Key::BACKSPACE;
+        case ALLEGRO_KEY_TAB:       return Key::TAB;
+        case ALLEGRO_KEY_HOME:      return Key::HOME;
+        case ALLEGRO_KEY_END:       return Key::END;
+        case ALLEGRO_KEY_PGUP:      return Key::PAGE_UP;
+        case ALLEGRO_KEY_PGDN:      return Key::PAGE_DOWN;
+        case ALLEGRO_KEY_DELETE:    return Key::DELETE;
+        default:                    return Key::NONE;
+    }
+}
+
+} // End of anonymous namespace
+
 /****************************************/
 /*          Initialize Driver           */
 /****************************************/
@@ -28,12 +78,12 @@ bool Driver_Allegro::initialize( core::Options& config )
 {
     // Initialization provided courtesy of Allegro docs
     //    https://github.com/liballeg/allegro_wiki/wiki/Allegro-Vivace-%E2%80%93-Basic-game-structure
-    
-    al_init();
+    if( !al_init() || !al_init_font_addon() ){
+        throw std::runtime_error( "Unable to initialize Allegro" );
+    }
 
     al_install_keyboard();
-
-    m_timer = al_create_timer(1.0 / 30.0);
+    al_install_mouse();
 
     m_queue = al_create_event_queue();
 
@@ -44,21 +94,168 @@ bool Driver_Allegro::initialize( core::Options& config )
 
     // Configure handlers
     al_register_event_source( m_queue, al_get_keyboard_event_source() );
-    al_register_event_source( m_queue, al_get_display_event_source(m_display) );
-    al_register_event_source( m_queue, al_get_timer_event_source(m_timer) );
+    al_register_event_source( m_queue, al_get_mouse_event_source() );
+    al_register_event_source( m_queue, al_get_display_event_source( m_display ) );
 
+    LOG_DEBUG( to_log_string() );
     return true;
 }
 
 /****************************************/
 /*            Finalize Driver           */
 /****************************************/
-void Driver_Allegro::finalize()
+int Driver_Allegro::finalize()
 {
-    al_destroy_font( m_font );
-    al_destroy_display( m_display );
-    al_destroy_timer( m_timer );
-    al_destroy_event_queue( m_queue );    
+    if( m_screen != nullptr ){
+        al_destroy_bitmap( m_screen );
+        m_screen = nullptr;
+    }
+    if( m_font != nullptr ){
+        al_destroy_font( m_font );
+        m_font = nullptr;
+    }
+    if( m_display != nullptr ){
+        al_destroy_display( m_display );
+        m_display = nullptr;
+    }
+    if( m_queue != nullptr ){
+        al_destroy_event_queue( m_queue );
+        m_queue = nullptr;
+    }
+    return 0;
+}
+
+/********************************************/
+/*          Check if we should exit         */
+/********************************************/
+bool Driver_Allegro::okay_to_run()
+{
+    // Nothing else reads the queue, so drain it, queue key events and keep track of held keys and buttons
+    ALLEGRO_EVENT event;
+    while( al_get_next_event( m_queue, &event ) ){
+        switch( event.type ){
+            case ALLEGRO_EVENT_DISPLAY_CLOSE:
+                m_okay_to_run = false;
+                break;
+            case ALLEGRO_EVENT_KEY_DOWN:
+                if( auto key = translate_key( event.keyboard.keycode ); key != Key::NONE ){
+                    push_input_event( Input_Action::PRESS, key );
+                }
+                m_inputs_down++;
+                break;
+            case ALLEGRO_EVENT_KEY_UP:
+                if( auto key = translate_key( event.keyboard.keycode ); key != Key::NONE ){
+                    push_input_event( Input_Action::RELEASE, key );
+                }
+                m_inputs_down = ( m_inputs_down > 0 ) ? m_inputs_down - 1 : 0;
+                break;
+            case ALLEGRO_EVENT_MOUSE_BUTTON_DOWN:
+                m_inputs_down++;
+                break;
+            case ALLEGRO_EVENT_MOUSE_BUTTON_UP:
+                m_inputs_down = ( m_inputs_down > 0 ) ? m_inputs_down - 1 : 0;
+                break;
+            default:
+                break;
+        }
+    }
+    return m_okay_to_run;
+}
+
+/************************************************/
+/*          Check for user interaction          */
+/************************************************/
+bool Driver_Allegro::input_pending()
+{
+    // Frames are paced by the application, so the queue only ever holds input and display events
+    return !al_is_event_queue_empty( m_queue ) || m_inputs_down > 0;
+}
+
+/************************************************/
+/*          Wait for the user or the deadline   */
+/************************************************/
+bool Driver_Allegro::wait_for_input( std::chrono::steady_clock::time_point until,
+                                     std::chrono::steady_clock::duration )
+{
+    if( input_pending() ){
+        return true;
+    }
+
+    const auto remaining = std::chrono::duration<double>( until - std::chrono::steady_clock::now() );
+    if( remaining.count() <= 0 ){
+        return false;
+    }
+
+    // A null event leaves the event in the queue for okay_to_run()
+    ALLEGRO_TIMEOUT timeout;
+    al_init_timeout( &timeout, remaining.count() );
+    return al_wait_for_event_until( m_queue, nullptr, &timeout );
+}
+
+/********************************************************/
+/*          Print the current frame to the screen       */
+/********************************************************/
+void Driver_Allegro::show( img::Frame& frame )
+{
+    if( m_screen == nullptr || frame.pixels().empty() ){
+        return;
+    }
+
+    const auto   src_format = img::pixel_format_from_channels( frame.channels() );
+    const size_t row_bytes  = frame.cols() * frame.channels();
+    const size_t cols       = std::min( frame.cols(), m_window_cols );
+    const size_t rows       = std::min( frame.rows(), m_window_rows );
+    const auto   pixels     = frame.pixels();
+
+    // Find the band of rows that changed
+    auto [first, last] = changed_rows( pixels, m_previous, row_bytes );
+    last = std::min( last, rows );
+
+    // Only the changed rows are locked and written.  The pitch may be negative.
+    if( last > first ){
+        auto region = al_lock_bitmap_region( m_screen,
+                                             0,
+                                             static_cast<int>( first ),
+                                             static_cast<int>( cols ),
+                                             static_cast<int>( last - first ),
+                                             ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE,
+                                             ALLEGRO_LOCK_WRITEONLY );
+        if( region == nullptr ){
+            LOG_WARNING( "Unable to lock the screen bitmap" );
+
+            // This frame never reached the bitmap, so the next one must be written in full
+            m_previous.clear();
+            return;
+        }
+        for( size_t row = first; row < last; row++ ){
+            auto dst = static_cast<uint8_t*>( region->data ) + static_cast<ptrdiff_t>( row - first ) * region->pitch;
+            img::convert_row( pixels.data() + row * row_bytes, src_format, dst, img::PixelFormat::RGBA, cols );
+        }
+        al_unlock_bitmap( m_screen );
+    }
+
+    al_set_target_backbuffer( m_display );
+    al_draw_bitmap( m_screen, 0, 0, 0 );
+    al_flip_display();
+}
+
+/****************************************/
+/*          Describe the display        */
+/****************************************/
+Driver_Capabilities Driver_Allegro::capabilities() const
+{
+    Driver_Capabilities caps;
+
+    // ABGR_8888_LE is RGBA in memory, so frames are copied without conversion
+    caps.native_formats  = { img::PixelFormat::RGBA };
+    caps.partial_updates = true;
+    caps.row_alignment   = 4;
+    if( m_display != nullptr ){
+        caps.vsync = al_get_display_option( m_display, ALLEGRO_VSYNC ) == 1;
+        const int max_size = al_get_display_option( m_display, ALLEGRO_MAX_BITMAP_SIZE );
+        caps.max_texture_size = math::Size2i( { max_size, max_size } );
+    }
+    return caps;
 }
 
 /******************************************/
@@ -66,9 +263,7 @@ void Driver_Allegro::finalize()
 /******************************************/
 img::Dimensions Driver_Allegro::get_screen_dimensions() const
 {
-    return img::Dimensions( al_get_display_width( m_display ),
-                            al_get_display_height( m_display ),
-                            3 );
+    return img::Dimensions( m_window_cols, m_window_rows, 4 );
 }
 
 /************************************/
@@ -76,10 +271,84 @@ img::Dimensions Driver_Allegro::get_screen_dimensions() const
 /************************************/
 img::Frame::ptr_t Driver_Allegro::load_image( const std::filesystem::path& pathname )
 {
-    auto img = cv::imread( pathname.native(), cv::IMREAD_COLOR );
+    // Native frames are memory-mapped without decoding
+    if( pathname.extension() == ".tfrm" ){
+        return img::read_frame_file( pathname );
+    }
+
+    auto img = cv::imread( pathname.native(), cv::IMREAD_UNCHANGED );
+    if( img.empty() ){
+        std::stringstream sout;
+        sout << "Unable to load image: " << pathname.native();
+        throw std::runtime_error( sout.str() );
+    }
+    if( img.depth() != CV_8U ){
+        img.convertTo( img, CV_8U, 1.0 / 257.0 );
+    }
+
+    // OpenCV stores color as BGR(A)
+    img::PixelFormat format;
+    switch( img.channels() ){
+        case 1:  format = img::PixelFormat::GRAY;       break;
+        case 2:  format = img::PixelFormat::GRAY_ALPHA; break;
+        case 3:  format = img::PixelFormat::BGR;        break;
+        default: format = img::PixelFormat::BGRA;       break;
+    }
 
     // build new frame instance
-    auto frame = std::make_shared<img::Frame>( img::Dimensions( img.cols, img.rows, img.channels() ) );
+    const size_t rows = static_cast<size_t>( img.rows );
+    auto frame = img::convert( std::span<const uint8_t>( img.data, img.step[0] * rows ),
+                               static_cast<size_t>( img.cols ),
+                               rows,
+                               img.step[0],
+                               format,
+                               img::PixelFormat::RGBA );
+
+    return frame;
+}
+
+/********************************************/
+/*          Generate image from text        */
+/********************************************/
+img::Frame::ptr_t Driver_Allegro::rasterize_text( const std::string& message )
+{
+    // If the message is empty, then return empty frame
+    if( message.empty() ){
+        LOG_WARNING( "Message is empty" );
+        return std::make_shared<img::Frame>();
+    }
+
+    // Draw into a memory bitmap so nothing round-trips through the GPU
+    const int width  = al_get_text_width( m_font, message.c_str() );
+    const int height = al_get_font_line_height( m_font );
+
+    al_set_new_bitmap_flags( ALLEGRO_MEMORY_BITMAP );
+    auto bitmap = al_create_bitmap( width, height );
+    al_set_new_bitmap_flags( 0 );
+    if( bitmap == nullptr ){
+        throw std::runtime_error( "Unable to create text bitmap" );
+    }
+
+    al_set_target_bitmap( bitmap );
+    al_clear_to_color( al_map_rgba( 0, 0, 0, 0 ) );
+    al_draw_text( m_font, al_map_rgb( 0, 82, 172 ), 0, 0, 0, message.c_str() );
+    al_set_target_backbuffer( m_display );
+
+    // Same color as the raylib driver
+    const size_t cols = static_cast<size_t>( width );
+    const size_t rows = static_cast<size_t>( height );
+    auto frame = std::make_shared<img::Frame>();
+    frame->resize( img::Dimensions( cols, rows, 4 ), 0 );
+
+    auto region = al_lock_bitmap( bitmap, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, ALLEGRO_LOCK_READONLY );
+    if( region != nullptr ){
+        for( size_t row = 0; row < rows; row++ ){
+            auto src = static_cast<const uint8_t*>( region->data ) + static_cast<ptrdiff_t>( row ) * region->pitch;
+            std::memcpy( frame->data() + row * cols * 4, src, cols * 4 );
+        }
+        al_unlock_bitmap( bitmap );
+    }
+    al_destroy_bitmap( bitmap );
 
     return frame;
 }
@@ -92,7 +361,7 @@ std::string Driver_Allegro::to_log_string( size_t offset ) const
     std::string gap( offset, ' ' );
     std::stringstream sout;
     sout << gap << "Driver_Allegro:" << std::endl;
-    
+    sout << gap << "  - Window: " << m_window_cols << " x " << m_window_rows << std::endl;
     return sout.str();
 }
 
@@ -102,7 +371,7 @@ std::string Driver_Allegro::to_log_string( size_t offset ) const
 Driver_Allegro::ptr_t Driver_Allegro::create( core::Options& config )
 {
     // Create new driver
-    auto driver = std::make_shared<Driver_Allegro>();
+    auto driver = Driver_Allegro::ptr_t( new Driver_Allegro() );
 
     driver->initialize( config );
     return driver;
@@ -113,13 +382,9 @@ Driver_Allegro::ptr_t Driver_Allegro::create( core::Options& config )
 /************************************************/
 void Driver_Allegro::configure_display( core::Options& config )
 {
-    img::Dimensions img_dims;
-    if( config.setting<bool>( "display", "override_screen_size" ) ){
-
-        // Get size parameters
-        img_dims.set_cols( config.setting<int>( "display", "screen_width" ) );
-        img_dims.set_rows( config.setting<int>( "display", "screen_height" ) );
-        img_dims.set_channels( 3 );
+    if( config.setting<bool>( "display", "override_screen_size" ).value_or( false ) ){
+        m_window_cols = config.check_and_get_setting<size_t>( "display", "screen_width" );
+        m_window_rows = config.check_and_get_setting<size_t>( "display", "screen_height" );
     }
 
     // Currently not implemented
@@ -127,7 +392,20 @@ void Driver_Allegro::configure_display( core::Options& config )
         throw std::runtime_error( "Unable to get display settings at this time.");
     }
 
-    m_display = al_create_display( img_dims.cols(), img_dims.rows() );
+    // Ask for vsync before the display exists.  The driver may still refuse it.
+    if( config.setting<bool>( "display", "vsync" ).value_or( false ) ){
+        al_set_new_display_option( ALLEGRO_VSYNC, 1, ALLEGRO_SUGGEST );
+    }
+
+    m_display = al_create_display( static_cast<int>( m_window_cols ),
+                                   static_cast<int>( m_window_rows ) );
+    if( m_display == nullptr ){
+        throw std::runtime_error( "Unable to create Allegro display" );
+    }
+
+    // Frames are written on the CPU, then drawn to the back buffer as one bitmap
+    m_screen = al_create_bitmap( static_cast<int>( m_window_cols ),
+                                 static_cast<int>( m_window_rows ) );
 }
 
 } // End of tmns::drv namespace
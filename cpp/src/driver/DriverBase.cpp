@@ -0,0 +1,174 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverBase.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/DriverBase.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+// Project Libraries
+#include <terminus/image/Frame_File.hpp>
+#include <terminus/log/Logger.hpp>
+
+namespace tmns::drv {
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Driver_Base::~Driver_Base()
+{
+    stop_image_loader();
+}
+
+/************************************************/
+/*          Wait for the user or the deadline   */
+/************************************************/
+bool Driver_Base::wait_for_input( std::chrono::steady_clock::time_point until,
+                                  std::chrono::steady_clock::duration   poll_interval )
+{
+    for( auto now = std::chrono::steady_clock::now(); now < until; now = std::chrono::steady_clock::now() ){
+        std::this_thread::sleep_until( std::min( until, now + poll_interval ) );
+        if( input_pending() ){
+            return true;
+        }
+    }
+    return false;
+}
+
+/****************************************/
+/*          Take the queued key events  */
+/****************************************/
+std::vector<Input_Event> Driver_Base::take_input_events()
+{
+    return std::exchange( m_input_events, {} );
+}
+
+/****************************************/
+/*          Queue a key event           */
+/****************************************/
+void Driver_Base::push_input_event( Input_Action action,
+                                    Key          key )
+{
+    m_input_events.push_back( Input_Event{ std::chrono::steady_clock::now(), action, key } );
+}
+
+/****************************************/
+/*          Describe the display        */
+/****************************************/
+Driver_Capabilities Driver_Base::capabilities() const
+{
+    return Driver_Capabilities();
+}
+
+/************************************************/
+/*          Load an image in the background     */
+/************************************************/
+Image_Loader::Result Driver_Base::load_image_async( const std::filesystem::path& path )
+{
+#if !TERMINUS_POSIX
+    // No threads to load on, so finish the load here
+    std::promise<img::Frame::ptr_t> promise;
+    try {
+        promise.set_value( load_image( path ) );
+    }
+    catch( ... ){
+        promise.set_exception( std::current_exception() );
+    }
+    return promise.get_future().share();
+#else
+    std::lock_guard<std::mutex> lock( m_image_loader_mutex );
+    if( !m_image_loader ){
+        m_image_loader = std::make_unique<Image_Loader>( [this]( const std::filesystem::path& pathname ){
+                                                             return load_image( pathname );
+                                                         },
+                                                         IMAGE_LOADER_THREADS );
+    }
+    return m_image_loader->load( path );
+#endif
+}
+
+/****************************************/
+/*          Stop the image loader       */
+/****************************************/
+void Driver_Base::stop_image_loader()
+{
+#if TERMINUS_POSIX
+    std::lock_guard<std::mutex> lock( m_image_loader_mutex );
+    if( m_image_loader ){
+        m_image_loader->stop();
+        LOG_DEBUG( m_image_loader->to_log_string() );
+        m_image_loader.reset();
+    }
+#endif
+}
+
+/****************************************************/
+/*          Find the rows changed since last time   */
+/****************************************************/
+std::pair<size_t,size_t> Driver_Base::changed_rows( std::span<const uint8_t> pixels,
+                                                    std::vector<uint8_t>&    previous,
+                                                    size_t                   row_bytes )
+{
+    const size_t rows = row_bytes > 0 ? pixels.size() / row_bytes : 0;
+
+    size_t first = 0;
+    size_t last  = rows;
+    if( previous.size() == pixels.size() ){
+        while( first < rows && std::memcmp( pixels.data() + first * row_bytes,
+                                            previous.data() + first * row_bytes,
+                                            row_bytes ) == 0 ){
+            first++;
+        }
+        while( last > first && std::memcmp( pixels.data() + ( last - 1 ) * row_bytes,
+                                            previous.data() + ( last - 1 ) * row_bytes,
+                                            row_bytes ) == 0 ){
+            last--;
+        }
+    }
+    previous.assign( pixels.begin(), pixels.end() );
+    return { first, last };
+}
+
+/************************************************/
+/*          Load an image without a display     */
+/************************************************/
+img::Frame::ptr_t Driver_Base::headless_image( const std::filesystem::path& path )
+{
+    if( path.extension() == ".tfrm" ){
+        return img::read_frame_file( path );
+    }
+
+    LOG_WARNING( "Cannot decode images without a display, using a placeholder for " + path.native() );
+    return std::make_shared<img::Frame>( img::Dimensions( HEADLESS_IMAGE_SIZE, HEADLESS_IMAGE_SIZE, 4 ) );
+}
+
+/************************************************/
+/*          Rasterize text without a display    */
+/************************************************/
+img::Frame::ptr_t Driver_Base::headless_text( const std::string& message )
+{
+    if( message.empty() ){
+        LOG_WARNING( "Message is empty" );
+        return std::make_shared<img::Frame>();
+    }
+
+    // Roughly the size real text would take, so layouts still get exercised
+    return std::make_shared<img::Frame>( img::Dimensions( message.size() * HEADLESS_GLYPH_COLS,
+                                                          HEADLESS_GLYPH_ROWS,
+                                                          4 ) );
+}
+
+} // End of tmns::drv namespace
@@ -0,0 +1,494 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverFBDev.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Linux Framebuffer Driver
+ */
+#include <terminus/driver/DriverFBDev.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <linux/input.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Project Libraries
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_File.hpp>
+#include <terminus/log/Logger.hpp>
+
+// OpenCV Libraries
+#include <opencv4/opencv2/imgcodecs.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
+
+namespace tmns::drv {
+
+namespace {
+
+/// Set by SIGINT or SIGTERM
+volatile std::sig_atomic_t g_stop_requested { 0 };
+
+/// Text scale giving roughly 16 pixel tall lines
+constexpr double TEXT_SCALE { 0.6 };
+
+/// Blank pixels around rasterized text
+constexpr int TEXT_PADDING { 2 };
+
+/************************************************/
+/*          Map an evdev key code to a Key      */
+/************************************************/
+Key translate_key( uint16_t code )
+{
+    // Letters follow the keyboard rows rather than the alphabet
+    static constexpr std::pair<uint16_t,char> LETTERS[] {
+        { KEY_A, 'A' }, { KEY_B, 'B' }, { KEY_C, 'C' }, { KEY_D, 'D' }, { KEY_E, 'E' }, { KEY_F, 'F' },
+        { KEY_G, 'G' }, { KEY_H, 'H' }, { KEY_I, 'I' }, { KEY_J, 'J' }, { KEY_K, 'K' }, { KEY_L, 'L' },
+        { KEY_M, 'M' }, { KEY_N, 'N' }, { KEY_O, 'O' }, { KEY_P, 'P' }, { KEY_Q, 'Q' }, { KEY_R, 'R' },
+        { KEY_S, 'S' }, { KEY_T, 'T' }, { KEY_U, 'U' }, { KEY_V, 'V' }, { KEY_W, 'W' }, { KEY_X, 'X' },
+        { KEY_Y, 'Y' }, { KEY_Z, 'Z' } };
+    for( const auto& [letter_code, letter] : LETTERS ){
+        if( code == letter_code ){
+            return static_cast<Key>( letter );
+        }
+    }
+    if( code >= KEY_1 && code <= KEY_9 ){
+        return static_cast<Key>( '1' + ( code - KEY_1 ) );
+    }
+
+    switch( code ){
+        case KEY_0:         return static_cast<Key>( '0' );
+        case KEY_SPACE:     return Key::SPACE;
+        case KEY_COMMA:     return Key::COMMA;
+        case KEY_MINUS:     return Key::MINUS;
+        case KEY_DOT:       return Key::PERIOD;
+        case KEY_SLASH:     return Key::SLASH;
+        case KEY_EQUAL:     return Key::EQUAL;
+        case KEY_UP:        return Key::UP;
+        case KEY_DOWN:      return Key::DOWN;
+        case KEY_LEFT:      return Key::LEFT;
+        case KEY_RIGHT:     return Key::RIGHT;
+        case KEY_ENTER:     return Key::ENTER;
+        case KEY_ESC:       return Key::ESCAPE;
+        case KEY_BACKSPACE: return Key::BACKSPACE;
+        case KEY_TAB:       return Key::TAB;
+        case KEY_HOME:      return Key::HOME;
+        case KEY_END:       return Key::END;
+        case KEY_PAGEUP:    return Key::PAGE_UP;
+        case KEY_PAGEDOWN:  return Key::PAGE_DOWN;
+        case KEY_DELETE:    return Key::DELETE;
+        default:            return Key::NONE;
+    }
+}
+
+/************************************************/
+/*          Ask the application loop to exit    */
+/************************************************/
+void request_stop( int )
+{
+    g_stop_requested = 1;
+}
+
+/************************************************/
+/*          Parse a configured pixel format     */
+/************************************************/
+img::PixelFormat parse_pixel_format( std::string name )
+{
+    std::transform( name.begin(), name.end(), name.begin(),
+                    []( unsigned char c ){ return static_cast<char>( std::toupper( c ) ); } );
+    for( auto format : { img::PixelFormat::RGB565, img::PixelFormat::RGB,  img::PixelFormat::BGR,
+                         img::PixelFormat::RGBA,   img::PixelFormat::BGRA } )
+    {
+        if( img::to_string( format ) == name ){
+            return format;
+        }
+    }
+    throw std::runtime_error( "Unsupported framebuffer format: " + name );
+}
+
+/****************************************************/
+/*          Map the device's channel layout         */
+/****************************************************/
+img::PixelFormat pixel_format_from_screeninfo( const fb_var_screeninfo& info )
+{
+    // Offsets count from the least significant bit, and the framebuffer is little-endian
+    const bool red_first = info.red.offset == 0;
+    switch( info.bits_per_pixel ){
+        case 16:
+            return img::PixelFormat::RGB565;
+        case 24:
+            return red_first ? img::PixelFormat::RGB : img::PixelFormat::BGR;
+        case 32:
+            return red_first ? img::PixelFormat::RGBA : img::PixelFormat::BGRA;
+        default:
+            break;
+    }
+    std::stringstream sout;
+    sout << "Unsupported framebuffer depth: " << info.bits_per_pixel << " bits per pixel";
+    throw std::runtime_error( sout.str() );
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Driver_FBDev::~Driver_FBDev()
+{
+    close_devices();
+}
+
+/****************************************/
+/*          Initialize Driver           */
+/****************************************/
+bool Driver_FBDev::initialize( core::Options& config )
+{
+    open_device( config );
+
+    // Activity detection is optional
+    auto input_path = config.setting<std::filesystem::path>( "fbdev", "input_device" );
+    if( input_path ){
+        m_input_fd = ::open( input_path.value().c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC );
+        if( m_input_fd < 0 ){
+            LOG_WARNING( "Unable to open input device: " + input_path.value().native() + ", error: " + std::strerror( errno ) );
+        }
+    }
+
+    // There is no window to close, so stop on the usual signals
+    std::signal( SIGINT,  request_stop );
+    std::signal( SIGTERM, request_stop );
+
+    LOG_DEBUG( to_log_string() );
+    return true;
+}
+
+/****************************************/
+/*            Finalize Driver           */
+/****************************************/
+int Driver_FBDev::finalize()
+{
+    close_devices();
+    return 0;
+}
+
+/********************************************/
+/*          Check if we should exit         */
+/********************************************/
+bool Driver_FBDev::okay_to_run()
+{
+    return g_stop_requested == 0;
+}
+
+/************************************************/
+/*          Check for user interaction          */
+/************************************************/
+bool Driver_FBDev::input_pending()
+{
+    if( m_input_fd < 0 ){
+        return false;
+    }
+
+    // Nothing else reads the device, so drain it, queue key events and keep track of held keys
+    bool activity = false;
+    input_event event {};
+    while( ::read( m_input_fd, &event, sizeof( event ) ) == static_cast<ssize_t>( sizeof( event ) ) ){
+        if( event.type == EV_KEY ){
+            auto key = translate_key( event.code );
+            if( key != Key::NONE && event.value >= 0 && event.value <= 2 ){
+                static constexpr Input_Action ACTIONS[] { Input_Action::RELEASE, Input_Action::PRESS, Input_Action::REPEAT };
+                push_input_event( ACTIONS[event.value], key );
+            }
+        }
+        if( event.type == EV_KEY && event.value == 1 ){
+            m_keys_down++;
+        }
+        else if( event.type == EV_KEY && event.value == 0 && m_keys_down > 0 ){
+            m_keys_down--;
+        }
+        activity |= event.type != EV_SYN;
+    }
+    return activity || m_keys_down > 0;
+}
+
+/********************************************/
+/*          Take the queued key events      */
+/********************************************/
+std::vector<Input_Event> Driver_FBDev::take_input_events()
+{
+    input_pending();
+    return Driver_Base::take_input_events();
+}
+
+/********************************************************/
+/*          Print the current frame to the screen       */
+/********************************************************/
+void Driver_FBDev::show( img::Frame& frame )
+{
+    m_rows_written = 0;
+    if( m_mapping == nullptr || frame.pixels().empty() ){
+        return;
+    }
+
+    const auto   src_format = img::pixel_format_from_channels( frame.channels() );
+    const size_t row_bytes  = frame.cols() * frame.channels();
+    const size_t cols       = std::min( frame.cols(), m_cols );
+    const size_t rows       = std::min( frame.rows(), m_rows );
+    const auto   pixels     = frame.pixels();
+
+    // Everything is damaged when there is nothing to compare against
+    const bool full_update = m_previous.size() != pixels.size();
+    if( full_update ){
+        m_previous.assign( pixels.begin(), pixels.end() );
+    }
+
+    for( size_t row = 0; row < rows; row++ ){
+        const uint8_t* src      = pixels.data() + row * row_bytes;
+        uint8_t*       previous = m_previous.data() + row * row_bytes;
+        if( !full_update && std::memcmp( src, previous, row_bytes ) == 0 ){
+            continue;
+        }
+        img::convert_row( src, src_format, m_mapping + row * m_stride, m_format, cols );
+        std::memcpy( previous, src, row_bytes );
+        m_rows_written++;
+    }
+}
+
+/********************************************/
+/*          Describe the framebuffer        */
+/********************************************/
+Driver_Capabilities Driver_FBDev::capabilities() const
+{
+    Driver_Capabilities caps;
+    caps.native_formats   = { m_format };
+    caps.partial_updates  = true;
+    caps.max_texture_size = math::Size2i( { static_cast<int>( m_cols ), static_cast<int>( m_rows ) } );
+
+    // Rows start wherever the stride puts them
+    caps.row_alignment = m_stride > 0 ? std::min<size_t>( m_stride & ( ~m_stride + 1 ), 64 ) : 1;
+
+    // The framebuffer is plain memory, so any thread may present
+    caps.threaded_show = true;
+    return caps;
+}
+
+/******************************************/
+/*        Get the screen dimensions       */
+/******************************************/
+img::Dimensions Driver_FBDev::get_screen_dimensions() const
+{
+    return img::Dimensions( m_cols, m_rows, 4 );
+}
+
+/************************************/
+/*          Load the Image          */
+/************************************/
+img::Frame::ptr_t Driver_FBDev::load_image( const std::filesystem::path& pathname )
+{
+    // Native frames are memory-mapped without decoding
+    if( pathname.extension() == ".tfrm" ){
+        return img::read_frame_file( pathname );
+    }
+
+    auto img = cv::imread( pathname.native(), cv::IMREAD_UNCHANGED );
+    if( img.empty() ){
+        std::stringstream sout;
+        sout << "Unable to load image: " << pathname.native();
+        throw std::runtime_error( sout.str() );
+    }
+    if( img.depth() != CV_8U ){
+        img.convertTo( img, CV_8U, 1.0 / 257.0 );
+    }
+
+    // OpenCV stores color as BGR(A)
+    img::PixelFormat format;
+    switch( img.channels() ){
+        case 1:  format = img::PixelFormat::GRAY;       break;
+        case 2:  format = img::PixelFormat::GRAY_ALPHA; break;
+        case 3:  format = img::PixelFormat::BGR;        break;
+        default: format = img::PixelFormat::BGRA;       break;
+    }
+
+    const size_t rows = static_cast<size_t>( img.rows );
+    return img::convert( std::span<const uint8_t>( img.data, img.step[0] * rows ),
+                         static_cast<size_t>( img.cols ),
+                         rows,
+                         img.step[0],
+                         format,
+                         img::PixelFormat::RGBA );
+}
+
+/************************************/
+/*          Rasterize Text          */
+/************************************/
+img::Frame::ptr_t Driver_FBDev::rasterize_text( const std::string& message )
+{
+    // If the message is empty, then return empty frame
+    if( message.empty() ){
+        LOG_WARNING( "Message is empty" );
+        return std::make_shared<img::Frame>();
+    }
+
+    // Draw anti-aliased coverage with OpenCV's built-in vector font
+    int  baseline = 0;
+    auto text_size = cv::getTextSize( message, cv::FONT_HERSHEY_SIMPLEX, TEXT_SCALE, 1, &baseline );
+    cv::Mat coverage( text_size.height + baseline + 2 * TEXT_PADDING,
+                      text_size.width + 2 * TEXT_PADDING,
+                      CV_8UC1,
+                      cv::Scalar( 0 ) );
+    cv::putText( coverage,
+                 message,
+                 cv::Point( TEXT_PADDING, TEXT_PADDING + text_size.height ),
+                 cv::FONT_HERSHEY_SIMPLEX,
+                 TEXT_SCALE,
+                 cv::Scalar( 255 ),
+                 1,
+                 cv::LINE_AA );
+
+    // Same color as the raylib driver, with the coverage as alpha
+    const size_t cols = static_cast<size_t>( coverage.cols );
+    const size_t rows = static_cast<size_t>( coverage.rows );
+    auto frame = std::make_shared<img::Frame>();
+    frame->resize( img::Dimensions( cols, rows, 4 ), 0 );
+    uint8_t* dst = frame->data();
+    for( size_t row = 0; row < rows; row++ ){
+        const uint8_t* src = coverage.data + row * coverage.step[0];
+        for( size_t col = 0; col < cols; col++, dst += 4 ){
+            dst[0] = 0;
+            dst[1] = 82;
+            dst[2] = 172;
+            dst[3] = src[col];
+        }
+    }
+    return frame;
+}
+
+/********************************************/
+/*          Print Log-Friendly String       */
+/********************************************/
+std::string Driver_FBDev::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+    std::stringstream sout;
+    sout << gap << "Driver_FBDev:" << std::endl;
+    sout << gap << "  - Device: " << m_device_path.native() << std::endl;
+    sout << gap << "  - Size: " << m_cols << " x " << m_rows << ", Stride: " << m_stride
+         << ", Format: " << img::to_string( m_format ) << std::endl;
+    sout << gap << "  - Input: " << ( m_input_fd >= 0 ? "open" : "none" ) << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Create new driver instance          */
+/************************************************/
+Driver_FBDev::ptr_t Driver_FBDev::create( core::Options& config )
+{
+    auto driver = Driver_FBDev::ptr_t( new Driver_FBDev() );
+
+    driver->initialize( config );
+    return driver;
+}
+
+/****************************************************/
+/*          Open and map the framebuffer            */
+/****************************************************/
+void Driver_FBDev::open_device( core::Options& config )
+{
+    m_device_path = config.setting<std::filesystem::path>( "fbdev", "device" ).value_or( DEFAULT_DEVICE );
+
+    m_fd = ::open( m_device_path.c_str(), O_RDWR | O_CLOEXEC );
+    if( m_fd < 0 ){
+        std::stringstream sout;
+        sout << "Unable to open framebuffer: " << m_device_path.native() << ", error: " << std::strerror( errno );
+        throw std::runtime_error( sout.str() );
+    }
+
+    struct stat file_info {};
+    if( fstat( m_fd, &file_info ) != 0 ){
+        throw std::runtime_error( "Unable to stat framebuffer: " + m_device_path.native() );
+    }
+
+    if( S_ISREG( file_info.st_mode ) ){
+
+        // A regular file stands in for the device, sized from the display settings
+        m_cols   = config.check_and_get_setting<size_t>( "display", "screen_width" );
+        m_rows   = config.check_and_get_setting<size_t>( "display", "screen_height" );
+        m_format = parse_pixel_format( config.setting<std::string>( "fbdev", "format" ).value_or( "BGRA" ) );
+        m_stride = m_cols * img::bytes_per_pixel( m_format );
+        m_map_bytes = m_stride * m_rows;
+
+        if( static_cast<size_t>( file_info.st_size ) < m_map_bytes &&
+            ftruncate( m_fd, static_cast<off_t>( m_map_bytes ) ) != 0 )
+        {
+            throw std::runtime_error( "Unable to grow framebuffer file: " + m_device_path.native() );
+        }
+    }
+    else {
+        fb_var_screeninfo var_info {};
+        fb_fix_screeninfo fix_info {};
+        if( ioctl( m_fd, FBIOGET_VSCREENINFO, &var_info ) != 0 ||
+            ioctl( m_fd, FBIOGET_FSCREENINFO, &fix_info ) != 0 )
+        {
+            std::stringstream sout;
+            sout << "Unable to query framebuffer: " << m_device_path.native() << ", error: " << std::strerror( errno );
+            throw std::runtime_error( sout.str() );
+        }
+        m_cols      = var_info.xres;
+        m_rows      = var_info.yres;
+        m_format    = pixel_format_from_screeninfo( var_info );
+        m_stride    = fix_info.line_length;
+        m_map_bytes = fix_info.smem_len;
+    }
+
+    void* mapping = mmap( nullptr, m_map_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0 );
+    if( mapping == MAP_FAILED ){
+        std::stringstream sout;
+        sout << "Unable to map framebuffer: " << m_device_path.native() << ", error: " << std::strerror( errno );
+        throw std::runtime_error( sout.str() );
+    }
+    m_mapping = static_cast<uint8_t*>( mapping );
+    m_previous.clear();
+}
+
+/********************************************/
+/*          Release the devices             */
+/********************************************/
+void Driver_FBDev::close_devices()
+{
+    if( m_mapping != nullptr ){
+        munmap( m_mapping, m_map_bytes );
+        m_mapping = nullptr;
+    }
+    if( m_fd >= 0 ){
+        ::close( m_fd );
+        m_fd = -1;
+    }
+    if( m_input_fd >= 0 ){
+        ::close( m_input_fd );
+        m_input_fd = -1;
+    }
+    m_previous.clear();
+}
+
+} // End of tmns::drv namespace
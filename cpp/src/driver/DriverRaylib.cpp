@@ -18,15 +18,59 @@
 
 // Project Libraries
 #include <terminus/driver/Raylib_Utilities.hpp>
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_File.hpp>
 #include <terminus/log/Logger.hpp>
 
 // OpenCV Libraries
 #include <opencv4/opencv2/imgcodecs.hpp>
-#include <opencv4/opencv2/imgproc.hpp>
-#include <opencv4/opencv2/highgui.hpp>
 
 namespace tmns::drv {
 
+namespace {
+
+/// Range of raylib key codes, from KEY_APOSTROPHE up to KEY_KB_MENU
+constexpr int FIRST_KEY { 32 };
+constexpr int LAST_KEY  { 348 };
+
+/// Mouse buttons to check, left through middle
+constexpr int NUM_MOUSE_BUTTONS { 3 };
+
+/************************************************/
+/*          Map a raylib key code to a Key      */
+/************************************************/
+Key translate_key( int code )
+{
+    // Printable keys already use their ASCII code
+    if( ( code >= KEY_A && code <= KEY_Z ) || ( code >= KEY_ZERO && code <= KEY_NINE ) ){
+        return static_cast<Key>( code );
+    }
+    switch( code ){
+        case KEY_SPACE:     return Key::SPACE;
+        case KEY_COMMA:     return Key::COMMA;
+        case KEY_MINUS:     return Key::MINUS;
+        case KEY_PERIOD:    return Key::PERIOD;
+        case KEY_SLASH:     return Key::SLASH;
+        case KEY_EQUAL:     return Key::EQUAL;
+        case KEY_UP:        return Key::UP;
+        case KEY_DOWN:      return Key::DOWN;
+        case KEY_LEFT:      return Key::LEFT;
+        case KEY_RIGHT:     return Key::RIGHT;
+        case KEY_ENTER:     return Key::ENTER;
+        case KEY_ESCAPE:    return Key::ESCAPE;
+        case KEY_BACKSPACE: return Key::BACKSPACE;
+        case KEY_TAB:       return Key::TAB;
+        case KEY_HOME:      return Key::HOME;
+        case KEY_END:       return Key::END;
+        case KEY_PAGE_UP:   return Key::PAGE_UP;
+        case KEY_PAGE_DOWN: return Key::PAGE_DOWN;
+        case KEY_DELETE:    return Key::DELETE;
+        default:            return Key::NONE;
+    }
+}
+
+} // End of anonymous namespace
+
 /****************************************/
 /*          Initialize Driver           */
 /****************************************/
@@ -38,7 +82,8 @@ bool Driver_Raylib::initialize( core::Options& config )
     // Setup OpenGL Context
     configure_display( config );
 
-    SetTargetFPS(30);
+    // Frames are paced by the application, so raylib must not sleep on its own
+    SetTargetFPS( 0 );
 
     return true;
 }
@@ -48,6 +93,10 @@ bool Driver_Raylib::initialize( core::Options& config )
 /****************************************/
 int Driver_Raylib::finalize()
 {
+    if( m_texture.id != 0 ){
+        UnloadTexture( m_texture );
+        m_texture = Texture2D{};
+    }
     CloseWindow();  
 
     return 0;
@@ -66,31 +115,117 @@ bool Driver_Raylib::okay_to_run()
     return okay_to_run;
 }
 
+/************************************************/
+/*          Check for user interaction          */
+/************************************************/
+bool Driver_Raylib::input_pending()
+{
+    // Key state is polled once per frame, and checking it does not consume the key queue
+    for( int key = FIRST_KEY; key <= LAST_KEY; key++ ){
+        if( IsKeyDown( key ) ){
+            return true;
+        }
+    }
+    for( int button = 0; button < NUM_MOUSE_BUTTONS; button++ ){
+        if( IsMouseButtonDown( button ) ){
+            return true;
+        }
+    }
+    return false;
+}
+
+/********************************************/
+/*          Take the queued key events      */
+/********************************************/
+std::vector<Input_Event> Driver_Raylib::take_input_events()
+{
+    // Presses come from raylib's key queue
+    for( int code = GetKeyPressed(); code != 0; code = GetKeyPressed() ){
+        auto key = translate_key( code );
+        if( key != Key::NONE ){
+            push_input_event( Input_Action::PRESS, key );
+            m_keys_held.push_back( code );
+        }
+    }
+
+    // Releases are found by checking the keys seen going down
+    std::erase_if( m_keys_held, [this]( int code ){
+        if( IsKeyDown( code ) ){
+            return false;
+        }
+        push_input_event( Input_Action::RELEASE, translate_key( code ) );
+        return true;
+    });
+    return Driver_Base::take_input_events();
+}
+
 /********************************************************/
 /*          Print the current frame to the screen       */
 /********************************************************/
 void Driver_Raylib::show( img::Frame& image )
 {
+    const auto   pixels    = image.pixels();
+    const size_t row_bytes = image.cols() * image.channels();
+
+    // The texture lives as long as the frame size does.  Only changed rows are uploaded.
+    if( m_texture.id == 0 || m_texture.width != image.size().width() || m_texture.height != image.size().height() ){
+        if( m_texture.id != 0 ){
+            UnloadTexture( m_texture );
+        }
+        Image img = {
+            .data = const_cast<uint8_t*>( pixels.data() ),
+            .width = image.size().width(),
+            .height = image.size().height(),
+            .mipmaps = 1,
+            .format = static_cast<int>(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) };
+        m_texture = LoadTextureFromImage( img );
+        SetTextureFilter( m_texture, m_scale_mode == Scale_Mode::INTEGER ? TEXTURE_FILTER_POINT
+                                                                         : TEXTURE_FILTER_BILINEAR );
+        m_previous.assign( pixels.begin(), pixels.end() );
+    }
+    else {
+        auto [first, last] = changed_rows( pixels, m_previous, row_bytes );
+        if( last > first ){
+            Rectangle band { 0,
+                             static_cast<float>( first ),
+                             static_cast<float>( image.cols() ),
+                             static_cast<float>( last - first ) };
+            UpdateTextureRec( m_texture, band, pixels.data() + first * row_bytes );
+        }
+    }
 
-    // Create raylib image
-    Image img = {
-        .data = &image.image_ref()[0],
-        .width = image.size().width(),
-        .height = image.size().height(),
-        .mipmaps = 1,
-        .format = static_cast<int>(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) };
-
-    // Generate Texture
-    Texture2D texture = LoadTextureFromImage(img);
+    // Scale the texture into the window, which may have been resized, and letterbox the rest
+    auto viewport = present_viewport( image.size(),
+                                      math::Size2i( { GetScreenWidth(), GetScreenHeight() } ),
+                                      m_scale_mode );
+    Rectangle source { 0, 0, static_cast<float>( m_texture.width ), static_cast<float>( m_texture.height ) };
+    Rectangle dest { static_cast<float>( viewport.bl().x() ),
+                     static_cast<float>( viewport.bl().y() ),
+                     static_cast<float>( viewport.width() ),
+                     static_cast<float>( viewport.height() ) };
 
     // Put texture onto frame 
     BeginDrawing();
 
-    ClearBackground(RAYWHITE);
-    DrawTexture(texture, 0, 0, WHITE);
+    ClearBackground(BLACK);
+    DrawTexturePro( m_texture, source, dest, Vector2{ 0, 0 }, 0, WHITE );
     EndDrawing();
+}
 
-    UnloadTexture( texture );
+/****************************************/
+/*          Describe the display        */
+/****************************************/
+Driver_Capabilities Driver_Raylib::capabilities() const
+{
+    Driver_Capabilities caps;
+
+    // Frames go straight into an RGBA texture, using OpenGL's default unpack alignment.
+    // raylib does not expose GL_MAX_TEXTURE_SIZE, so no limit is reported.
+    caps.native_formats  = { img::PixelFormat::RGBA };
+    caps.partial_updates = true;
+    caps.row_alignment   = 4;
+    caps.vsync           = m_vsync;
+    return caps;
 }
 
 /******************************************/
@@ -98,7 +233,7 @@ void Driver_Raylib::show( img::Frame& image )
 /******************************************/
 img::Dimensions Driver_Raylib::get_screen_dimensions() const
 {
-    return img::Dimensions( m_window_cols, m_window_rows, 4 );
+    return img::Dimensions( m_render_cols, m_render_rows, 4 );
 }
 
 /************************************/
@@ -106,21 +241,38 @@ img::Dimensions Driver_Raylib::get_screen_dimensions() const
 /************************************/
 img::Frame::ptr_t Driver_Raylib::load_image( const std::filesystem::path& pathname )
 {
-    auto img = cv::imread( pathname.native(), cv::IMREAD_COLOR );
+    // Native frames are memory-mapped without decoding
+    if( pathname.extension() == ".tfrm" ){
+        return img::read_frame_file( pathname );
+    }
 
-    // Make sure the image is 4 channels
-    cv::cvtColor( img, img, cv::COLOR_BGR2RGBA );
-    //cv::imshow( "PRE", img );
-    //cv::waitKey(0);
-    
-    std::span<char> image_span( reinterpret_cast<char*>(img.data),
-                                static_cast<size_t>(img.cols) * static_cast<size_t>(img.rows) * static_cast<size_t>(img.channels()) );
+    auto img = cv::imread( pathname.native(), cv::IMREAD_UNCHANGED );
+    if( img.empty() ){
+        std::stringstream sout;
+        sout << "Unable to load image: " << pathname.native();
+        throw std::runtime_error( sout.str() );
+    }
+    if( img.depth() != CV_8U ){
+        img.convertTo( img, CV_8U, 1.0 / 257.0 );
+    }
+
+    // OpenCV stores color as BGR(A)
+    img::PixelFormat format;
+    switch( img.channels() ){
+        case 1:  format = img::PixelFormat::GRAY;       break;
+        case 2:  format = img::PixelFormat::GRAY_ALPHA; break;
+        case 3:  format = img::PixelFormat::BGR;        break;
+        default: format = img::PixelFormat::BGRA;       break;
+    }
 
     // build new frame instance
-    auto frame = std::make_shared<img::Frame>( image_span, 
-                                               img::Dimensions( static_cast<size_t>(img.cols), 
-                                                                static_cast<size_t>(img.rows),
-                                                                static_cast<size_t>(img.channels()) ) );
+    const size_t rows = static_cast<size_t>( img.rows );
+    auto frame = img::convert( std::span<const uint8_t>( img.data, img.step[0] * rows ),
+                               static_cast<size_t>( img.cols ),
+                               rows,
+                               img.step[0],
+                               format,
+                               img::PixelFormat::RGBA );
 
     return frame;
 }
@@ -139,16 +291,18 @@ img::Frame::ptr_t Driver_Raylib::rasterize_text( const std::string& message )
     // Create image from text
     auto text_image = ImageText( message.c_str(), 16, DARKBLUE );
 
-    size_t nchannels = raylib_format_to_channels(static_cast<PixelFormat>(text_image.format));
-    
-    std::span<char> image_span( reinterpret_cast<char*>(text_image.data),
-                                static_cast<size_t>(text_image.width) * static_cast<size_t>(text_image.height) * nchannels );
-                                    
-    // build new frame instance
-    auto frame = std::make_shared<img::Frame>( image_span, 
-                                               img::Dimensions( static_cast<size_t>(text_image.width), 
-                                                                static_cast<size_t>(text_image.height),
-                                                                nchannels ) );
+    // Expand whatever raylib produced into RGBA
+    const auto format = raylib_format_to_pixel_format( static_cast<PixelFormat>( text_image.format ) );
+    const size_t cols = static_cast<size_t>( text_image.width );
+    const size_t rows = static_cast<size_t>( text_image.height );
+    const size_t stride = cols * img::bytes_per_pixel( format );
+
+    auto frame = img::convert( std::span<const uint8_t>( static_cast<const uint8_t*>( text_image.data ), stride * rows ),
+                               cols,
+                               rows,
+                               stride,
+                               format,
+                               img::PixelFormat::RGBA );
 
     // Delete image
     UnloadImage( text_image );
@@ -166,7 +320,10 @@ std::string Driver_Raylib::to_log_string( size_t offset ) const
     std::string gap( offset, ' ' );
     std::stringstream sout;
     sout << gap << "Driver_Raylib:" << std::endl;
-    
+    sout << gap << "  - Render Size: " << m_render_cols << " x " << m_render_rows << std::endl;
+    sout << gap << "  - Window Size: " << m_window_cols << " x " << m_window_rows
+         << ", Scale Mode: " << to_string( m_scale_mode ) << std::endl;
+
     return sout.str();
 }
 
@@ -189,9 +346,11 @@ void Driver_Raylib::configure_display( core::Options& config )
 {
     if( config.setting<bool>( "display", "override_screen_size" ) ){
 
-        // Get size parameters
-        m_window_cols = config.check_and_get_setting<size_t>( "display", "screen_width" );
-        m_window_rows = config.check_and_get_setting<size_t>( "display", "screen_height" );
+        // Get size parameters.  The window defaults to the render size.
+        m_render_cols = config.check_and_get_setting<size_t>( "display", "screen_width" );
+        m_render_rows = config.check_and_get_setting<size_t>( "display", "screen_height" );
+        m_window_cols = config.setting<size_t>( "display", "window_width" ).value_or( m_render_cols );
+        m_window_rows = config.setting<size_t>( "display", "window_height" ).value_or( m_render_rows );
     }
 
     // Currently not implemented
@@ -199,9 +358,25 @@ void Driver_Raylib::configure_display( core::Options& config )
         throw std::runtime_error( "Unable to get display settings at this time.");
     }
 
+    m_scale_mode = scale_mode_from_string( config.setting<std::string>( "display", "scale_mode" ).value_or( "integer" ) );
+
+    // Window flags have to be set before the window opens
+    unsigned int flags = 0;
+    m_vsync = config.setting<bool>( "display", "vsync" ).value_or( false );
+    if( m_vsync ){
+        flags |= FLAG_VSYNC_HINT;
+    }
+    if( config.setting<bool>( "display", "resizable" ).value_or( false ) ){
+        flags |= FLAG_WINDOW_RESIZABLE;
+    }
+    if( flags != 0 ){
+        SetConfigFlags( flags );
+    }
+
     InitWindow( static_cast<int>(m_window_cols),
                 static_cast<int>(m_window_rows),
                 "Terminus Converter Application" );
+    LOG_DEBUG( to_log_string() );
 }
 
 } // End of tmns::drv namespace
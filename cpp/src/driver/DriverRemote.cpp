@@ -0,0 +1,350 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverRemote.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Serves the screen to remote viewers and takes their key input.
+ */
+#include <terminus/driver/DriverRemote.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#include <terminus/log/Logger.hpp>
+
+// POSIX Libraries
+#include <unistd.h>
+
+namespace tmns::drv {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Driver_Remote::Driver_Remote( Driver_Base::ptr_t     display,
+                              img::Dimensions        dims,
+                              const Remote_Endpoint& endpoint,
+                              Limits                 limits )
+    : m_display { std::move( display ) },
+      m_dims { dims.cols(), dims.rows(), 4 },
+      m_endpoint { endpoint },
+      m_limits { limits },
+      m_listen_fd { Remote_Connection::listen( endpoint ) },
+      m_encoder { limits.keyframe_interval }
+{
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Driver_Remote::~Driver_Remote()
+{
+    close_sockets();
+}
+
+/****************************************/
+/*          Initialize Driver           */
+/****************************************/
+bool Driver_Remote::initialize( core::Options& )
+{
+    return true;
+}
+
+/****************************************/
+/*            Finalize Driver           */
+/****************************************/
+int Driver_Remote::finalize()
+{
+    if( m_listen_fd >= 0 ){
+        LOG_INFO( to_log_string() );
+    }
+    close_sockets();
+
+    int ecode = 0;
+    if( m_display ){
+        ecode = m_display->finalize();
+        m_display.reset();
+    }
+    return ecode;
+}
+
+/********************************************/
+/*          Check if we should exit         */
+/********************************************/
+bool Driver_Remote::okay_to_run()
+{
+    service();
+    return m_display ? m_display->okay_to_run() : true;
+}
+
+/************************************************/
+/*          Check for user interaction          */
+/************************************************/
+bool Driver_Remote::input_pending()
+{
+    service();
+    return m_input_waiting || ( m_display && m_display->input_pending() );
+}
+
+/************************************************/
+/*          Take every key event                */
+/************************************************/
+std::vector<Input_Event> Driver_Remote::take_input_events()
+{
+    service();
+    m_input_waiting = false;
+
+    auto events = Driver_Base::take_input_events();
+    if( m_display ){
+        auto local = m_display->take_input_events();
+        events.insert( events.end(), local.begin(), local.end() );
+    }
+    return events;
+}
+
+/************************************************/
+/*          Wait for the user or the deadline   */
+/************************************************/
+bool Driver_Remote::wait_for_input( std::chrono::steady_clock::time_point until,
+                                    std::chrono::steady_clock::duration   poll_interval )
+{
+    // Headless, the base class polls input_pending(), which services the sockets
+    if( !m_display ){
+        return Driver_Base::wait_for_input( until, poll_interval );
+    }
+
+    // Otherwise wait on the display a slice at a time, checking the viewers in between
+    while( true ){
+        if( service() ){
+            return true;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if( now >= until ){
+            return false;
+        }
+        if( m_display->wait_for_input( std::min( until, now + poll_interval ), poll_interval ) ){
+            return true;
+        }
+    }
+}
+
+/********************************************************/
+/*          Forward the frame and send the changes      */
+/********************************************************/
+void Driver_Remote::show( img::Frame& frame )
+{
+    if( m_display ){
+        m_display->show( frame );
+    }
+
+    // Nobody to send to.  New viewers get a keyframe anyway.
+    if( m_clients.empty() || !m_encoder.encode( frame, m_packet ) ){
+        service();
+        return;
+    }
+
+    bool resync = false;
+    for( auto& client : m_clients ){
+        client->send( Remote_Message::FRAME, m_packet );
+        m_stats.frames_sent++;
+        m_stats.bytes_sent += m_packet.size();
+
+        // A viewer this far behind is better off starting again from a keyframe
+        if( client->pending_bytes() > m_limits.max_pending_bytes ){
+            client->drop_queued();
+            m_stats.resyncs++;
+            resync = true;
+        }
+    }
+    if( resync ){
+        m_encoder.request_keyframe();
+    }
+    service();
+}
+
+/****************************************/
+/*          Describe the display        */
+/****************************************/
+Driver_Capabilities Driver_Remote::capabilities() const
+{
+    Driver_Capabilities caps;
+    if( m_display ){
+        caps = m_display->capabilities();
+    }
+    else {
+        caps.partial_updates = true;
+    }
+    caps.threaded_show = false;
+    return caps;
+}
+
+/******************************************/
+/*        Get the screen dimensions       */
+/******************************************/
+img::Dimensions Driver_Remote::get_screen_dimensions() const
+{
+    return m_display ? m_display->get_screen_dimensions() : m_dims;
+}
+
+/************************************/
+/*          Load the Image          */
+/************************************/
+img::Frame::ptr_t Driver_Remote::load_image( const std::filesystem::path& path )
+{
+    return m_display ? m_display->load_image( path ) : headless_image( path );
+}
+
+/************************************/
+/*          Rasterize Text          */
+/************************************/
+img::Frame::ptr_t Driver_Remote::rasterize_text( const std::string& message )
+{
+    return m_display ? m_display->rasterize_text( message ) : headless_text( message );
+}
+
+/********************************************/
+/*          Print Log-Friendly String       */
+/********************************************/
+std::string Driver_Remote::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Driver_Remote:" << std::endl;
+    sout << gap << "  - Listen: " << m_endpoint.to_string()
+         << ", Display: " << ( m_display ? "forwarded" : "headless" ) << std::endl;
+    sout << gap << "  - Viewers: " << m_clients.size() << ", Accepted: " << m_stats.clients_accepted
+         << ", Refused: " << m_stats.clients_refused << std::endl;
+    sout << gap << "  - Frames Sent: " << m_stats.frames_sent << ", Bytes Sent: " << m_stats.bytes_sent
+         << ", Resyncs: " << m_stats.resyncs << ", Input Events: " << m_stats.input_events << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Create new driver instance          */
+/************************************************/
+Driver_Remote::ptr_t Driver_Remote::create( core::Options&     config,
+                                            Driver_Base::ptr_t display )
+{
+    img::Dimensions dims;
+    if( display ){
+        dims = display->get_screen_dimensions();
+    }
+    else {
+        dims = img::Dimensions( config.check_and_get_setting<size_t>( "display", "screen_width" ),
+                                config.check_and_get_setting<size_t>( "display", "screen_height" ),
+                                4 );
+    }
+
+    Limits limits;
+    limits.max_clients       = config.setting<size_t>( "remote", "max_clients" ).value_or( limits.max_clients );
+    limits.max_pending_bytes = config.setting<size_t>( "remote", "max_pending_kb" ).value_or( limits.max_pending_bytes / 1024 ) * 1024;
+    limits.keyframe_interval = config.setting<size_t>( "remote", "keyframe_interval" ).value_or( limits.keyframe_interval );
+
+    auto endpoint = Remote_Endpoint::parse( config.setting<std::string>( "remote", "listen" ).value_or( DEFAULT_LISTEN ) );
+    auto driver   = std::make_unique<Driver_Remote>( std::move( display ), dims, endpoint, limits );
+    driver->initialize( config );
+    LOG_INFO( "Serving the screen on " + endpoint.to_string() );
+    return driver;
+}
+
+/****************************************************/
+/*          Service the viewers                     */
+/****************************************************/
+bool Driver_Remote::service()
+{
+    if( m_listen_fd < 0 ){
+        return false;
+    }
+
+    // Greet new viewers and make sure they start from a keyframe
+    // Viewers only send input and keyframe requests, so anything larger is refused from its
+    // header and at most a few KB is ever buffered per viewer
+    const auto accept = [this](){ return Remote_Connection::accept( m_listen_fd, Remote_Protocol::MAX_VIEWER_PAYLOAD_BYTES ); };
+    for( auto client = accept(); client; client = accept() ){
+        if( m_clients.size() >= m_limits.max_clients ){
+            m_stats.clients_refused++;
+            LOG_WARNING( "Refusing remote viewer, already serving " + std::to_string( m_clients.size() ) );
+            continue;
+        }
+
+        uint8_t hello[Remote_Protocol::HELLO_BYTES] {};
+        std::copy( Remote_Protocol::MAGIC.begin(), Remote_Protocol::MAGIC.end(), hello );
+        core::write_le<uint16_t>( hello + 4, Remote_Protocol::VERSION );
+        client->send( Remote_Message::HELLO, hello );
+
+        m_clients.push_back( std::move( client ) );
+        m_encoder.request_keyframe();
+        m_stats.clients_accepted++;
+        LOG_INFO( "Remote viewer connected on " + m_endpoint.to_string() );
+    }
+
+    // Read input and send backlogs, dropping viewers that went away or misbehaved
+    bool got_input = false;
+    std::erase_if( m_clients, [&]( auto& client ){
+        try {
+            if( !client->receive() || !client->flush() ){
+                LOG_INFO( "Remote viewer disconnected" );
+                return true;
+            }
+
+            Remote_Message type;
+            while( client->next_message( type, m_payload ) ){
+                if( type == Remote_Message::INPUT && m_payload.size() == Remote_Protocol::INPUT_BYTES &&
+                    m_payload[0] >= static_cast<uint8_t>( Input_Action::PRESS ) &&
+                    m_payload[0] <= static_cast<uint8_t>( Input_Action::REPEAT ) )
+                {
+                    push_input_event( static_cast<Input_Action>( m_payload[0] ),
+                                      static_cast<Key>( core::read_le<uint16_t>( m_payload.data() + 1 ) ) );
+                    m_stats.input_events++;
+                    got_input = true;
+                }
+                else if( type == Remote_Message::KEYFRAME ){
+                    m_encoder.request_keyframe();
+                }
+                else {
+                    throw std::runtime_error( "Unexpected " + to_string( type ) + " message from viewer" );
+                }
+            }
+        }
+        catch( const std::exception& e ){
+            LOG_WARNING( std::string( "Dropping remote viewer: " ) + e.what() );
+            return true;
+        }
+        return false;
+    });
+
+    m_input_waiting |= got_input;
+    return got_input;
+}
+
+/****************************************************/
+/*          Close every socket                      */
+/****************************************************/
+void Driver_Remote::close_sockets()
+{
+    m_clients.clear();
+    if( m_listen_fd >= 0 ){
+        ::close( m_listen_fd );
+        m_listen_fd = -1;
+        if( m_endpoint.kind == Remote_Endpoint::Kind::UNIX ){
+            std::error_code error;
+            std::filesystem::remove( m_endpoint.address, error );
+        }
+    }
+}
+
+} // End of tmns::drv namespace
@@ -0,0 +1,447 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverReplay.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Records key input, or replays it, and times every frame.
+ */
+#include <terminus/driver/DriverReplay.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/ConfigParser.hpp>
+#include <terminus/log/Logger.hpp>
+
+namespace tmns::drv {
+
+namespace {
+
+/// Settings which only control recording and replay, so may differ between the two runs
+const std::string INPUT_SECTION { "input" };
+
+/************************************************/
+/*          Frame time at a percentile          */
+/************************************************/
+std::chrono::microseconds percentile( const std::vector<std::chrono::microseconds>& sorted,
+                                      size_t                                        percent )
+{
+    const size_t rank = ( sorted.size() * percent + 99 ) / 100;
+    return sorted[std::max<size_t>( rank, 1 ) - 1];
+}
+
+/************************************************/
+/*          Setting value, if there is one      */
+/************************************************/
+std::string lookup_setting( const core::ConfigParser::SETTINGS_TYPE& settings,
+                            const std::string&                       section,
+                            const std::string&                       key )
+{
+    auto sec_iter = settings.find( section );
+    if( sec_iter == settings.end() ){
+        return "<unset>";
+    }
+    auto key_iter = sec_iter->second.find( key );
+    return key_iter == sec_iter->second.end() ? "<unset>" : key_iter->second;
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Convert to string   */
+/********************************/
+std::string to_string( Replay_Mode mode )
+{
+    switch( mode ){
+        case Replay_Mode::RECORD: return "RECORD";
+        case Replay_Mode::REPLAY: return "REPLAY";
+    }
+    return "UNKNOWN";
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Frame_Time_Report::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Frame_Time_Report:" << std::endl;
+    sout << gap << "  - Frames: " << frames << std::endl;
+    sout << gap << "  - Mean: " << mean.count() << " us, P50: " << p50.count() << " us, P95: "
+         << p95.count() << " us, P99: " << p99.count() << " us, Max: " << max.count() << " us" << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Summarize the frame times           */
+/************************************************/
+Frame_Time_Report Frame_Time_Report::from_times( const std::vector<std::chrono::microseconds>& times )
+{
+    Frame_Time_Report report;
+    report.frames = times.size();
+    if( times.empty() ){
+        return report;
+    }
+
+    auto sorted = times;
+    std::sort( sorted.begin(), sorted.end() );
+
+    auto total  = std::accumulate( sorted.begin(), sorted.end(), std::chrono::microseconds( 0 ) );
+    report.mean = total / static_cast<int64_t>( sorted.size() );
+    report.p50  = percentile( sorted, 50 );
+    report.p95  = percentile( sorted, 95 );
+    report.p99  = percentile( sorted, 99 );
+    report.max  = sorted.back();
+    return report;
+}
+
+/****************************************/
+/*          Recording Constructor       */
+/****************************************/
+Driver_Replay::Driver_Replay( Driver_Base::ptr_t            display,
+                              img::Dimensions               dims,
+                              Input_Recording_Writer::ptr_t writer )
+    : m_display { std::move( display ) },
+      m_dims { dims.cols(), dims.rows(), 4 },
+      m_mode { Replay_Mode::RECORD },
+      m_writer { std::move( writer ) },
+      m_start { std::chrono::steady_clock::now() }
+{
+}
+
+/****************************************/
+/*          Replay Constructor          */
+/****************************************/
+Driver_Replay::Driver_Replay( Driver_Base::ptr_t            display,
+                              img::Dimensions               dims,
+                              Input_Recording_Reader::ptr_t reader )
+    : m_display { std::move( display ) },
+      m_dims { dims.cols(), dims.rows(), 4 },
+      m_mode { Replay_Mode::REPLAY },
+      m_reader { std::move( reader ) },
+      m_start { std::chrono::steady_clock::now() }
+{
+    // A recording cut short by a crash still plays up to its last event
+    if( m_reader->frame_count() ){
+        m_last_frame = m_reader->frame_count().value();
+    }
+    else if( !m_reader->records().empty() ){
+        m_last_frame = m_reader->records().back().frame;
+    }
+}
+
+/****************************************/
+/*          Initialize Driver           */
+/****************************************/
+bool Driver_Replay::initialize( core::Options& config )
+{
+    m_report_path = config.setting<std::filesystem::path>( "input", "replay_report" );
+    auto budget   = config.setting<size_t>( "input", "frame_budget_us" );
+    if( budget ){
+        m_frame_budget = std::chrono::microseconds( static_cast<int64_t>( budget.value() ) );
+    }
+
+    if( m_mode == Replay_Mode::REPLAY ){
+        check_config( config );
+    }
+    return true;
+}
+
+/****************************************/
+/*            Finalize Driver           */
+/****************************************/
+int Driver_Replay::finalize()
+{
+    int ecode = 0;
+
+    if( m_writer ){
+        m_writer->finish( m_frame );
+        LOG_DEBUG( m_writer->to_log_string() );
+        m_writer.reset();
+    }
+
+    if( !m_frame_times.empty() ){
+        auto report = Frame_Time_Report::from_times( m_frame_times );
+        LOG_INFO( to_log_string() + report.to_log_string( 2 ) );
+
+        if( m_report_path ){
+            write_report( m_report_path.value() );
+        }
+        if( m_frame_budget && report.p95 > m_frame_budget.value() ){
+            std::stringstream sout;
+            sout << "95th percentile frame time of " << report.p95.count() << " us exceeds the budget of "
+                 << m_frame_budget.value().count() << " us";
+            LOG_ERROR( sout.str() );
+            ecode = 1;
+        }
+        m_frame_times.clear();
+    }
+
+    if( m_display ){
+        ecode |= m_display->finalize();
+        m_display.reset();
+    }
+    return ecode;
+}
+
+/********************************************/
+/*          Start the next frame            */
+/********************************************/
+bool Driver_Replay::okay_to_run()
+{
+    // The window can still be closed during a replay
+    if( m_display && !m_display->okay_to_run() ){
+        return false;
+    }
+
+    // The user is ignored while replaying
+    if( m_mode == Replay_Mode::REPLAY && m_display ){
+        m_display->take_input_events();
+    }
+
+    if( m_mode == Replay_Mode::REPLAY && m_frame >= m_last_frame ){
+        return false;
+    }
+
+    m_frame++;
+    m_frame_start = std::chrono::steady_clock::now();
+    return true;
+}
+
+/************************************************/
+/*          Check for user interaction          */
+/************************************************/
+bool Driver_Replay::input_pending()
+{
+    if( m_mode == Replay_Mode::RECORD ){
+        return m_display ? m_display->input_pending() : false;
+    }
+    const auto& records = m_reader->records();
+    return m_next_event < records.size() && records[m_next_event].frame <= m_frame;
+}
+
+/************************************************/
+/*          Take this frame's key events        */
+/************************************************/
+std::vector<Input_Event> Driver_Replay::take_input_events()
+{
+    if( m_mode == Replay_Mode::RECORD ){
+        auto events = m_display ? m_display->take_input_events() : Driver_Base::take_input_events();
+        for( const auto& event : events ){
+            Input_Record record;
+            record.frame     = m_frame;
+            record.timestamp = std::chrono::duration_cast<std::chrono::microseconds>( event.time - m_start );
+            record.action    = event.action;
+            record.key       = event.key;
+            m_writer->write( record );
+        }
+        return events;
+    }
+
+    // Events keep the frame they were recorded on.  Their timestamps are only informational.
+    std::vector<Input_Event> events;
+    const auto& records = m_reader->records();
+    const auto  now     = std::chrono::steady_clock::now();
+    while( m_next_event < records.size() && records[m_next_event].frame <= m_frame ){
+        const auto& record = records[m_next_event++];
+        events.push_back( Input_Event{ now, record.action, record.key } );
+    }
+    return events;
+}
+
+/************************************************/
+/*          Wait for the user or the deadline   */
+/************************************************/
+bool Driver_Replay::wait_for_input( std::chrono::steady_clock::time_point until,
+                                    std::chrono::steady_clock::duration   poll_interval )
+{
+    if( m_mode == Replay_Mode::REPLAY ){
+        return true;
+    }
+    if( !m_display ){
+        return Driver_Base::wait_for_input( until, poll_interval );
+    }
+    return m_display->wait_for_input( until, poll_interval );
+}
+
+/****************************************************/
+/*          Forward the frame and time it           */
+/****************************************************/
+void Driver_Replay::show( img::Frame& frame )
+{
+    if( m_display ){
+        m_display->show( frame );
+    }
+    if( m_frame > 0 ){
+        m_frame_times.push_back( std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - m_frame_start ) );
+    }
+}
+
+/****************************************/
+/*          Describe the display        */
+/****************************************/
+Driver_Capabilities Driver_Replay::capabilities() const
+{
+    Driver_Capabilities caps;
+    if( m_display ){
+        caps = m_display->capabilities();
+    }
+    else {
+        caps.partial_updates = true;
+    }
+
+    // Frames are timed up to the end of show(), which must then run on the render thread
+    caps.threaded_show = false;
+    return caps;
+}
+
+/******************************************/
+/*        Get the screen dimensions       */
+/******************************************/
+img::Dimensions Driver_Replay::get_screen_dimensions() const
+{
+    return m_display ? m_display->get_screen_dimensions() : m_dims;
+}
+
+/************************************/
+/*          Load the Image          */
+/************************************/
+img::Frame::ptr_t Driver_Replay::load_image( const std::filesystem::path& path )
+{
+    if( m_display ){
+        return m_display->load_image( path );
+    }
+    return headless_image( path );
+}
+
+/************************************/
+/*          Rasterize Text          */
+/************************************/
+img::Frame::ptr_t Driver_Replay::rasterize_text( const std::string& message )
+{
+    if( m_display ){
+        return m_display->rasterize_text( message );
+    }
+    return headless_text( message );
+}
+
+/********************************************/
+/*          Print Log-Friendly String       */
+/********************************************/
+std::string Driver_Replay::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Driver_Replay:" << std::endl;
+    sout << gap << "  - Mode: " << to_string( m_mode )
+         << ", Display: " << ( m_display ? "forwarded" : "headless" ) << std::endl;
+    sout << gap << "  - Frames: " << m_frame;
+    if( m_mode == Replay_Mode::REPLAY ){
+        sout << " of " << m_last_frame << ", Events: " << m_next_event << " of " << m_reader->records().size();
+    }
+    sout << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Create new driver instance          */
+/************************************************/
+Driver_Replay::ptr_t Driver_Replay::create( core::Options&     config,
+                                            Driver_Base::ptr_t display )
+{
+    auto record_path = config.setting<std::filesystem::path>( "input", "record_path" );
+    auto replay_path = config.setting<std::filesystem::path>( "input", "replay_path" );
+    if( record_path.has_value() == replay_path.has_value() ){
+        throw std::runtime_error( "Set exactly one of [input] record_path and replay_path" );
+    }
+
+    img::Dimensions dims;
+    if( display ){
+        dims = display->get_screen_dimensions();
+    }
+    else {
+        dims = img::Dimensions( config.check_and_get_setting<size_t>( "display", "screen_width" ),
+                                config.check_and_get_setting<size_t>( "display", "screen_height" ),
+                                4 );
+    }
+
+    Driver_Replay::ptr_t driver;
+    if( record_path ){
+        auto writer = Input_Recording_Writer::create( record_path.value(),
+                                                      core::ConfigParser::to_string( config.settings() ) );
+        driver = std::make_unique<Driver_Replay>( std::move( display ), dims, std::move( writer ) );
+    }
+    else {
+        auto reader = Input_Recording_Reader::open( replay_path.value() );
+        driver = std::make_unique<Driver_Replay>( std::move( display ), dims, std::move( reader ) );
+    }
+    driver->initialize( config );
+    LOG_DEBUG( driver->to_log_string() );
+    return driver;
+}
+
+/********************************************************/
+/*          Compare against the recorded settings       */
+/********************************************************/
+void Driver_Replay::check_config( const core::Options& config ) const
+{
+    std::istringstream sin( m_reader->config_text() );
+    auto recorded = core::ConfigParser::parse( sin );
+    auto current  = config.settings();
+    recorded.erase( INPUT_SECTION );
+    current.erase( INPUT_SECTION );
+
+    // Collect every section and key present in either run
+    auto keys = recorded;
+    for( const auto& [section, values] : current ){
+        keys[section].insert( values.begin(), values.end() );
+    }
+
+    for( const auto& [section, values] : keys ){
+        for( const auto& [key, unused] : values ){
+            auto was = lookup_setting( recorded, section, key );
+            auto now = lookup_setting( current, section, key );
+            if( was != now ){
+                LOG_WARNING( "Replay setting [" + section + "] " + key + " is " + now +
+                             ", but was " + was + " when recorded" );
+            }
+        }
+    }
+}
+
+/************************************************/
+/*          Write the per-frame times           */
+/************************************************/
+void Driver_Replay::write_report( const std::filesystem::path& pathname ) const
+{
+    std::ofstream fout( pathname );
+    if( !fout.good() ){
+        LOG_ERROR( "Unable to write frame report: " + pathname.native() );
+        return;
+    }
+    fout << "frame,time_us" << std::endl;
+    for( size_t i = 0; i < m_frame_times.size(); i++ ){
+        fout << ( i + 1 ) << "," << m_frame_times[i].count() << std::endl;
+    }
+    LOG_DEBUG( "Wrote frame report to " + pathname.native() );
+}
+
+} // End of tmns::drv namespace
@@ -0,0 +1,443 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    DriverSPISim.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Simulates pushing frames to an SPI display panel.
+ */
+#include <terminus/driver/DriverSPISim.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+// Project Libraries
+#include <terminus/image/Convert.hpp>
+#include <terminus/log/Logger.hpp>
+
+namespace tmns::drv {
+
+namespace {
+
+/// Column-address and row-address commands each take a command byte and four parameter bytes,
+/// and the memory write that follows takes one
+constexpr size_t WINDOW_COMMANDS      { 3 };
+constexpr size_t WINDOW_COMMAND_BYTES { 11 };
+
+/************************************************/
+/*          Time to clock bytes onto the bus    */
+/************************************************/
+std::chrono::nanoseconds wire_time( size_t bytes, size_t clock_hz )
+{
+    const uint64_t bits = static_cast<uint64_t>( bytes ) * 8;
+    return std::chrono::nanoseconds( static_cast<int64_t>( bits * 1'000'000'000ULL / std::max<size_t>( clock_hz, 1 ) ) );
+}
+
+/************************************************/
+/*          Add one transfer to another         */
+/************************************************/
+void accumulate( Driver_SPI_Sim::Transfer&       total,
+                 const Driver_SPI_Sim::Transfer& transfer )
+{
+    total.rects       += transfer.rects;
+    total.commands    += transfer.commands;
+    total.pixel_bytes += transfer.pixel_bytes;
+    total.dma_chunks  += transfer.dma_chunks;
+    total.duration    += transfer.duration;
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*      Convert to String       */
+/********************************/
+std::string to_string( SPI_Update_Mode mode )
+{
+    switch( mode ){
+        case SPI_Update_Mode::FULL:
+            return "FULL";
+        case SPI_Update_Mode::ROWS:
+            return "ROWS";
+        case SPI_Update_Mode::RECTS:
+            return "RECTS";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/****************************************/
+/*          Parse a mode name           */
+/****************************************/
+SPI_Update_Mode spi_update_mode_from_string( const std::string& name )
+{
+    for( auto mode : { SPI_Update_Mode::FULL, SPI_Update_Mode::ROWS, SPI_Update_Mode::RECTS } ){
+        std::string upper( name );
+        std::transform( upper.begin(), upper.end(), upper.begin(),
+                        []( unsigned char c ){ return static_cast<char>( std::toupper( c ) ); } );
+        if( to_string( mode ) == upper ){
+            return mode;
+        }
+    }
+    std::stringstream sout;
+    sout << "Unknown SPI update mode: " << name << ". Expected full, rows or rects.";
+    throw std::runtime_error( sout.str() );
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string SPI_Bus_Config::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "SPI_Bus_Config:" << std::endl;
+    sout << gap << "  - Clock: " << clock_hz << " Hz, Wire Format: " << img::to_string( wire_format )
+         << ", Update Mode: " << to_string( update_mode ) << std::endl;
+    sout << gap << "  - Command Overhead: " << command_overhead.count() << " ns, DMA Chunk: "
+         << dma_chunk_bytes << " bytes, DMA Setup: " << dma_setup.count() << " ns" << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Build from the configuration        */
+/************************************************/
+SPI_Bus_Config SPI_Bus_Config::from_config( core::Options& config )
+{
+    SPI_Bus_Config bus;
+    bus.clock_hz         = config.setting<size_t>( "spi_sim", "clock_hz" ).value_or( bus.clock_hz );
+    bus.command_overhead = std::chrono::nanoseconds( config.setting<size_t>( "spi_sim", "command_overhead_ns" )
+                                                           .value_or( static_cast<size_t>( bus.command_overhead.count() ) ) );
+    bus.dma_chunk_bytes  = std::max<size_t>( 1, config.setting<size_t>( "spi_sim", "dma_chunk_bytes" ).value_or( bus.dma_chunk_bytes ) );
+    bus.dma_setup        = std::chrono::nanoseconds( config.setting<size_t>( "spi_sim", "dma_setup_ns" )
+                                                           .value_or( static_cast<size_t>( bus.dma_setup.count() ) ) );
+    bus.realtime         = config.setting<bool>( "spi_sim", "realtime" ).value_or( bus.realtime );
+
+    auto mode = config.setting<std::string>( "spi_sim", "update_mode" );
+    if( mode ){
+        bus.update_mode = spi_update_mode_from_string( mode.value() );
+    }
+
+    auto format = config.setting<std::string>( "spi_sim", "wire_format" );
+    if( format && ( format.value() == "RGB565" || format.value() == "rgb565" ) ){
+        bus.wire_format = img::PixelFormat::RGB565;
+    }
+    else if( format && ( format.value() == "RGB" || format.value() == "rgb" ) ){
+        bus.wire_format = img::PixelFormat::RGB;
+    }
+    else if( format ){
+        throw std::runtime_error( "Unsupported SPI wire format: " + format.value() + ". Expected RGB565 or RGB." );
+    }
+    return bus;
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Driver_SPI_Sim::Driver_SPI_Sim( Driver_Base::ptr_t display,
+                                img::Dimensions    dims,
+                                SPI_Bus_Config     bus )
+    : m_display { std::move( display ) },
+      m_dims { dims.cols(), dims.rows(), 4 },
+      m_bus { bus }
+{
+    m_panel.resize( m_dims, 0 );
+}
+
+/****************************************/
+/*          Initialize Driver           */
+/****************************************/
+bool Driver_SPI_Sim::initialize( core::Options& )
+{
+    m_previous.clear();
+    m_panel.resize( m_dims, 0 );
+    return true;
+}
+
+/****************************************/
+/*            Finalize Driver           */
+/****************************************/
+int Driver_SPI_Sim::finalize()
+{
+    if( m_stats.shows > 0 ){
+        LOG_INFO( to_log_string() );
+    }
+    return m_display ? m_display->finalize() : 0;
+}
+
+/********************************************/
+/*          Check if we should exit         */
+/********************************************/
+bool Driver_SPI_Sim::okay_to_run()
+{
+    return m_display ? m_display->okay_to_run() : true;
+}
+
+/************************************************/
+/*          Check for user interaction          */
+/************************************************/
+bool Driver_SPI_Sim::input_pending()
+{
+    return m_display ? m_display->input_pending() : false;
+}
+
+/********************************************/
+/*          Take the wrapped key events     */
+/********************************************/
+std::vector<Input_Event> Driver_SPI_Sim::take_input_events()
+{
+    return m_display ? m_display->take_input_events() : Driver_Base::take_input_events();
+}
+
+/************************************************/
+/*          Wait for the user or the deadline   */
+/************************************************/
+bool Driver_SPI_Sim::wait_for_input( std::chrono::steady_clock::time_point until,
+                                     std::chrono::steady_clock::duration   poll_interval )
+{
+    if( !m_display ){
+        return Driver_Base::wait_for_input( until, poll_interval );
+    }
+    return m_display->wait_for_input( until, poll_interval );
+}
+
+/********************************************************/
+/*          Simulate the transfer, then forward         */
+/********************************************************/
+void Driver_SPI_Sim::show( img::Frame& frame )
+{
+    find_damage( frame );
+    for( const auto& rect : m_rects ){
+        write_panel( frame, rect );
+    }
+
+    m_last_transfer = estimate( m_rects );
+    m_stats.shows++;
+    accumulate( m_stats.total, m_last_transfer );
+    m_stats.worst = std::max( m_stats.worst, m_last_transfer.duration );
+
+    if( m_bus.realtime ){
+        std::this_thread::sleep_for( m_last_transfer.duration );
+    }
+    if( m_display ){
+        m_display->show( frame );
+    }
+}
+
+/****************************************/
+/*          Describe the panel          */
+/****************************************/
+Driver_Capabilities Driver_SPI_Sim::capabilities() const
+{
+    Driver_Capabilities caps;
+    caps.native_formats   = { m_bus.wire_format };
+    caps.partial_updates  = m_bus.update_mode != SPI_Update_Mode::FULL;
+    caps.row_alignment    = 4;
+    caps.max_texture_size = m_dims.size();
+
+    // The panel is only paced by the bus.  Threading is up to the wrapped driver.
+    caps.threaded_show = m_display ? m_display->capabilities().threaded_show : true;
+    return caps;
+}
+
+/******************************************/
+/*        Get the screen dimensions       */
+/******************************************/
+img::Dimensions Driver_SPI_Sim::get_screen_dimensions() const
+{
+    return m_dims;
+}
+
+/************************************/
+/*          Load the Image          */
+/************************************/
+img::Frame::ptr_t Driver_SPI_Sim::load_image( const std::filesystem::path& path )
+{
+    if( !m_display ){
+        throw std::runtime_error( "The headless SPI simulator cannot load images: " + path.native() );
+    }
+    return m_display->load_image( path );
+}
+
+/************************************/
+/*          Rasterize Text          */
+/************************************/
+img::Frame::ptr_t Driver_SPI_Sim::rasterize_text( const std::string& message )
+{
+    if( !m_display ){
+        throw std::runtime_error( "The headless SPI simulator cannot rasterize text" );
+    }
+    return m_display->rasterize_text( message );
+}
+
+/************************************************/
+/*          Estimate the cost of windows        */
+/************************************************/
+Driver_SPI_Sim::Transfer Driver_SPI_Sim::estimate( const std::vector<Rect>& rects ) const
+{
+    const size_t bpp = img::bytes_per_pixel( m_bus.wire_format );
+
+    Transfer transfer;
+    for( const auto& rect : rects ){
+        const size_t bytes  = rect.cols * rect.rows * bpp;
+        const size_t chunks = ( bytes + m_bus.dma_chunk_bytes - 1 ) / m_bus.dma_chunk_bytes;
+
+        transfer.rects++;
+        transfer.commands    += WINDOW_COMMANDS;
+        transfer.pixel_bytes += bytes;
+        transfer.dma_chunks  += chunks;
+        transfer.duration    += m_bus.command_overhead * static_cast<int64_t>( WINDOW_COMMANDS ) +
+                                wire_time( WINDOW_COMMAND_BYTES + bytes, m_bus.clock_hz ) +
+                                m_bus.dma_setup * static_cast<int64_t>( chunks );
+    }
+    return transfer;
+}
+
+/********************************************/
+/*          Print Log-Friendly String       */
+/********************************************/
+std::string Driver_SPI_Sim::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    const auto shows   = std::max<size_t>( m_stats.shows, 1 );
+    const auto average = m_stats.total.duration / static_cast<int64_t>( shows );
+
+    std::stringstream sout;
+    sout << gap << "Driver_SPI_Sim:" << std::endl;
+    sout << gap << "  - Panel: " << m_dims.cols() << " x " << m_dims.rows()
+         << ", Display: " << ( m_display ? "forwarded" : "headless" ) << std::endl;
+    sout << m_bus.to_log_string( offset + 2 );
+    sout << gap << "  - Shows: " << m_stats.shows << ", Windows: " << m_stats.total.rects
+         << ", Pixel Bytes: " << m_stats.total.pixel_bytes << ", DMA Chunks: " << m_stats.total.dma_chunks << std::endl;
+    sout << gap << "  - Average Transfer: " << average.count() / 1000 << " us, Worst: "
+         << m_stats.worst.count() / 1000 << " us";
+    if( average.count() > 0 ){
+        sout << ", Bus-Limited FPS: " << 1e9 / static_cast<double>( average.count() );
+    }
+    sout << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Create new driver instance          */
+/************************************************/
+Driver_SPI_Sim::ptr_t Driver_SPI_Sim::create( core::Options&     config,
+                                              Driver_Base::ptr_t display )
+{
+    img::Dimensions dims;
+    if( display ){
+        dims = display->get_screen_dimensions();
+    }
+    else {
+        dims = img::Dimensions( config.check_and_get_setting<size_t>( "display", "screen_width" ),
+                                config.check_and_get_setting<size_t>( "display", "screen_height" ),
+                                4 );
+    }
+
+    auto driver = std::make_unique<Driver_SPI_Sim>( std::move( display ),
+                                                    dims,
+                                                    SPI_Bus_Config::from_config( config ) );
+    driver->initialize( config );
+    LOG_DEBUG( driver->m_bus.to_log_string() );
+    return driver;
+}
+
+/****************************************************/
+/*          Find the windows to send                */
+/****************************************************/
+void Driver_SPI_Sim::find_damage( const img::Frame& frame )
+{
+    m_rects.clear();
+
+    const size_t bpp       = frame.channels();
+    const size_t row_bytes = frame.cols() * bpp;
+    const size_t cols      = std::min( frame.cols(), m_dims.cols() );
+    const size_t rows      = std::min( frame.rows(), m_dims.rows() );
+    const auto   pixels    = frame.pixels();
+    if( cols == 0 || rows == 0 ){
+        return;
+    }
+
+    // Send everything on request, or when there is nothing to compare against
+    if( m_bus.update_mode == SPI_Update_Mode::FULL || m_previous.size() != pixels.size() ){
+        m_previous.assign( pixels.begin(), pixels.end() );
+        m_rects.push_back( Rect{ 0, 0, cols, rows } );
+        return;
+    }
+
+    // Group consecutive changed rows into bands
+    bool band_open = false;
+    for( size_t row = 0; row < rows; row++ ){
+        const uint8_t* current  = pixels.data() + row * row_bytes;
+        uint8_t*       previous = m_previous.data() + row * row_bytes;
+        if( std::memcmp( current, previous, cols * bpp ) == 0 ){
+            band_open = false;
+            continue;
+        }
+
+        size_t first = 0;
+        size_t last  = cols;
+        if( m_bus.update_mode == SPI_Update_Mode::RECTS ){
+            while( std::memcmp( current + first * bpp, previous + first * bpp, bpp ) == 0 ){
+                first++;
+            }
+            while( std::memcmp( current + ( last - 1 ) * bpp, previous + ( last - 1 ) * bpp, bpp ) == 0 ){
+                last--;
+            }
+        }
+        std::memcpy( previous + first * bpp, current + first * bpp, ( last - first ) * bpp );
+
+        if( !band_open ){
+            m_rects.push_back( Rect{ first, row, last - first, 1 } );
+            band_open = true;
+            continue;
+        }
+        auto& band = m_rects.back();
+        const size_t band_end = std::max( band.col + band.cols, last );
+        band.col  = std::min( band.col, first );
+        band.cols = band_end - band.col;
+        band.rows++;
+    }
+}
+
+/****************************************************/
+/*          Write a window into the panel           */
+/****************************************************/
+void Driver_SPI_Sim::write_panel( const img::Frame& frame,
+                                  const Rect&       rect )
+{
+    const auto   src_format = img::pixel_format_from_channels( frame.channels() );
+    const size_t src_bpp    = frame.channels();
+    const size_t row_bytes  = frame.cols() * src_bpp;
+    const auto   pixels     = frame.pixels();
+    uint8_t*     panel      = m_panel.data();
+
+    m_wire_row.resize( rect.cols * img::bytes_per_pixel( m_bus.wire_format ) );
+    for( size_t row = rect.row; row < rect.row + rect.rows; row++ ){
+        img::convert_row( pixels.data() + row * row_bytes + rect.col * src_bpp,
+                          src_format,
+                          m_wire_row.data(),
+                          m_bus.wire_format,
+                          rect.cols );
+        img::convert_row( m_wire_row.data(),
+                          m_bus.wire_format,
+                          panel + ( row * m_dims.cols() + rect.col ) * 4,
+                          img::PixelFormat::RGBA,
+                          rect.cols );
+    }
+}
+
+} // End of tmns::drv namespace
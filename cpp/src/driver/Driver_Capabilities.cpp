@@ -0,0 +1,66 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Driver_Capabilities.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Driver_Capabilities.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <sstream>
+
+namespace tmns::drv {
+
+/****************************************/
+/*          Check a pixel format        */
+/****************************************/
+bool Driver_Capabilities::is_native( img::PixelFormat format ) const
+{
+    return std::find( native_formats.begin(), native_formats.end(), format ) != native_formats.end();
+}
+
+/****************************************/
+/*          Check a frame size          */
+/****************************************/
+bool Driver_Capabilities::fits( const math::Size2i& size ) const
+{
+    return ( max_texture_size.width()  <= 0 || size.width()  <= max_texture_size.width() ) &&
+           ( max_texture_size.height() <= 0 || size.height() <= max_texture_size.height() );
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Driver_Capabilities::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+    std::stringstream sout;
+    sout << gap << "Driver_Capabilities:" << std::endl;
+    sout << gap << "  - Native Formats:";
+    for( const auto& format : native_formats ){
+        sout << " " << img::to_string( format );
+    }
+    sout << std::endl;
+    sout << gap << "  - Partial Updates: " << std::boolalpha << partial_updates
+         << ", VSync: " << vsync << ", Threaded Show: " << threaded_show << std::endl;
+    sout << gap << "  - Row Alignment: " << row_alignment << " bytes" << std::endl;
+    sout << gap << "  - Max Texture Size: ";
+    if( max_texture_size.width() > 0 || max_texture_size.height() > 0 ){
+        sout << max_texture_size.width() << " x " << max_texture_size.height() << std::endl;
+    }
+    else {
+        sout << "unlimited" << std::endl;
+    }
+    return sout.str();
+}
+
+} // End of tmns::drv namespace
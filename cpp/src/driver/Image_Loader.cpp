@@ -0,0 +1,184 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Image_Loader.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Image_Loader.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace tmns::drv {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Image_Loader::Image_Loader( Load_Func load,
+                            size_t    threads )
+    : m_load { std::move( load ) }
+{
+    for( size_t i = 0; i < std::max<size_t>( threads, 1 ); i++ ){
+        m_threads.emplace_back( &Image_Loader::worker, this );
+    }
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Image_Loader::~Image_Loader()
+{
+    stop();
+}
+
+/****************************************/
+/*          Request an image            */
+/****************************************/
+Image_Loader::Result Image_Loader::load( const std::filesystem::path& path )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_stats.requested++;
+
+    auto it = m_in_flight.find( path );
+    if( it != m_in_flight.end() ){
+        m_stats.deduplicated++;
+        return it->second;
+    }
+
+    Job job { path, {} };
+    Result result = job.promise.get_future().share();
+    if( m_stopping ){
+        m_stats.failed++;
+        job.promise.set_exception( std::make_exception_ptr( std::runtime_error( "Image loader is stopped" ) ) );
+        return result;
+    }
+
+    m_in_flight.emplace( path, result );
+    m_queue.push_back( std::move( job ) );
+    m_job_ready.notify_one();
+    return result;
+}
+
+/****************************************/
+/*          Stop the loader threads     */
+/****************************************/
+void Image_Loader::stop()
+{
+    std::deque<Job> cancelled;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_stopping = true;
+        cancelled.swap( m_queue );
+        for( const auto& job : cancelled ){
+            m_in_flight.erase( job.path );
+        }
+        m_stats.failed += cancelled.size();
+    }
+    m_job_ready.notify_all();
+
+    for( auto& job : cancelled ){
+        std::stringstream sout;
+        sout << "Image loader stopped before loading " << job.path.native();
+        job.promise.set_exception( std::make_exception_ptr( std::runtime_error( sout.str() ) ) );
+    }
+
+    for( auto& thread : m_threads ){
+        if( thread.joinable() ){
+            thread.join();
+        }
+    }
+    m_threads.clear();
+}
+
+/********************************************/
+/*          Count outstanding requests      */
+/********************************************/
+size_t Image_Loader::in_flight() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_in_flight.size();
+}
+
+/************************************/
+/*          Get the counters        */
+/************************************/
+Image_Loader::Stats Image_Loader::stats() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_stats;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Image_Loader::to_log_string( size_t offset ) const
+{
+    auto stats = this->stats();
+
+    std::string gap( offset, ' ' );
+    std::stringstream sout;
+    sout << gap << "Image_Loader:" << std::endl;
+    sout << gap << "  - Threads: " << m_threads.size() << ", In Flight: " << in_flight() << std::endl;
+    sout << gap << "  - Requested: " << stats.requested << ", Deduplicated: " << stats.deduplicated
+         << ", Loaded: " << stats.loaded << ", Failed: " << stats.failed << std::endl;
+    return sout.str();
+}
+
+/****************************************/
+/*          Loader thread body          */
+/****************************************/
+void Image_Loader::worker()
+{
+    while( true ){
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_job_ready.wait( lock, [this](){ return m_stopping || !m_queue.empty(); } );
+            if( m_queue.empty() ){
+                return;
+            }
+            job = std::move( m_queue.front() );
+            m_queue.pop_front();
+        }
+
+        // Later requests for this path start a fresh load once this one is finished
+        img::Frame::ptr_t frame;
+        std::exception_ptr error;
+        try {
+            frame = m_load( job.path );
+        }
+        catch( ... ){
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_in_flight.erase( job.path );
+            if( error ){
+                m_stats.failed++;
+            }
+            else {
+                m_stats.loaded++;
+            }
+        }
+
+        if( error ){
+            job.promise.set_exception( error );
+        }
+        else {
+            job.promise.set_value( std::move( frame ) );
+        }
+    }
+}
+
+} // End of tmns::drv namespace
@@ -0,0 +1,65 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Input_Event.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Input_Event.hpp>
+
+namespace tmns::drv {
+
+/********************************/
+/*          Key to string       */
+/********************************/
+std::string to_string( Key key )
+{
+    switch( key ){
+        case Key::NONE:      return "NONE";
+        case Key::SPACE:     return "SPACE";
+        case Key::UP:        return "UP";
+        case Key::DOWN:      return "DOWN";
+        case Key::LEFT:      return "LEFT";
+        case Key::RIGHT:     return "RIGHT";
+        case Key::ENTER:     return "ENTER";
+        case Key::ESCAPE:    return "ESCAPE";
+        case Key::BACKSPACE: return "BACKSPACE";
+        case Key::TAB:       return "TAB";
+        case Key::HOME:      return "HOME";
+        case Key::END:       return "END";
+        case Key::PAGE_UP:   return "PAGE_UP";
+        case Key::PAGE_DOWN: return "PAGE_DOWN";
+        case Key::DELETE:    return "DELETE";
+        default:
+            break;
+    }
+
+    // Printable keys are their own name
+    const auto code = static_cast<uint16_t>( key );
+    if( code > 0x20 && code < 0x7F ){
+        return std::string( 1, static_cast<char>( code ) );
+    }
+    return "UNKNOWN";
+}
+
+/****************************************/
+/*          Input_Action to string      */
+/****************************************/
+std::string to_string( Input_Action action )
+{
+    switch( action ){
+        case Input_Action::PRESS:   return "PRESS";
+        case Input_Action::RELEASE: return "RELEASE";
+        case Input_Action::REPEAT:  return "REPEAT";
+        default:                    return "UNKNOWN";
+    }
+}
+
+} // End of tmns::drv namespace
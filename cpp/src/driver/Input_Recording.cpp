@@ -0,0 +1,177 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Input_Recording.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Input_Recording.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+
+namespace tmns::drv {
+
+/****************************************/
+/*          Add an event to the file    */
+/****************************************/
+void Input_Recording_Writer::write( const Input_Record& record )
+{
+    write_record( record.frame,
+                  record.timestamp,
+                  static_cast<uint8_t>( record.action ),
+                  static_cast<uint16_t>( record.key ) );
+    m_events++;
+}
+
+/****************************************/
+/*          Close the recording         */
+/****************************************/
+void Input_Recording_Writer::finish( uint32_t frames )
+{
+    write_record( frames, std::chrono::microseconds( 0 ), Input_Recording::END_ACTION, 0 );
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Input_Recording_Writer::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Input_Recording_Writer:" << std::endl;
+    sout << gap << "  - Path: " << m_pathname.native() << std::endl;
+    sout << gap << "  - Events: " << m_events << std::endl;
+    return sout.str();
+}
+
+/****************************************/
+/*          Create a new recording      */
+/****************************************/
+Input_Recording_Writer::ptr_t Input_Recording_Writer::create( const std::filesystem::path& pathname,
+                                                              const std::string&           config_text )
+{
+    return Input_Recording_Writer::ptr_t( new Input_Recording_Writer( pathname, config_text ) );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Input_Recording_Writer::Input_Recording_Writer( const std::filesystem::path& pathname,
+                                                const std::string&           config_text )
+    : m_pathname { pathname },
+      m_fout { pathname, std::ios::binary | std::ios::trunc }
+{
+    uint8_t header[Input_Recording::HEADER_BYTES] {};
+    std::copy( Input_Recording::MAGIC.begin(), Input_Recording::MAGIC.end(), header );
+    core::write_le<uint16_t>( header + 4, Input_Recording::VERSION );
+    core::write_le<uint32_t>( header + 8, static_cast<uint32_t>( config_text.size() ) );
+    m_fout.write( reinterpret_cast<const char*>( header ), sizeof( header ) );
+    m_fout.write( config_text.data(), static_cast<std::streamsize>( config_text.size() ) );
+    m_fout.flush();
+
+    if( !m_fout.good() ){
+        throw std::runtime_error( "Unable to create input recording: " + pathname.native() );
+    }
+}
+
+/************************************/
+/*          Write one record        */
+/************************************/
+void Input_Recording_Writer::write_record( uint32_t                  frame,
+                                           std::chrono::microseconds timestamp,
+                                           uint8_t                   action,
+                                           uint16_t                  key )
+{
+    uint8_t record[Input_Recording::RECORD_BYTES] {};
+    core::write_le<uint32_t>( record, frame );
+    core::write_le<uint64_t>( record + 4, static_cast<uint64_t>( timestamp.count() ) );
+    record[12] = action;
+    core::write_le<uint16_t>( record + 14, key );
+    m_fout.write( reinterpret_cast<const char*>( record ), sizeof( record ) );
+    m_fout.flush();
+
+    if( !m_fout.good() ){
+        throw std::runtime_error( "Unable to write input recording: " + m_pathname.native() );
+    }
+}
+
+/****************************************/
+/*          Open a recording            */
+/****************************************/
+Input_Recording_Reader::ptr_t Input_Recording_Reader::open( const std::filesystem::path& pathname )
+{
+    std::ifstream fin( pathname, std::ios::binary );
+    if( !fin.good() ){
+        throw std::runtime_error( "Unable to open input recording: " + pathname.native() );
+    }
+    std::vector<uint8_t> buffer( ( std::istreambuf_iterator<char>( fin ) ), std::istreambuf_iterator<char>() );
+
+    if( buffer.size() < Input_Recording::HEADER_BYTES ||
+        !std::equal( Input_Recording::MAGIC.begin(), Input_Recording::MAGIC.end(), buffer.begin(),
+                     []( char a, uint8_t b ){ return static_cast<uint8_t>( a ) == b; } ) )
+    {
+        throw std::runtime_error( "File is not a Terminus input recording: " + pathname.native() );
+    }
+
+    const uint16_t version = core::read_le<uint16_t>( buffer.data() + 4 );
+    if( version != Input_Recording::VERSION ){
+        std::stringstream sout;
+        sout << "Unsupported input recording version " << version << ": " << pathname.native();
+        throw std::runtime_error( sout.str() );
+    }
+
+    const size_t config_bytes = core::read_le<uint32_t>( buffer.data() + 8 );
+    if( Input_Recording::HEADER_BYTES + config_bytes > buffer.size() ){
+        throw std::runtime_error( "Input recording is truncated: " + pathname.native() );
+    }
+
+    auto reader = Input_Recording_Reader::ptr_t( new Input_Recording_Reader() );
+    reader->m_config_text.assign( reinterpret_cast<const char*>( buffer.data() ) + Input_Recording::HEADER_BYTES,
+                                  config_bytes );
+
+    // A trailing partial record is what a crash leaves behind, so it is ignored
+    for( size_t position = Input_Recording::HEADER_BYTES + config_bytes;
+         position + Input_Recording::RECORD_BYTES <= buffer.size();
+         position += Input_Recording::RECORD_BYTES )
+    {
+        const uint8_t* record = buffer.data() + position;
+        const uint32_t frame  = core::read_le<uint32_t>( record );
+        const uint8_t  action = record[12];
+        if( action == Input_Recording::END_ACTION ){
+            reader->m_frame_count = frame;
+            break;
+        }
+        if( action > static_cast<uint8_t>( Input_Action::REPEAT ) ||
+            ( !reader->m_records.empty() && frame < reader->m_records.back().frame ) )
+        {
+            std::stringstream sout;
+            sout << "Corrupt input record at byte " << position << ": " << pathname.native();
+            throw std::runtime_error( sout.str() );
+        }
+
+        Input_Record event;
+        event.frame     = frame;
+        event.timestamp = std::chrono::microseconds( static_cast<int64_t>( core::read_le<uint64_t>( record + 4 ) ) );
+        event.action    = static_cast<Input_Action>( action );
+        event.key       = static_cast<Key>( core::read_le<uint16_t>( record + 14 ) );
+        reader->m_records.push_back( event );
+    }
+    return reader;
+}
+
+} // End of tmns::drv namespace
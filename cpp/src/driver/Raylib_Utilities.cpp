@@ -67,6 +67,31 @@ size_t raylib_format_to_channels( PixelFormat fmt )
     }   
 }
 
+/********************************************************************/
+/*      Convert a Raylib format enum into an image pixel format     */
+/********************************************************************/
+img::PixelFormat raylib_format_to_pixel_format( PixelFormat fmt )
+{
+    switch( fmt ){
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            return img::PixelFormat::GRAY;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            return img::PixelFormat::GRAY_ALPHA;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            return img::PixelFormat::RGB565;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            return img::PixelFormat::RGB;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            return img::PixelFormat::RGBA;
+        default:
+        {
+            std::stringstream sout;
+            sout << "No image pixel format matches " << to_string( fmt );
+            throw std::runtime_error( sout.str() );
+        }
+    }
+}
+
 /********************************************/
 /*      Convert PixelFormat to String       */
 /********************************************/
@@ -0,0 +1,152 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Remote_Client.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Remote_Client.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#include <terminus/log/Logger.hpp>
+
+// POSIX Libraries
+#include <poll.h>
+
+namespace tmns::drv {
+
+/************************************************/
+/*          Wait for messages and apply them    */
+/************************************************/
+bool Remote_Client::poll( std::chrono::milliseconds timeout )
+{
+    pollfd request { m_connection->fd(), POLLIN, 0 };
+    ::poll( &request, 1, static_cast<int>( timeout.count() ) );
+
+    const bool open = m_connection->receive();
+
+    Remote_Message type;
+    while( m_connection->next_message( type, m_payload ) ){
+        handle( type );
+    }
+    return m_connection->flush() && open;
+}
+
+/****************************************/
+/*          Send a key event            */
+/****************************************/
+void Remote_Client::send_key( Input_Action action,
+                              Key          key )
+{
+    uint8_t payload[Remote_Protocol::INPUT_BYTES] {};
+    payload[0] = static_cast<uint8_t>( action );
+    core::write_le<uint16_t>( payload + 1, static_cast<uint16_t>( key ) );
+    m_connection->send( Remote_Message::INPUT, payload );
+    m_connection->flush();
+}
+
+/****************************************/
+/*          Check for a full screen     */
+/****************************************/
+bool Remote_Client::has_frame() const
+{
+    return m_frames > 0;
+}
+
+/****************************************/
+/*          Get the screen              */
+/****************************************/
+const img::Frame& Remote_Client::frame() const
+{
+    return m_decoder.frame();
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Remote_Client::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Remote_Client:" << std::endl;
+    sout << gap << "  - Frames: " << m_frames << ", Bytes: " << m_bytes << std::endl;
+    if( has_frame() ){
+        sout << gap << "  - Screen: " << frame().cols() << " x " << frame().rows() << std::endl;
+    }
+    return sout.str();
+}
+
+/****************************************/
+/*          Connect to a server         */
+/****************************************/
+Remote_Client::ptr_t Remote_Client::connect( const Remote_Endpoint& endpoint )
+{
+    return Remote_Client::ptr_t( new Remote_Client( Remote_Connection::connect( endpoint ) ) );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Remote_Client::Remote_Client( Remote_Connection::ptr_t connection )
+    : m_connection { std::move( connection ) }
+{
+}
+
+/****************************************/
+/*          Apply one message           */
+/****************************************/
+void Remote_Client::handle( Remote_Message type )
+{
+    if( type == Remote_Message::HELLO ){
+        if( m_payload.size() != Remote_Protocol::HELLO_BYTES ||
+            !std::equal( Remote_Protocol::MAGIC.begin(), Remote_Protocol::MAGIC.end(), m_payload.begin(),
+                         []( char a, uint8_t b ){ return static_cast<uint8_t>( a ) == b; } ) )
+        {
+            throw std::runtime_error( "Server is not a Terminus remote display" );
+        }
+        const uint16_t version = core::read_le<uint16_t>( m_payload.data() + 4 );
+        if( version != Remote_Protocol::VERSION ){
+            std::stringstream sout;
+            sout << "Unsupported remote display protocol version " << version;
+            throw std::runtime_error( sout.str() );
+        }
+        m_greeted = true;
+        return;
+    }
+
+    if( type != Remote_Message::FRAME || !m_greeted ){
+        throw std::runtime_error( "Unexpected " + to_string( type ) + " message from server" );
+    }
+
+    // After an error only a keyframe can bring the screen back
+    m_bytes += m_payload.size();
+    if( m_resyncing && ( m_payload.empty() || m_payload[0] != static_cast<uint8_t>( img::DeltaPacket::KEY ) ) ){
+        return;
+    }
+    try {
+        m_decoder.decode( m_payload );
+        m_resyncing = false;
+        m_frames++;
+    }
+    catch( const std::exception& e ){
+        LOG_WARNING( std::string( "Lost sync with the remote display, asking for a keyframe: " ) + e.what() );
+        m_resyncing = true;
+        m_connection->send( Remote_Message::KEYFRAME, {} );
+    }
+}
+
+} // End of tmns::drv namespace
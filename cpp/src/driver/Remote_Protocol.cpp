@@ -0,0 +1,402 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Remote_Protocol.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <terminus/driver/Remote_Protocol.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace tmns::drv {
+
+namespace {
+
+/// Bytes read from the socket at a time
+constexpr size_t READ_CHUNK_BYTES { 64 * 1024 };
+
+/// Least that is buffered before reading stops, so small messages are still read in batches
+constexpr size_t MIN_INBOUND_BYTES { 4 * 1024 };
+
+/// Connections waiting to be accepted
+constexpr int LISTEN_BACKLOG { 4 };
+
+/****************************************/
+/*          Error with errno text       */
+/****************************************/
+std::runtime_error socket_error( const std::string&     message,
+                                 const Remote_Endpoint& endpoint )
+{
+    std::stringstream sout;
+    sout << message << " " << endpoint.to_string() << ": " << std::strerror( errno );
+    return std::runtime_error( sout.str() );
+}
+
+/****************************************/
+/*          Make a socket non-blocking  */
+/****************************************/
+void set_non_blocking( int fd )
+{
+    const int flags = ::fcntl( fd, F_GETFL, 0 );
+    ::fcntl( fd, F_SETFL, flags | O_NONBLOCK );
+}
+
+/************************************************/
+/*          Build a Unix socket address         */
+/************************************************/
+sockaddr_un unix_address( const Remote_Endpoint& endpoint )
+{
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    if( endpoint.address.size() >= sizeof( address.sun_path ) ){
+        throw std::runtime_error( "Unix socket path is too long: " + endpoint.address );
+    }
+    std::copy( endpoint.address.begin(), endpoint.address.end(), address.sun_path );
+    return address;
+}
+
+/************************************************/
+/*          Resolve a TCP address               */
+/************************************************/
+addrinfo* tcp_addresses( const Remote_Endpoint& endpoint, bool passive )
+{
+    addrinfo hints {};
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = passive ? AI_PASSIVE : 0;
+
+    addrinfo*   result = nullptr;
+    const auto  port   = std::to_string( endpoint.port );
+    const char* host   = endpoint.address.empty() ? nullptr : endpoint.address.c_str();
+    const int   status = ::getaddrinfo( host, port.c_str(), &hints, &result );
+    if( status != 0 ){
+        throw std::runtime_error( "Unable to resolve " + endpoint.to_string() + ": " + ::gai_strerror( status ) );
+    }
+    return result;
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Convert to string   */
+/********************************/
+std::string to_string( Remote_Message message )
+{
+    switch( message ){
+        case Remote_Message::HELLO:    return "HELLO";
+        case Remote_Message::FRAME:    return "FRAME";
+        case Remote_Message::INPUT:    return "INPUT";
+        case Remote_Message::KEYFRAME: return "KEYFRAME";
+    }
+    return "UNKNOWN";
+}
+
+/********************************/
+/*          Print Endpoint      */
+/********************************/
+std::string Remote_Endpoint::to_string() const
+{
+    if( kind == Kind::UNIX ){
+        return "unix:" + address;
+    }
+    return "tcp:" + address + ":" + std::to_string( port );
+}
+
+/********************************/
+/*          Parse Endpoint      */
+/********************************/
+Remote_Endpoint Remote_Endpoint::parse( const std::string& text )
+{
+    Remote_Endpoint endpoint;
+    if( text.starts_with( "unix:" ) && text.size() > 5 ){
+        endpoint.kind    = Kind::UNIX;
+        endpoint.address = text.substr( 5 );
+        return endpoint;
+    }
+
+    const auto colon = text.rfind( ':' );
+    if( text.starts_with( "tcp:" ) && colon > 3 && colon + 1 < text.size() ){
+        const auto port = std::stoul( text.substr( colon + 1 ) );
+        if( port > 0xffff ){
+            throw std::runtime_error( "Invalid TCP port in remote address: " + text );
+        }
+        endpoint.kind    = Kind::TCP;
+        endpoint.address = text.substr( 4, colon - 4 );
+        endpoint.port    = static_cast<uint16_t>( port );
+        return endpoint;
+    }
+    throw std::runtime_error( "Invalid remote address: " + text + ". Expected unix:<path> or tcp:<host>:<port>." );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Remote_Connection::Remote_Connection( int    fd,
+                                      size_t max_payload_bytes )
+    : m_fd { fd },
+      m_max_payload_bytes { max_payload_bytes },
+      m_max_inbound_bytes { std::max( Remote_Protocol::HEADER_BYTES + max_payload_bytes, MIN_INBOUND_BYTES ) }
+{
+    set_non_blocking( m_fd );
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Remote_Connection::~Remote_Connection()
+{
+    if( m_fd >= 0 ){
+        ::close( m_fd );
+    }
+}
+
+/****************************************/
+/*          Queue a message             */
+/****************************************/
+void Remote_Connection::send( Remote_Message           type,
+                              std::span<const uint8_t> payload )
+{
+    std::vector<uint8_t> message( Remote_Protocol::HEADER_BYTES + payload.size() );
+    message[0] = static_cast<uint8_t>( type );
+    core::write_le<uint32_t>( message.data() + 1, static_cast<uint32_t>( payload.size() ) );
+    std::copy( payload.begin(), payload.end(), message.begin() + Remote_Protocol::HEADER_BYTES );
+
+    m_pending_bytes += message.size();
+    m_outbound.push_back( std::move( message ) );
+}
+
+/****************************************/
+/*          Send what the socket takes  */
+/****************************************/
+bool Remote_Connection::flush()
+{
+    while( !m_outbound.empty() ){
+        const auto& message = m_outbound.front();
+        const auto  sent    = ::send( m_fd,
+                                      message.data() + m_front_sent,
+                                      message.size() - m_front_sent,
+                                      MSG_NOSIGNAL );
+        if( sent < 0 ){
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+
+        m_front_sent    += static_cast<size_t>( sent );
+        m_pending_bytes -= static_cast<size_t>( sent );
+        if( m_front_sent == message.size() ){
+            m_outbound.pop_front();
+            m_front_sent = 0;
+        }
+    }
+    return true;
+}
+
+/****************************************/
+/*          Read what has arrived       */
+/****************************************/
+bool Remote_Connection::receive()
+{
+    // Drop the messages taken since the last read
+    if( m_read_offset > 0 ){
+        m_inbound.erase( m_inbound.begin(), m_inbound.begin() + static_cast<std::ptrdiff_t>( m_read_offset ) );
+        m_read_offset = 0;
+    }
+
+    while( m_inbound.size() < m_max_inbound_bytes ){
+        const size_t start = m_inbound.size();
+        const size_t chunk = std::min( READ_CHUNK_BYTES, m_max_inbound_bytes - start );
+        m_inbound.resize( start + chunk );
+        const auto received = ::recv( m_fd, m_inbound.data() + start, chunk, 0 );
+        m_inbound.resize( start + static_cast<size_t>( std::max<ssize_t>( received, 0 ) ) );
+
+        if( received == 0 ){
+            return false;
+        }
+        if( received < 0 ){
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+    }
+
+    // Full.  The rest stays on the socket until messages are taken.
+    return true;
+}
+
+/****************************************/
+/*          Take the next message       */
+/****************************************/
+bool Remote_Connection::next_message( Remote_Message&       type,
+                                      std::vector<uint8_t>& payload )
+{
+    const size_t unread = m_inbound.size() - m_read_offset;
+    if( unread < Remote_Protocol::HEADER_BYTES ){
+        return false;
+    }
+
+    const uint8_t* header = m_inbound.data() + m_read_offset;
+    const size_t   size   = core::read_le<uint32_t>( header + 1 );
+    if( header[0] > static_cast<uint8_t>( Remote_Message::KEYFRAME ) || size > m_max_payload_bytes ){
+        std::stringstream sout;
+        sout << "Corrupt remote message. Type: " << static_cast<int>( header[0] ) << ", Size: " << size;
+        throw std::runtime_error( sout.str() );
+    }
+    if( unread < Remote_Protocol::HEADER_BYTES + size ){
+        return false;
+    }
+
+    type = static_cast<Remote_Message>( header[0] );
+    const uint8_t* body = header + Remote_Protocol::HEADER_BYTES;
+    payload.assign( body, body + size );
+    m_read_offset += Remote_Protocol::HEADER_BYTES + size;
+
+    // Everything read has been taken, so the next read can start at the front
+    if( m_read_offset == m_inbound.size() ){
+        m_inbound.clear();
+        m_read_offset = 0;
+    }
+    return true;
+}
+
+/************************************************/
+/*          Drop messages not yet started       */
+/************************************************/
+size_t Remote_Connection::drop_queued()
+{
+    const size_t keep    = ( m_front_sent > 0 ) ? 1 : 0;
+    size_t       dropped = 0;
+    while( m_outbound.size() > keep ){
+        dropped += m_outbound.back().size();
+        m_outbound.pop_back();
+    }
+    m_pending_bytes -= dropped;
+    return dropped;
+}
+
+/****************************************/
+/*          Open a listening socket     */
+/****************************************/
+int Remote_Connection::listen( const Remote_Endpoint& endpoint )
+{
+    int fd = -1;
+    if( endpoint.kind == Remote_Endpoint::Kind::UNIX ){
+        auto address = unix_address( endpoint );
+        std::filesystem::remove( endpoint.address );
+
+        fd = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+        if( fd < 0 || ::bind( fd, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) ) != 0 ){
+            auto error = socket_error( "Unable to bind remote display socket", endpoint );
+            if( fd >= 0 ){
+                ::close( fd );
+            }
+            throw error;
+        }
+    }
+    else {
+        auto* addresses = tcp_addresses( endpoint, true );
+        for( auto* info = addresses; info != nullptr; info = info->ai_next ){
+            fd = ::socket( info->ai_family, info->ai_socktype, info->ai_protocol );
+            if( fd < 0 ){
+                continue;
+            }
+            const int reuse = 1;
+            ::setsockopt( fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof( reuse ) );
+            if( ::bind( fd, info->ai_addr, info->ai_addrlen ) == 0 ){
+                break;
+            }
+            ::close( fd );
+            fd = -1;
+        }
+        ::freeaddrinfo( addresses );
+        if( fd < 0 ){
+            throw socket_error( "Unable to bind remote display socket", endpoint );
+        }
+    }
+
+    if( ::listen( fd, LISTEN_BACKLOG ) != 0 ){
+        auto error = socket_error( "Unable to listen on remote display socket", endpoint );
+        ::close( fd );
+        throw error;
+    }
+    set_non_blocking( fd );
+    return fd;
+}
+
+/****************************************/
+/*          Accept a connection         */
+/****************************************/
+Remote_Connection::ptr_t Remote_Connection::accept( int    listen_fd,
+                                                    size_t max_payload_bytes )
+{
+    const int fd = ::accept( listen_fd, nullptr, nullptr );
+    if( fd < 0 ){
+        return nullptr;
+    }
+
+    // Small input messages should not wait to be batched
+    const int no_delay = 1;
+    ::setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof( no_delay ) );
+    return std::make_unique<Remote_Connection>( fd, max_payload_bytes );
+}
+
+/****************************************/
+/*          Connect to a server         */
+/****************************************/
+Remote_Connection::ptr_t Remote_Connection::connect( const Remote_Endpoint& endpoint )
+{
+    int fd = -1;
+    if( endpoint.kind == Remote_Endpoint::Kind::UNIX ){
+        auto address = unix_address( endpoint );
+        fd = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+        if( fd >= 0 && ::connect( fd, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) ) != 0 ){
+            ::close( fd );
+            fd = -1;
+        }
+    }
+    else {
+        auto* addresses = tcp_addresses( endpoint, false );
+        for( auto* info = addresses; info != nullptr; info = info->ai_next ){
+            fd = ::socket( info->ai_family, info->ai_socktype, info->ai_protocol );
+            if( fd >= 0 && ::connect( fd, info->ai_addr, info->ai_addrlen ) == 0 ){
+                const int no_delay = 1;
+                ::setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof( no_delay ) );
+                break;
+            }
+            if( fd >= 0 ){
+                ::close( fd );
+                fd = -1;
+            }
+        }
+        ::freeaddrinfo( addresses );
+    }
+
+    if( fd < 0 ){
+        throw socket_error( "Unable to connect to remote display", endpoint );
+    }
+    return std::make_unique<Remote_Connection>( fd );
+}
+
+} // End of tmns::drv namespace
@@ -41,5 +41,21 @@ core::Options&  App_Base::options() {
 gui::Session& App_Base::session() {
     return m_session;
 }
+
+/**************************************/
+/*          Find the Menu Icon        */
+/**************************************/
+gui::Label::ptr_t App_Base::find_menu_icon( const std::string& name )
+{
+    const int icon_size = m_options.setting<int>( "menu", "icon_size" ).value_or( 96 );
+    const math::Size2i max_size( { icon_size, icon_size } );
+
+    auto& resources = m_session.resource_manager();
+    auto resource_name = resources.find_image_name( name, max_size );
+    if( !resource_name ){
+        return nullptr;
+    }
+    return gui::Label::from_resource_async( resource_name.value(), resources, max_size );
+}
     
 } // End of tmns::calc namespace
\ No newline at end of file
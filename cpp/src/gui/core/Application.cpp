@@ -16,6 +16,7 @@
 
 // Project Libraries
 #include <terminus/image.hpp>
+#include <terminus/log.hpp>
 
 namespace tmns::gui {
 
@@ -34,6 +35,14 @@ int Application::run()
             continue;
         }
 
+        // Draw at full rate while the user is interacting or something is animating
+        if( !m_session.input_events().empty() ||
+            m_session.driver().input_pending() ||
+            m_session.take_animation_request() )
+        {
+            m_frame_pacer.request_burst();
+        }
+
         // Update the main window data
         m_main_window->update( m_config, m_session );
 
@@ -45,7 +54,13 @@ int Application::run()
         
         // Show the session
         m_session.show();
+
+        // Sleep until the next frame is due, or the user does something
+        m_frame_pacer.wait_for_next_frame( [this]( auto until, auto poll_interval ){
+            return m_session.driver().wait_for_input( until, poll_interval );
+        });
     }
+    LOG_DEBUG( m_frame_pacer.to_log_string() );
 
     // Finalize session
     return m_session.finalize();
@@ -59,8 +74,11 @@ Application::Application( core::Options&       config,
                           I_Main_Window::ptr_t main_window )
     : m_config { config },
       m_session { session },
-      m_main_window { main_window }
-{}
+      m_main_window { main_window },
+      m_frame_pacer { Frame_Pacer::from_config( config ) }
+{
+    m_session.set_frame_rate( m_frame_pacer.target_fps() );
+}
 
 /************************************************/
 /*          Create Application Instance         */
@@ -0,0 +1,163 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_Pacer.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Adaptive frame-rate control for the application loop.
+ */
+#include <terminus/gui/core/Frame_Pacer.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <thread>
+
+namespace tmns::gui {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Frame_Pacer::Frame_Pacer( double                    target_fps,
+                          double                    idle_fps,
+                          std::chrono::milliseconds burst,
+                          std::chrono::milliseconds decay )
+    : m_target_fps { std::max( target_fps, 1.0 ) },
+      m_idle_fps { std::clamp( idle_fps, 0.1, m_target_fps ) },
+      m_burst { burst },
+      m_decay { decay },
+      m_last_activity { Clock::now() }
+{}
+
+/****************************************/
+/*          Run at the target rate      */
+/****************************************/
+void Frame_Pacer::request_burst( Clock::time_point now )
+{
+    m_last_activity = now;
+}
+
+/****************************************/
+/*          Busy frame rate             */
+/****************************************/
+double Frame_Pacer::target_fps() const {
+    return m_target_fps;
+}
+
+/****************************************/
+/*          Current frame rate          */
+/****************************************/
+double Frame_Pacer::fps( Clock::time_point now ) const
+{
+    const auto since_activity = now - m_last_activity;
+    if( since_activity <= m_burst ){
+        return m_target_fps;
+    }
+    if( m_decay.count() <= 0 ){
+        return m_idle_fps;
+    }
+
+    const double half_lives = std::chrono::duration<double>( since_activity - m_burst ) /
+                              std::chrono::duration<double>( m_decay );
+    const double rate = m_idle_fps + ( m_target_fps - m_idle_fps ) * std::exp2( -half_lives );
+
+    // Snap once the difference is no longer visible
+    return ( rate - m_idle_fps < 0.5 ) ? m_idle_fps : rate;
+}
+
+/****************************************/
+/*          Schedule the next frame     */
+/****************************************/
+Frame_Pacer::Clock::time_point Frame_Pacer::end_frame( Clock::time_point now )
+{
+    if( !m_started ){
+        m_deadline = now;
+        m_started  = true;
+    }
+
+    const double rate = fps( now );
+    const auto   interval = std::chrono::duration_cast<Clock::duration>( std::chrono::duration<double>( 1.0 / rate ) );
+
+    m_stats.frames++;
+    m_stats.current_fps     = rate;
+    m_stats.last_frame_time = std::chrono::duration_cast<std::chrono::microseconds>( now - m_deadline );
+
+    // Keep to the schedule unless this frame ran past the next deadline
+    m_deadline += interval;
+    if( now > m_deadline ){
+        auto overrun = std::chrono::duration_cast<std::chrono::microseconds>( now - m_deadline );
+        m_stats.missed_deadlines++;
+        m_stats.worst_overrun = std::max( m_stats.worst_overrun, overrun );
+        m_deadline = now;
+    }
+    return m_deadline;
+}
+
+/****************************************/
+/*          Sleep until the next frame  */
+/****************************************/
+void Frame_Pacer::wait_for_next_frame( const Waiter& wait )
+{
+    const auto next_frame = end_frame( Clock::now() );
+    if( !wait ){
+        std::this_thread::sleep_until( next_frame );
+        return;
+    }
+
+    // Poll at the active rate so input ends a long idle frame early
+    const auto poll_interval = std::chrono::duration_cast<Clock::duration>( std::chrono::duration<double>( 1.0 / m_target_fps ) );
+    if( wait( next_frame, poll_interval ) ){
+        m_deadline = std::min( m_deadline, Clock::now() );
+    }
+}
+
+/************************************/
+/*          Get the counters        */
+/************************************/
+Frame_Pacer::Stats Frame_Pacer::stats() const
+{
+    return m_stats;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Frame_Pacer::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Frame_Pacer:" << std::endl;
+    sout << gap << "  - Target FPS: " << m_target_fps << ", Idle FPS: " << m_idle_fps << std::endl;
+    sout << gap << "  - Burst: " << m_burst.count() << " ms, Decay: " << m_decay.count() << " ms" << std::endl;
+    sout << gap << "  - Frames: " << m_stats.frames << ", Missed Deadlines: " << m_stats.missed_deadlines
+         << ", Worst Overrun: " << m_stats.worst_overrun.count() << " us" << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Build from the configuration        */
+/************************************************/
+Frame_Pacer Frame_Pacer::from_config( core::Options& config )
+{
+    auto target_fps = config.setting<float>( "display", "target_fps" ).value_or( DEFAULT_TARGET_FPS );
+    auto idle_fps   = config.setting<float>( "display", "idle_fps" ).value_or( DEFAULT_IDLE_FPS );
+    auto burst_ms   = config.setting<size_t>( "display", "burst_ms" ).value_or( DEFAULT_BURST.count() );
+    auto decay_ms   = config.setting<size_t>( "display", "decay_ms" ).value_or( DEFAULT_DECAY.count() );
+
+    return Frame_Pacer( target_fps,
+                        idle_fps,
+                        std::chrono::milliseconds( burst_ms ),
+                        std::chrono::milliseconds( decay_ms ) );
+}
+
+} // End of tmns::gui namespace
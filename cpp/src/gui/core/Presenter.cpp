@@ -0,0 +1,289 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Presenter.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Hands finished frames to a presentation thread.
+ */
+#include <terminus/gui/core/Presenter.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/log.hpp>
+
+namespace tmns::gui {
+
+/********************************/
+/*      Convert to String       */
+/********************************/
+std::string to_string( PresentPolicy policy )
+{
+    switch( policy ){
+        case PresentPolicy::DROP:
+            return "DROP";
+        case PresentPolicy::QUEUE:
+            return "QUEUE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/****************************************/
+/*          Parse a policy name         */
+/****************************************/
+PresentPolicy present_policy_from_string( const std::string& name )
+{
+    if( name == "drop" || name == "DROP" ){
+        return PresentPolicy::DROP;
+    }
+    if( name == "queue" || name == "QUEUE" ){
+        return PresentPolicy::QUEUE;
+    }
+    std::stringstream sout;
+    sout << "Unknown present policy: " << name << ". Expected drop or queue.";
+    throw std::runtime_error( sout.str() );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Presenter::Presenter( Sink            sink,
+                      img::Dimensions dims,
+                      size_t          buffer_count,
+                      PresentPolicy   policy )
+    : m_sink { std::move( sink ) },
+      m_buffer_count { std::clamp<size_t>( buffer_count, 2, MAX_BUFFERS ) },
+      m_policy { policy }
+{
+    for( size_t i = 0; i < m_buffer_count; i++ ){
+        m_slots[i].frame.resize( dims, 255 );
+    }
+    m_slots[m_back].state.store( State::RENDERING );
+
+    m_thread = std::thread( [this](){ present_loop(); } );
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Presenter::~Presenter()
+{
+    stop();
+}
+
+/****************************************/
+/*          Get the back buffer         */
+/****************************************/
+img::Frame& Presenter::back_buffer()
+{
+    return m_slots[m_back].frame;
+}
+
+/****************************************/
+/*          Submit the back buffer      */
+/****************************************/
+void Presenter::submit()
+{
+    auto& slot = m_slots[m_back];
+    slot.sequence.store( ++m_submitted, std::memory_order_relaxed );
+    slot.state.store( State::READY, std::memory_order_release );
+    m_last_submitted = m_back;
+
+    m_submit_count.fetch_add( 1, std::memory_order_release );
+    m_submit_count.notify_one();
+
+    acquire_back_buffer();
+}
+
+/****************************************/
+/*          Wait for the queue          */
+/****************************************/
+void Presenter::flush()
+{
+    while( true ){
+        const auto released = m_release_count.load( std::memory_order_acquire );
+        if( m_presented.load() + m_dropped.load() >= m_submitted ){
+            return;
+        }
+        m_release_count.wait( released, std::memory_order_acquire );
+    }
+}
+
+/************************************************/
+/*          Stop the presentation thread        */
+/************************************************/
+void Presenter::stop()
+{
+    if( !m_thread.joinable() ){
+        return;
+    }
+    m_stopping.store( true );
+    m_submit_count.fetch_add( 1, std::memory_order_release );
+    m_submit_count.notify_one();
+    m_thread.join();
+}
+
+/************************************/
+/*          Get the counters        */
+/************************************/
+Presenter::Stats Presenter::stats() const
+{
+    Stats stats;
+    stats.submitted    = m_submitted;
+    stats.presented    = m_presented.load();
+    stats.dropped      = m_dropped.load();
+    stats.render_waits = m_render_waits;
+    return stats;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Presenter::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+    auto stats = this->stats();
+
+    std::stringstream sout;
+    sout << gap << "Presenter:" << std::endl;
+    sout << gap << "  - Buffers: " << m_buffer_count << ", Policy: " << to_string( m_policy ) << std::endl;
+    sout << gap << "  - Submitted: " << stats.submitted << ", Presented: " << stats.presented
+         << ", Dropped: " << stats.dropped << ", Render Waits: " << stats.render_waits << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Acquire the next back buffer        */
+/************************************************/
+void Presenter::acquire_back_buffer()
+{
+    size_t next = m_buffer_count;
+    while( next == m_buffer_count ){
+        const auto released = m_release_count.load( std::memory_order_acquire );
+
+        // Prefer a buffer nobody is using
+        for( size_t i = 0; i < m_buffer_count && next == m_buffer_count; i++ ){
+            auto expected = State::FREE;
+            if( m_slots[i].state.compare_exchange_strong( expected, State::RENDERING, std::memory_order_acq_rel ) ){
+                next = i;
+            }
+        }
+        if( next != m_buffer_count ){
+            break;
+        }
+
+        // Otherwise take back the oldest frame the presentation thread has not started
+        if( m_policy == PresentPolicy::DROP ){
+            size_t oldest = m_buffer_count;
+            for( size_t i = 0; i < m_buffer_count; i++ ){
+                if( m_slots[i].state.load( std::memory_order_acquire ) == State::READY &&
+                    ( oldest == m_buffer_count || m_slots[i].sequence.load() < m_slots[oldest].sequence.load() ) )
+                {
+                    oldest = i;
+                }
+            }
+            auto expected = State::READY;
+            if( oldest != m_buffer_count &&
+                m_slots[oldest].state.compare_exchange_strong( expected, State::RENDERING, std::memory_order_acq_rel ) )
+            {
+                m_dropped.fetch_add( 1 );
+                next = oldest;
+            }
+            continue;
+        }
+
+        // Queued frames are never replaced, so wait for one to be presented
+        m_render_waits++;
+        m_release_count.wait( released, std::memory_order_acquire );
+    }
+    m_back = next;
+
+    // Carry the last frame forward so only changes need redrawing
+    auto& back = m_slots[m_back];
+    auto& last = m_slots[m_last_submitted];
+    if( back.sequence.load( std::memory_order_relaxed ) != last.sequence.load( std::memory_order_relaxed ) ){
+        std::memcpy( back.frame.data(), last.frame.pixels().data(), last.frame.pixels().size() );
+        back.sequence.store( last.sequence.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+    }
+}
+
+/********************************************/
+/*          Presentation thread loop        */
+/********************************************/
+void Presenter::present_loop()
+{
+    while( true ){
+        const auto submits = m_submit_count.load( std::memory_order_acquire );
+
+        // Queued frames go oldest first.  Dropping presents the newest and discards the rest.
+        size_t pick = m_buffer_count;
+        for( size_t i = 0; i < m_buffer_count; i++ ){
+            if( m_slots[i].state.load( std::memory_order_acquire ) != State::READY ){
+                continue;
+            }
+            if( pick == m_buffer_count ){
+                pick = i;
+                continue;
+            }
+            const bool older = m_slots[i].sequence.load() < m_slots[pick].sequence.load();
+            if( older == ( m_policy == PresentPolicy::QUEUE ) ){
+                pick = i;
+            }
+        }
+
+        if( pick == m_buffer_count ){
+            if( m_stopping.load() ){
+                return;
+            }
+            m_submit_count.wait( submits, std::memory_order_acquire );
+            continue;
+        }
+
+        auto expected = State::READY;
+        if( !m_slots[pick].state.compare_exchange_strong( expected, State::PRESENTING, std::memory_order_acq_rel ) ){
+            continue;
+        }
+
+        // Older frames would now show out of order
+        if( m_policy == PresentPolicy::DROP ){
+            for( size_t i = 0; i < m_buffer_count; i++ ){
+                auto ready = State::READY;
+                if( i != pick &&
+                    m_slots[i].sequence.load() < m_slots[pick].sequence.load() &&
+                    m_slots[i].state.compare_exchange_strong( ready, State::FREE, std::memory_order_acq_rel ) )
+                {
+                    m_dropped.fetch_add( 1 );
+                    m_release_count.fetch_add( 1, std::memory_order_release );
+                }
+            }
+        }
+
+        try {
+            m_sink( m_slots[pick].frame );
+        }
+        catch( const std::exception& e ){
+            LOG_WARNING( std::string( "Unable to present frame. " ) + e.what() );
+        }
+
+        m_presented.fetch_add( 1 );
+        m_slots[pick].state.store( State::FREE, std::memory_order_release );
+        m_release_count.fetch_add( 1, std::memory_order_release );
+        m_release_count.notify_all();
+    }
+}
+
+} // End of tmns::gui namespace
@@ -14,10 +14,74 @@
  */
 #include <terminus/gui/core/Resource_Manager.hpp>
 
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <vector>
+
 // Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_File.hpp>
 #include <terminus/log.hpp>
 
 namespace tmns::gui {
+namespace {
+
+/// First bytes of every PNG file
+constexpr std::array<uint8_t,8> PNG_SIGNATURE { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+/**
+ * Read a big-endian 32-bit value
+ */
+uint32_t read_be32( const uint8_t* data )
+{
+    return ( static_cast<uint32_t>( data[0] ) << 24 ) |
+           ( static_cast<uint32_t>( data[1] ) << 16 ) |
+           ( static_cast<uint32_t>( data[2] ) <<  8 ) |
+             static_cast<uint32_t>( data[3] );
+}
+
+/**
+ * Get the size of a PNG or Terminus frame file from its header, without decoding it
+ */
+std::optional<math::Size2i> read_image_size( const std::filesystem::path& pathname )
+{
+    std::array<uint8_t,img::Frame_File_Header::SIZE_BYTES> header {};
+    std::ifstream fin( pathname, std::ios::binary );
+    fin.read( reinterpret_cast<char*>( header.data() ), static_cast<std::streamsize>( header.size() ) );
+    const auto count = static_cast<size_t>( fin.gcount() );
+
+    // PNG: the signature, then the IHDR chunk starting with the width and height
+    if( count >= 24 && std::equal( PNG_SIGNATURE.begin(), PNG_SIGNATURE.end(), header.begin() ) ){
+        return math::Size2i( { static_cast<int>( read_be32( header.data() + 16 ) ),
+                               static_cast<int>( read_be32( header.data() + 20 ) ) } );
+    }
+
+    // Terminus frame file: the magic, then the width and height at fixed offsets
+    const auto& magic = img::Frame_File_Header::MAGIC;
+    if( count == header.size() &&
+        std::equal( magic.begin(), magic.end(), header.begin(),
+                    []( char a, uint8_t b ){ return static_cast<uint8_t>( a ) == b; } ) )
+    {
+        return math::Size2i( { static_cast<int>( core::read_le<uint32_t>( header.data() + 8 ) ),
+                               static_cast<int>( core::read_le<uint32_t>( header.data() + 12 ) ) } );
+    }
+    return {};
+}
+
+/**
+ * A load result which is already finished
+ */
+drv::Image_Loader::Result ready_result( img::Frame::ptr_t frame )
+{
+    std::promise<img::Frame::ptr_t> promise;
+    promise.set_value( std::move( frame ) );
+    return promise.get_future().share();
+}
+
+} // End of anonymous namespace
 
 /********************************/
 /*          Destructor          */
@@ -35,30 +99,191 @@ void Resource_Manager::finalize()
     m_loaded_frames.clear();
 }
 
+/************************************/
+/*          Add a new image         */
+/************************************/
+void Resource_Manager::add_image( std::string       name,
+                                  img::Frame::ptr_t image )
+{
+    m_loaded_frames[name] = image;
+}
+
+/****************************************/
+/*          Get a loaded image          */
+/****************************************/
+std::optional<img::Frame::ptr_t> Resource_Manager::get_image( std::string name )
+{
+    auto it = m_loaded_frames.find( name );
+    if( it == m_loaded_frames.end() ){
+        return {};
+    }
+    return it->second;
+}
+
+/************************************/
+/*          Release an image        */
+/************************************/
+bool Resource_Manager::release_image( std::string name )
+{
+    return m_loaded_frames.erase( name ) > 0;
+}
+
+/****************************************/
+/*          Load an image by name       */
+/****************************************/
+std::optional<img::Frame::ptr_t> Resource_Manager::load_image( const std::string& name )
+{
+    if( auto cached = get_image( name ) ){
+        return cached;
+    }
+
+    img::Frame::ptr_t frame;
+    if( m_bundle ){
+        if( auto blob = m_bundle->find( name ) ){
+            frame = img::frame_from_buffer( blob.value(), m_bundle );
+        }
+    }
+
+    if( !frame ){
+        auto pathname = m_resource_root / name;
+        if( !std::filesystem::exists( pathname ) ){
+            LOG_WARNING( "Resource not found in bundle or at " + pathname.native() );
+            return {};
+        }
+        frame = m_driver.load_image( pathname );
+    }
+
+    // The compositor works in premultiplied alpha.  Convert once here rather than on every draw.
+    if( frame->channels() == 4 && !frame->is_premultiplied() ){
+        img::premultiply_alpha( frame->data(), frame->cols() * frame->rows() );
+        frame->set_premultiplied( true );
+    }
+
+    add_image( name, frame );
+    return frame;
+}
+
+/************************************************/
+/*          Copy an image for modification      */
+/************************************************/
+std::optional<img::Frame::ptr_t> Resource_Manager::derive_image( const std::string& name )
+{
+    auto frame = load_image( name );
+    if( !frame ){
+        return {};
+    }
+    return std::make_shared<img::Frame>( *frame.value() );
+}
+
 /********************************************/
 /*          Find and load the image         */
 /********************************************/
-std::optional<img::Frame::ptr_t> Resource_Manager::find_image( [[maybe_unused]] std::string   image_name,
-                                                               [[maybe_unused]] math::Size2i  max_size )
+std::optional<img::Frame::ptr_t> Resource_Manager::find_image( std::string   image_name,
+                                                               math::Size2i  max_size )
 {
-    return {};
-}                                                               
-                                                               
+    auto name = find_image_name( image_name, max_size );
+    if( !name ){
+        return {};
+    }
+    return load_image( name.value() );
+}
+
+/********************************************/
+/*          Pick the image to load          */
+/********************************************/
+std::optional<std::string> Resource_Manager::find_image_name( const std::string& image_name,
+                                                              math::Size2i       max_size )
+{
+    const std::string prefix = "images/" + image_name + "/";
+
+    // Gather the size of every candidate image
+    std::vector<std::pair<std::string,math::Size2i>> candidates;
+    if( m_bundle ){
+        for( const auto& name : m_bundle->names() ){
+            if( !name.starts_with( prefix ) ){
+                continue;
+            }
+            auto header = img::Frame_File_Header::parse( m_bundle->find( name ).value() );
+            candidates.emplace_back( std::string( name ),
+                                     math::Size2i( { static_cast<int>( header.cols ),
+                                                     static_cast<int>( header.rows ) } ) );
+        }
+    }
+    else {
+        auto folder = m_resource_root / "images" / image_name;
+        if( std::filesystem::is_directory( folder ) ){
+            for( const auto& entry : std::filesystem::directory_iterator( folder ) ){
+                auto name = prefix + entry.path().filename().string();
+                if( auto size = read_image_size( entry.path() ) ){
+                    candidates.emplace_back( name, size.value() );
+                }
+                else if( auto frame = load_image( name ) ){
+                    candidates.emplace_back( name, frame.value()->size() );
+                }
+            }
+        }
+    }
+
+    // Pick the largest image which still fits
+    std::optional<std::string> best_name;
+    int best_area = -1;
+    for( const auto& [name, size] : candidates ){
+        if( size.width() <= max_size.width() &&
+            size.height() <= max_size.height() &&
+            size.width() * size.height() > best_area )
+        {
+            best_name = name;
+            best_area = size.width() * size.height();
+        }
+    }
+
+    if( !best_name ){
+        LOG_WARNING( "No image in " + prefix + " fits the requested size" );
+    }
+    return best_name;
+}
+
+/********************************************/
+/*      Load an image in the background     */
+/********************************************/
+drv::Image_Loader::Result Resource_Manager::load_image_async( const std::string& name )
+{
+    if( auto cached = get_image( name ) ){
+        return ready_result( cached.value() );
+    }
+
+    // Bundled pixels are mapped, so there is nothing worth moving off this thread
+    if( m_bundle && m_bundle->find( name ) ){
+        return ready_result( load_image( name ).value_or( nullptr ) );
+    }
+
+    auto pathname = m_resource_root / name;
+    if( !std::filesystem::exists( pathname ) ){
+        std::promise<img::Frame::ptr_t> promise;
+        promise.set_exception( std::make_exception_ptr( std::runtime_error( "Resource not found in bundle or at " + pathname.native() ) ) );
+        return promise.get_future().share();
+    }
+    return m_driver.load_image_async( pathname );
+}
+
 /************************************/
 /*          Create Instance         */
 /************************************/
 Resource_Manager::ptr_t Resource_Manager::create( const std::filesystem::path& resource_root,
+                                                  core::Resource_Bundle::ptr_t bundle,
                                                   drv::Driver_Base&            driver )
 {
-    return Resource_Manager::ptr_t( new Resource_Manager( resource_root, driver ) );
+    return Resource_Manager::ptr_t( new Resource_Manager( resource_root, std::move( bundle ), driver ) );
 }
 
 /************************************************/
 /*          Parameterized Constructor           */
 /************************************************/
 Resource_Manager::Resource_Manager( const std::filesystem::path& resource_root,
+                                    core::Resource_Bundle::ptr_t bundle,
                                     drv::Driver_Base&            driver )
     : m_resource_root { resource_root },
+      m_bundle { std::move( bundle ) },
       m_driver { driver }
 {}
 
@@ -22,12 +22,26 @@
 #include <terminus/driver/DriverAllegro.hpp>
 #elif RENDER_DRIVER == 3
 #include <terminus/driver/DriverRaylib.hpp>
+#elif RENDER_DRIVER == 4
+#include <terminus/driver/DriverFBDev.hpp>
 #endif
+#if TERMINUS_EMBEDDED_RESOURCES
+#include <terminus/core/Embedded_Resources.hpp>
+#endif
+#if TERMINUS_POSIX
+#include <terminus/driver/DriverRemote.hpp>
+#endif
+#include <terminus/driver/DriverReplay.hpp>
+#include <terminus/driver/DriverSPISim.hpp>
+#include <terminus/image/Frame_Pool.hpp>
+#include <terminus/log.hpp>
 
 // C++ Standard Libraries
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <thread>
+#include <utility>
 
 namespace tmns::gui {
 
@@ -50,6 +64,11 @@ drv::Driver_Base& Session::driver() const{
 /*          Get Frame Instance          */
 /****************************************/
 img::Frame& Session::active_frame(){
+#if TERMINUS_POSIX
+    if( m_presenter ){
+        return m_presenter->back_buffer();
+    }
+#endif
     return m_active_frame;
 }
 
@@ -65,7 +84,53 @@ Resource_Manager& Session::resource_manager()
 /*          Check if we should exit         */
 /********************************************/
 bool Session::okay_to_run(){
-    return m_driver->okay_to_run();
+    if( !m_driver->okay_to_run() ){
+        return false;
+    }
+
+    // Keys are taken once per frame, so a recording can tie each one to its frame
+    m_input_events = m_driver->take_input_events();
+    return true;
+}
+
+/****************************************/
+/*          Get this frame's keys       */
+/****************************************/
+const std::vector<drv::Input_Event>& Session::input_events() const
+{
+    return m_input_events;
+}
+
+/****************************************/
+/*          Request an animation        */
+/****************************************/
+void Session::request_animation()
+{
+    m_animation_requested = true;
+}
+
+/****************************************/
+/*          Take the request            */
+/****************************************/
+bool Session::take_animation_request()
+{
+    return std::exchange( m_animation_requested, false );
+}
+
+/****************************************/
+/*          Read the frame clock        */
+/****************************************/
+std::chrono::duration<double> Session::frame_clock() const
+{
+    return m_frame_interval * static_cast<double>( m_frames_shown );
+}
+
+/****************************************/
+/*      Set the frame clock's rate      */
+/****************************************/
+void Session::set_frame_rate( double fps )
+{
+    m_frame_interval = std::chrono::duration<double>( 1.0 / std::max( fps, 1.0 ) );
 }
 
 /****************************************/
@@ -75,12 +140,28 @@ int Session::finalize()
 {
     int ecode = 0;
 
-    // Clean up the driver
+    // Present anything still queued before the driver goes away
+#if TERMINUS_POSIX
+    if( m_presenter ){
+        m_presenter->stop();
+        LOG_DEBUG( m_presenter->to_log_string() );
+        m_presenter.reset();
+    }
+#endif
+
+    // Clean up the driver, once the image loader is no longer using it
     if( m_driver ){
+        m_driver->stop_image_loader();
         ecode |= m_driver->finalize();
     }
     m_driver.reset();
 
+    // Close the recording
+    if( m_recorder ){
+        LOG_DEBUG( m_recorder->to_log_string() );
+        m_recorder.reset();
+    }
+
     // Clean up the resource-manager
     m_resource_manager->finalize();
 
@@ -103,7 +184,28 @@ void Session::sleep_for( std::chrono::milliseconds sleep_time )
 /********************************************************/
 void Session::show()
 {
-    m_driver->show( m_active_frame );
+    auto& frame = active_frame();
+
+    // Record before handing the frame off
+    if( m_recorder ){
+        auto elapsed = std::chrono::steady_clock::now() - m_record_start;
+        try {
+            m_recorder->write( frame, std::chrono::duration_cast<std::chrono::microseconds>( elapsed ) );
+        }
+        catch( const std::runtime_error& e ){
+            LOG_WARNING( std::string( "Stopping recording. " ) + e.what() );
+            m_recorder.reset();
+        }
+    }
+
+    m_frames_shown++;
+#if TERMINUS_POSIX
+    if( m_presenter ){
+        m_presenter->submit();
+        return;
+    }
+#endif
+    m_driver->show( frame );
 }
 
 /************************************************/
@@ -117,6 +219,11 @@ std::string Session::to_log_string( size_t offset ) const
     sout << gap << "Session:" << std::endl;
     sout << gap << "  - Active Frame:" << std::endl;
     sout << m_active_frame.to_log_string( offset + 4 ) << std::endl;
+#if TERMINUS_POSIX
+    if( m_presenter ){
+        sout << m_presenter->to_log_string( offset + 2 );
+    }
+#endif
     return sout.str();
 }
 
@@ -127,24 +234,117 @@ Session::ptr_t Session::create( core::Options config )
 {
     // Grab some relevant config parameters
     auto resource_root = config.check_and_get_setting<std::filesystem::path>( "resources", "root_dir" );
+    auto pool_kb       = config.setting<size_t>( "memory", "frame_pool_kb" );
+
+    // Size the shared frame pool before anything loads
+    if( pool_kb ){
+        img::Frame_Pool::instance().set_max_cached_bytes( pool_kb.value() * 1024 );
+    }
+
+    // Replays run without a display unless asked, and remote viewing can do without one
+    auto recording = config.setting<std::filesystem::path>( "input", "record_path" ).has_value();
+    auto replaying = config.setting<std::filesystem::path>( "input", "replay_path" ).has_value();
+    auto remote    = config.setting<bool>( "remote", "enabled" ).value_or( false );
+    auto headless  = ( replaying && config.setting<bool>( "input", "replay_headless" ).value_or( true ) ) ||
+                     ( remote && config.setting<bool>( "remote", "headless" ).value_or( false ) );
 
     // Build the driver depending on how we compiled the app
     drv::Driver_Base::ptr_t driver;
 
+    if( !headless ){
 #if RENDER_DRIVER == 2
-    driver = drv::Driver_Allegro::create( config );
+        driver = drv::Driver_Allegro::create( config );
 #elif RENDER_DRIVER == 3
-    driver = drv::Driver_Raylib::create( config );
+        driver = drv::Driver_Raylib::create( config );
+#elif RENDER_DRIVER == 4
+        driver = drv::Driver_FBDev::create( config );
 #else
     #error Not supported yet
 #endif
+    }
+
+    // Measure what every frame would cost to send to an SPI panel
+    if( config.setting<bool>( "spi_sim", "enabled" ).value_or( false ) ){
+        driver = drv::Driver_SPI_Sim::create( config, std::move( driver ) );
+    }
+
+    // Serve the screen to viewers on other machines, and take their input
+    if( remote ){
+#if TERMINUS_POSIX
+        driver = drv::Driver_Remote::create( config, std::move( driver ) );
+#else
+        LOG_WARNING( "Remote viewing needs sockets, which this build does not have." );
+#endif
+    }
+
+    // Record the user's input, or replay it, timing every frame
+    if( recording || replaying ){
+        driver = drv::Driver_Replay::create( config, std::move( driver ) );
+    }
+
+    // Map the resource bundle if one is configured
+    core::Resource_Bundle::ptr_t bundle;
+#if TERMINUS_POSIX
+    auto bundle_path = config.setting<std::filesystem::path>( "resources", "bundle_path" );
+    if( bundle_path && std::filesystem::exists( bundle_path.value() ) ){
+        bundle = core::Resource_Bundle::open( bundle_path.value() );
+        LOG_DEBUG( bundle->to_log_string() );
+    }
+    else if( bundle_path ){
+        LOG_WARNING( "Resource bundle not found, using loose resources. Path: " + bundle_path.value().native() );
+    }
+#endif
+
+#if TERMINUS_EMBEDDED_RESOURCES
+    // Fall back to the resources linked into the binary.  They live for the entire program.
+    if( !bundle ){
+        bundle = core::Resource_Bundle::from_buffer( core::embedded_bundle(), nullptr );
+        LOG_DEBUG( "Using embedded resources. " + bundle->to_log_string() );
+    }
+#endif
 
     // Construct new resource manager
-    auto resource_manager = Resource_Manager::create( resource_root, (*driver) );
+    auto resource_manager = Resource_Manager::create( resource_root, bundle, (*driver) );
 
     // Build the new session
-    return Session::ptr_t( new Session( std::move( driver ), 
-                                        std::move( resource_manager ) ) );
+    auto session = Session::ptr_t( new Session( std::move( driver ),
+                                                std::move( resource_manager ) ) );
+
+    // Record every frame shown if asked
+    auto record_path = config.setting<std::filesystem::path>( "recording", "output_path" );
+    if( record_path ){
+        auto keyframe_interval = config.setting<size_t>( "recording", "keyframe_interval" )
+                                       .value_or( img::Delta_Encoder::DEFAULT_KEYFRAME_INTERVAL );
+        session->m_recorder     = img::Recording_Writer::create( record_path.value(), keyframe_interval );
+        session->m_record_start = std::chrono::steady_clock::now();
+        LOG_DEBUG( "Recording session to " + record_path.value().native() );
+    }
+
+    // Present on a separate thread if asked and the driver allows it.  With vsync the
+    // present thread waits on the display, so dropping stale frames keeps latency down.
+    // Without it, presenting is quick enough to show every frame.
+    auto present_buffers = config.setting<size_t>( "display", "present_buffers" ).value_or( 1 );
+#if TERMINUS_POSIX
+    auto caps = session->m_driver->capabilities();
+    if( present_buffers > 1 && caps.threaded_show ){
+        auto policy = present_policy_from_string( config.setting<std::string>( "display", "present_policy" )
+                                                        .value_or( caps.vsync ? "drop" : "queue" ) );
+        auto& drv   = *session->m_driver;
+        session->m_presenter = std::make_unique<Presenter>( [&drv]( img::Frame& frame ){ drv.show( frame ); },
+                                                            drv.get_screen_dimensions(),
+                                                            present_buffers,
+                                                            policy );
+        session->m_active_frame.clear();
+    }
+    else if( present_buffers > 1 ){
+        LOG_INFO( "Driver must present from its own thread, showing frames synchronously." );
+    }
+#else
+    if( present_buffers > 1 ){
+        LOG_INFO( "This build has no threads, showing frames synchronously." );
+    }
+#endif
+    return session;
 }
 
 /************************************************/
@@ -155,8 +355,22 @@ Session::Session( drv::Driver_Base::ptr_t driver,
     : m_driver { std::move( driver ) },
       m_resource_manager { std::move( resource_manager ) }
 {
+    // The compositor draws in RGBA, so other formats are converted as the driver shows them
+    auto caps = m_driver->capabilities();
+    auto dims = m_driver->get_screen_dimensions();
+    LOG_DEBUG( caps.to_log_string() );
+    if( !caps.fits( dims.size() ) ){
+        std::stringstream sout;
+        sout << "Screen size " << dims.cols() << " x " << dims.rows() << " exceeds the driver's limit of "
+             << caps.max_texture_size.width() << " x " << caps.max_texture_size.height();
+        throw std::runtime_error( sout.str() );
+    }
+    if( !caps.is_native( img::PixelFormat::RGBA ) && !caps.native_formats.empty() ){
+        LOG_INFO( "Frames are converted to " + img::to_string( caps.native_formats.front() ) + " when shown." );
+    }
+
     // Set the default frame size
-    m_active_frame.resize( m_driver->get_screen_dimensions(), 255 );
+    m_active_frame.resize( dims, 255 );
 }
 
 } // End of tmns::gui namespace
\ No newline at end of file
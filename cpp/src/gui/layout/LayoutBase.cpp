@@ -19,8 +19,36 @@
 // Terminus Libraries
 #include <terminus/log.hpp>
 
+// C++ Standard Libraries
+#include <algorithm>
+#include <utility>
+
 namespace tmns::gui {
 
+namespace {
+
+/**
+ * Add two lengths, keeping unbounded lengths unbounded
+ */
+int add_length( int a, int b )
+{
+    return std::min( a + b, SizeHint::UNBOUNDED );
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Destructor          */
+/********************************/
+LayoutBase::~LayoutBase()
+{
+    for( auto& item : m_widgets ){
+        if( item.widget && item.widget->m_parent_layout == this ){
+            item.widget->m_parent_layout = nullptr;
+        }
+    }
+}
+
 /****************************************/
 /*          Render the padding          */
 /****************************************/
@@ -77,7 +105,184 @@ math::Size2i LayoutBase::layout_size() const {
 /*          Set Layout Dimensions       */
 /****************************************/
 void LayoutBase::set_layout_size( math::Size2i layout_size ){
-    m_layout_size = layout_size;
+
+    if( layout_size.width() != m_layout_size.width() || layout_size.height() != m_layout_size.height() ){
+        m_layout_size   = layout_size;
+        m_arrange_dirty = true;
+    }
+
+    const bool width_changed  = layout_size.width()  != m_declared_size.width();
+    const bool height_changed = layout_size.height() != m_declared_size.height();
+    m_declared_size = layout_size;
+
+    // A declared size on a FIXED axis is part of the measurement
+    if( ( width_changed  && m_horizontal_stretch_policy == StretchPolicy::FIXED ) ||
+        ( height_changed && m_vertical_stretch_policy   == StretchPolicy::FIXED ) ){
+        invalidate();
+    }
+}
+
+/************************************************/
+/*      Get the Horizontal Stretch Policy       */
+/************************************************/
+StretchPolicy LayoutBase::horizontal_stretch_policy() const {
+    return m_horizontal_stretch_policy;
+}
+
+/************************************************/
+/*      Set the Horizontal Stretch Policy       */
+/************************************************/
+void LayoutBase::set_horizontal_stretch_policy( StretchPolicy policy ){
+    m_horizontal_stretch_policy = policy;
+    invalidate();
+}
+
+/********************************************/
+/*      Get the Vertical Stretch Policy     */
+/********************************************/
+StretchPolicy LayoutBase::vertical_stretch_policy() const {
+    return m_vertical_stretch_policy;
+}
+
+/********************************************/
+/*      Set the Vertical Stretch Policy     */
+/********************************************/
+void LayoutBase::set_vertical_stretch_policy( StretchPolicy policy ){
+    m_vertical_stretch_policy = policy;
+    invalidate();
+}
+
+/********************************************/
+/*      Set a Widget's Stretch Policy       */
+/********************************************/
+void LayoutBase::set_item_stretch( int           index,
+                                   StretchPolicy policy )
+{
+    if( index < 0 || static_cast<size_t>( index ) >= m_widgets.size() ){
+        std::stringstream sout;
+        sout << "Widget index " << index << " is out of range.  Layout has " << m_widgets.size() << " widgets.";
+        throw std::runtime_error( sout.str() );
+    }
+    m_widgets[static_cast<size_t>( index )].layout_info.stretch = policy;
+    invalidate();
+}
+
+/****************************************/
+/*          Measure the Layout          */
+/****************************************/
+const SizeHint& LayoutBase::measure() const
+{
+    if( m_measured ){
+        return m_measured.value();
+    }
+
+    auto hint = measure_content();
+
+    // Padding surrounds the content
+    const int pad_cols = m_padding[0] + m_padding[1];
+    const int pad_rows = m_padding[2] + m_padding[3];
+    for( size_t axis = 0; axis < 2; axis++ ){
+        const int pad = axis == 0 ? pad_cols : pad_rows;
+        hint.minimum[axis]   = add_length( hint.minimum[axis],   pad );
+        hint.preferred[axis] = add_length( hint.preferred[axis], pad );
+        hint.maximum[axis]   = add_length( hint.maximum[axis],   pad );
+
+        // Apply the stretch policy
+        const auto policy = axis == 0 ? m_horizontal_stretch_policy : m_vertical_stretch_policy;
+        if( policy == StretchPolicy::GROW ){
+            hint.maximum[axis] = SizeHint::UNBOUNDED;
+        }
+        else if( m_declared_size[axis] > 0 ){
+            hint.minimum[axis]   = m_declared_size[axis];
+            hint.preferred[axis] = m_declared_size[axis];
+            hint.maximum[axis]   = m_declared_size[axis];
+        }
+        else {
+            hint.maximum[axis] = hint.preferred[axis];
+        }
+    }
+
+    m_measured = hint;
+    return m_measured.value();
+}
+
+/****************************************/
+/*          Arrange the Layout          */
+/****************************************/
+void LayoutBase::arrange( math::Size2i size )
+{
+    if( size.width() != m_layout_size.width() || size.height() != m_layout_size.height() ){
+        m_layout_size   = size;
+        m_arrange_dirty = true;
+    }
+    if( !m_arrange_dirty ){
+        return;
+    }
+
+    auto bboxes = allocate_bboxes();
+
+    m_placed.clear();
+    for( size_t idx = 0; idx < m_widgets.size(); idx++ ){
+
+        auto& item = m_widgets[idx];
+        const auto& bbox = bboxes[idx];
+
+        // Widgets without an alignment fill their slot.  Others take what they can use
+        // and are aligned within it.
+        auto placed = bbox;
+        if( !item.layout_info.alignment.empty() && bbox.area() > 0 ){
+            const auto hint = item.widget->size_hint();
+            math::Size2i widget_size( { std::min( bbox.width(),  hint.maximum.width() ),
+                                        std::min( bbox.height(), hint.maximum.height() ) } );
+            placed = align_widget( bbox, widget_size, item.layout_info.alignment );
+        }
+
+        if( placed.area() > 0 ){
+            item.widget->arrange( math::Size2i( { placed.width(), placed.height() } ) );
+        }
+        m_placed.push_back( placed );
+    }
+
+    m_arrange_dirty = false;
+    m_arrange_count++;
+}
+
+/****************************************/
+/*          Get the Arrangement         */
+/****************************************/
+const std::vector<math::Rect2i>& LayoutBase::arrangement()
+{
+    arrange( m_layout_size );
+    return m_placed;
+}
+
+/****************************************/
+/*          Invalidate the Layout       */
+/****************************************/
+void LayoutBase::invalidate()
+{
+    m_measured.reset();
+    m_arrange_dirty = true;
+    if( m_owner ){
+        m_owner->invalidate_layout();
+    }
+}
+
+/****************************************/
+/*          Invalidate the Render       */
+/****************************************/
+void LayoutBase::invalidate_render() const
+{
+    if( m_owner ){
+        m_owner->invalidate_render();
+    }
+}
+
+/****************************************/
+/*          Get the Arrange Count       */
+/****************************************/
+size_t LayoutBase::arrange_count() const {
+    return m_arrange_count;
 }
 
 /************************************/
@@ -93,6 +298,7 @@ math::Vector4i LayoutBase::padding() const
 /************************************/
 void LayoutBase::set_padding( math::Vector4i padding ){
     m_padding = padding;
+    invalidate();
 }
 
 /************************************/
@@ -116,6 +322,7 @@ std::optional<math::Vector4u> LayoutBase::padding_color() const
 void LayoutBase::set_padding_color( math::Vector4u color )
 {
     m_padding_color = color;
+    invalidate_render();
 }
 
 /********************************************/
@@ -233,4 +440,131 @@ math::Rect2i LayoutBase::get_bbox_with_padding( math::Rect2i bbox ) const{
     return output;
 }
 
+/****************************************/
+/*          Add a Widget                */
+/****************************************/
+int LayoutBase::add_item( WidgetLayoutItem item )
+{
+    item.widget->m_parent_layout = this;
+    m_widgets.push_back( item );
+    invalidate();
+    return static_cast<int>( m_widgets.size() - 1 );
+}
+
+/****************************************/
+/*          Replace the Widgets         */
+/****************************************/
+void LayoutBase::replace_items( std::vector<WidgetLayoutItem> items )
+{
+    for( auto& item : m_widgets ){
+        if( item.widget->m_parent_layout == this ){
+            item.widget->m_parent_layout = nullptr;
+        }
+    }
+    for( auto& item : items ){
+        item.widget->m_parent_layout = this;
+    }
+    m_widgets       = std::move( items );
+    m_arrange_dirty = true;
+    invalidate_render();
+}
+
+/************************************************/
+/*          Measure a Row or Column             */
+/************************************************/
+SizeHint LayoutBase::measure_linear( size_t axis ) const
+{
+    const size_t cross = 1 - axis;
+
+    SizeHint hint;
+    hint.maximum[axis]  = 0;
+    hint.maximum[cross] = 0;
+    for( const auto& item : m_widgets ){
+        const auto child = item.widget->size_hint();
+
+        // Lengths add up along the axis
+        hint.minimum[axis]   = add_length( hint.minimum[axis],   child.minimum[axis] );
+        hint.preferred[axis] = add_length( hint.preferred[axis], child.preferred[axis] );
+        hint.maximum[axis]   = add_length( hint.maximum[axis],   child.maximum[axis] );
+
+        // The widest widget sets the size across
+        hint.minimum[cross]   = std::max( hint.minimum[cross],   child.minimum[cross] );
+        hint.preferred[cross] = std::max( hint.preferred[cross], child.preferred[cross] );
+        hint.maximum[cross]   = std::max( hint.maximum[cross],   child.maximum[cross] );
+    }
+    return hint;
+}
+
+/************************************************/
+/*          Allocate a Row or Column            */
+/************************************************/
+std::vector<math::Rect2i> LayoutBase::allocate_linear( size_t axis ) const
+{
+    // Get layout dimensions, less the padding
+    auto full_bbox = get_bbox_with_padding( math::Rect2i( math::Vector2i( { 0, 0 } ),
+                                                          layout_size() ) );
+
+    // Split the axis between the widgets
+    std::vector<FlexItem> items;
+    for( const auto& item : m_widgets ){
+        const auto hint = item.widget->size_hint();
+
+        FlexItem flex;
+        flex.minimum   = hint.minimum[axis];
+        flex.preferred = hint.preferred[axis];
+        flex.maximum   = hint.maximum[axis];
+        flex.ratio     = item.layout_info.ratio;
+        flex.stretch   = item.layout_info.stretch;
+        items.push_back( flex );
+    }
+    const auto lengths = flex_distribute( items, axis == 0 ? full_bbox.width() : full_bbox.height() );
+
+    // Lay the slots end to end
+    std::vector<math::Rect2i> bboxes;
+    int position = axis == 0 ? full_bbox.min().x() : full_bbox.min().y();
+    for( const auto length : lengths ){
+        if( axis == 0 ){
+            bboxes.push_back( math::Rect2i( math::ToPoint2<int>( position, full_bbox.min().y() ),
+                                            math::Size2i( { length, full_bbox.height() } ) ) );
+        } else {
+            bboxes.push_back( math::Rect2i( math::ToPoint2<int>( full_bbox.min().x(), position ),
+                                            math::Size2i( { full_bbox.width(), length } ) ) );
+        }
+        position += length;
+    }
+    return bboxes;
+}
+
+/************************************************/
+/*          Render the Arranged Widgets         */
+/************************************************/
+void LayoutBase::render_widgets( Session&         session,
+                                 img::Frame_View& image )
+{
+    const auto& placed = arrangement();
+    for( size_t idx = 0; idx < m_widgets.size(); idx++ )
+    {
+        // If widget is empty, then just skip the region
+        if( m_widgets[idx].widget->size_pixels().area() < 1 ){
+            LOG_WARNING( "Widget has empty area.\n" + m_widgets[idx].widget->to_log_string() );
+            continue;
+        }
+
+        // Widgets squeezed out of the layout are not drawn
+        if( placed[idx].area() < 1 ){
+            continue;
+        }
+
+        {
+            std::stringstream sout;
+            sout << "Widget: " << idx << " bbox: " << placed[idx].to_string();
+            LOG_TRACE( sout.str() );
+        }
+
+        // Crop a section of the input image to apply our rendering to
+        auto subview = image.subview( placed[idx] );
+        m_widgets[idx].widget->render( session, subview, 255 );
+    }
+}
+
 } // End of tmns::gui namespace
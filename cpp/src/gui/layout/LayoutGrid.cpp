@@ -0,0 +1,450 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    LayoutGrid.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Virtualized Grid Layout API
+ */
+#include <terminus/gui/layout/LayoutGrid.hpp>
+
+// Terminus Libraries
+#include <terminus/image/Raster.hpp>
+#include <terminus/log.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+
+namespace tmns::gui {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+LayoutGrid::LayoutGrid( math::Size2i cell_size,
+                        int          spacing )
+    : m_cell_size { cell_size },
+      m_spacing { std::max( spacing, 0 ) }
+{
+    if( cell_size.width() < 1 || cell_size.height() < 1 ){
+        throw std::runtime_error( "LayoutGrid cells must have a non-zero size. " + cell_size.to_string() );
+    }
+}
+
+/*****************************************/
+/*         Add Layout to Widget List     */
+/*****************************************/
+int LayoutGrid::append( WidgetBase::ptr_t new_widget ){
+    return append( new_widget, {}, {} );
+}
+
+/*****************************************/
+/*         Add Layout to Widget List     */
+/*****************************************/
+int LayoutGrid::append( WidgetBase::ptr_t                          new_widget,
+                        std::set<AlignmentPolicy>                  alignment,
+                        [[maybe_unused]] std::optional<double>     ratio ){
+
+    if( m_factory ){
+        throw std::runtime_error( "Cannot append widgets to a LayoutGrid which uses a cell factory." );
+    }
+
+    WidgetLayoutItem new_layout_item;
+    new_layout_item.widget                = new_widget;
+    new_layout_item.layout_info.alignment = alignment;
+    m_items.push_back( new_layout_item );
+
+    m_view_dirty = true;
+    invalidate();
+    return static_cast<int>( m_items.size() - 1 );
+}
+
+/****************************************/
+/*          Set the Cell Factory        */
+/****************************************/
+void LayoutGrid::set_cell_factory( size_t       item_count,
+                                   Cell_Factory factory )
+{
+    m_items.clear();
+    m_recycled.clear();
+    m_bound.clear();
+    replace_items( {} );
+
+    m_factory       = std::move( factory );
+    m_factory_count = item_count;
+    if( m_focus && m_focus.value() >= item_count ){
+        m_focus.reset();
+    }
+
+    m_view_dirty = true;
+    invalidate();
+}
+
+/****************************************/
+/*          Get the Item Count          */
+/****************************************/
+size_t LayoutGrid::item_count() const {
+    return m_factory ? m_factory_count : m_items.size();
+}
+
+/****************************************/
+/*          Get the Cell Size           */
+/****************************************/
+math::Size2i LayoutGrid::cell_size() const {
+    return m_cell_size;
+}
+
+/****************************************/
+/*          Get the Column Count        */
+/****************************************/
+size_t LayoutGrid::columns() const
+{
+    const auto content = get_bbox_with_padding( math::Rect2i( math::Vector2i( { 0, 0 } ), layout_size() ) );
+    const int  step    = m_cell_size.width() + m_spacing;
+    return static_cast<size_t>( std::max( ( content.width() + m_spacing ) / step, 1 ) );
+}
+
+/****************************************/
+/*          Get the Row Count           */
+/****************************************/
+size_t LayoutGrid::rows() const
+{
+    const auto cols = columns();
+    return ( item_count() + cols - 1 ) / cols;
+}
+
+/****************************************/
+/*          Get the First Row           */
+/****************************************/
+size_t LayoutGrid::first_visible_row() const {
+    return m_first_row;
+}
+
+/****************************************/
+/*          Get the Visible Rows        */
+/****************************************/
+size_t LayoutGrid::visible_rows() const
+{
+    const auto content = get_bbox_with_padding( math::Rect2i( math::Vector2i( { 0, 0 } ), layout_size() ) );
+    const int  step    = m_cell_size.height() + m_spacing;
+    return static_cast<size_t>( std::max( ( content.height() + step - 1 ) / step, 1 ) );
+}
+
+/****************************************/
+/*          Get the Full Rows           */
+/****************************************/
+size_t LayoutGrid::full_rows() const
+{
+    const auto content = get_bbox_with_padding( math::Rect2i( math::Vector2i( { 0, 0 } ), layout_size() ) );
+    const int  step    = m_cell_size.height() + m_spacing;
+    return static_cast<size_t>( std::max( ( content.height() + m_spacing ) / step, 1 ) );
+}
+
+/****************************************/
+/*          Get the Focus               */
+/****************************************/
+std::optional<size_t> LayoutGrid::focus() const {
+    return m_focus;
+}
+
+/****************************************/
+/*          Set the Focus               */
+/****************************************/
+void LayoutGrid::set_focus( size_t index )
+{
+    if( index >= item_count() ){
+        std::stringstream sout;
+        sout << "Focus index " << index << " is out of range.  Grid has " << item_count() << " items.";
+        throw std::runtime_error( sout.str() );
+    }
+    m_focus = index;
+    update_view();
+    invalidate_render();
+}
+
+/****************************************/
+/*          Handle Key Input            */
+/****************************************/
+bool LayoutGrid::handle_input( const drv::Input_Event& event )
+{
+    const auto count = item_count();
+    if( event.action == drv::Input_Action::RELEASE || count == 0 ){
+        return false;
+    }
+
+    // Activate the focused item
+    if( event.key == drv::Key::ENTER || event.key == drv::Key::SPACE ){
+        if( m_focus && m_activate ){
+            m_activate( m_focus.value() );
+        }
+        return m_focus.has_value();
+    }
+
+    const size_t cols    = columns();
+    const size_t page    = cols * full_rows();
+    const size_t current = m_focus.value_or( 0 );
+    size_t target        = current;
+    switch( event.key ){
+        case drv::Key::LEFT:
+            target = current > 0 ? current - 1 : current;
+            break;
+        case drv::Key::RIGHT:
+            target = std::min( current + 1, count - 1 );
+            break;
+        case drv::Key::UP:
+            target = current >= cols ? current - cols : current;
+            break;
+        case drv::Key::DOWN:
+            // Moving down into a short last row lands on its last item
+            if( current + cols < count ){
+                target = current + cols;
+            } else if( current / cols + 1 < rows() ){
+                target = count - 1;
+            }
+            break;
+        case drv::Key::HOME:
+            target = 0;
+            break;
+        case drv::Key::END:
+            target = count - 1;
+            break;
+        case drv::Key::PAGE_UP:
+            target = current >= page ? current - page : current % cols;
+            break;
+        case drv::Key::PAGE_DOWN:
+            target = std::min( current + page, count - 1 );
+            break;
+        default:
+            return false;
+    }
+
+    // The first key press only shows where the focus is
+    set_focus( m_focus ? target : 0 );
+    return true;
+}
+
+/********************************************/
+/*          Set the Activate Callback       */
+/********************************************/
+void LayoutGrid::set_activate_callback( Activate_Callback callback ){
+    m_activate = std::move( callback );
+}
+
+/****************************************/
+/*          Set the Focus Color         */
+/****************************************/
+void LayoutGrid::set_focus_color( math::Vector4u color ){
+    m_focus_color = color;
+    invalidate_render();
+}
+
+/****************************************/
+/*          Get the Bound Items         */
+/****************************************/
+const std::vector<size_t>& LayoutGrid::bound_items() const {
+    return m_bound;
+}
+
+/****************************************/
+/*          Get the Stats               */
+/****************************************/
+const LayoutGrid::Stats& LayoutGrid::stats() const {
+    return m_stats;
+}
+
+/****************************************/
+/*          Update the View             */
+/****************************************/
+void LayoutGrid::update_view()
+{
+    const size_t cols  = columns();
+    const size_t count = item_count();
+    const size_t full  = full_rows();
+
+    // Keep the focused row fully in view, without scrolling past the last row
+    if( m_focus ){
+        const size_t row = m_focus.value() / cols;
+        if( row < m_first_row ){
+            m_first_row = row;
+        } else if( row >= m_first_row + full ){
+            m_first_row = row + 1 - full;
+        }
+    }
+    m_first_row = std::min( m_first_row, rows() > full ? rows() - full : 0 );
+
+    const size_t begin = std::min( m_first_row * cols, count );
+    const size_t end   = std::min( ( m_first_row + visible_rows() ) * cols, count );
+
+    // Nothing to do if the same items are in view
+    const bool same_view = !m_bound.empty() &&
+                           m_bound.front() == begin &&
+                           m_bound.size()  == end - begin;
+    if( !m_view_dirty && cols == m_bound_columns && ( same_view || ( m_bound.empty() && begin == end ) ) ){
+        return;
+    }
+
+    // Cells scrolling out of view go back to the pool
+    const size_t old_begin = m_bound.empty() ? 0 : m_bound.front();
+    const size_t old_end   = m_bound.empty() ? 0 : m_bound.back() + 1;
+    if( m_factory ){
+        for( size_t k = 0; k < m_bound.size(); k++ ){
+            if( m_bound[k] < begin || m_bound[k] >= end || m_view_dirty ){
+                m_recycled.push_back( m_widgets[k].widget );
+            }
+        }
+    }
+
+    // Keep the cells still in view, and bind the rest
+    std::vector<WidgetLayoutItem> items;
+    std::vector<size_t>           bound;
+    for( size_t idx = begin; idx < end; idx++ ){
+        if( !m_view_dirty && idx >= old_begin && idx < old_end ){
+            items.push_back( m_widgets[idx - old_begin] );
+        } else if( m_factory ){
+            WidgetLayoutItem item;
+            item.widget = bind_item( idx );
+            items.push_back( item );
+        } else {
+            items.push_back( m_items[idx] );
+        }
+        bound.push_back( idx );
+    }
+
+    replace_items( std::move( items ) );
+    m_bound         = std::move( bound );
+    m_bound_columns = cols;
+    m_view_dirty    = false;
+
+    {
+        std::stringstream sout;
+        sout << "Grid view: items " << begin << " to " << end << " of " << count << ", " << m_recycled.size() << " cells pooled";
+        LOG_TRACE( sout.str() );
+    }
+}
+
+/****************************************/
+/*          Render the Grid             */
+/****************************************/
+bool LayoutGrid::render( Session&         session,
+                         img::Frame_View& image )
+{
+    // First render the padding
+    render_padding( session, image );
+
+    // Bind whatever scrolled into view, then draw it
+    update_view();
+    render_widgets( session, image );
+
+    // Outline the focused cell
+    if( m_focus && !m_bound.empty() && m_focus.value() >= m_bound.front() && m_focus.value() <= m_bound.back() ){
+        const auto& cell = arrangement()[m_focus.value() - m_bound.front()];
+        const int x0 = cell.min().x();
+        const int y0 = cell.min().y();
+        const int x1 = x0 + cell.width()  - 1;
+        const int y1 = y0 + cell.height() - 1;
+
+        img::Raster raster( image );
+        for( int t = 0; t < 2; t++ ){
+            raster.draw_hline( x0, x1, y0 + t, m_focus_color );
+            raster.draw_hline( x0, x1, y1 - t, m_focus_color );
+            raster.draw_vline( x0 + t, y0, y1, m_focus_color );
+            raster.draw_vline( x1 - t, y0, y1, m_focus_color );
+        }
+    }
+    return false;
+}
+
+/****************************************/
+/*      Get allocated bounding box      */
+/****************************************/
+std::vector<math::Rect2i> LayoutGrid::allocate_bboxes() const
+{
+    const auto content = get_bbox_with_padding( math::Rect2i( math::Vector2i( { 0, 0 } ), layout_size() ) );
+    const auto cols    = columns();
+
+    std::vector<math::Rect2i> bboxes;
+    for( const auto idx : m_bound ){
+        const int row = static_cast<int>( idx / cols ) - static_cast<int>( m_first_row );
+        const int col = static_cast<int>( idx % cols );
+        bboxes.push_back( math::Rect2i( math::ToPoint2<int>( content.min().x() + col * ( m_cell_size.width()  + m_spacing ),
+                                                             content.min().y() + row * ( m_cell_size.height() + m_spacing ) ),
+                                        m_cell_size ) );
+    }
+    return bboxes;
+}
+
+/************************************************/
+/*          Create Log-Friendly String          */
+/************************************************/
+std::string LayoutGrid::to_log_string( size_t offset ) const
+{
+    std::stringstream sout;
+
+    std::string gap( offset, ' ' );
+
+    sout << gap << " - LayoutGrid:" << std::endl;
+    sout << gap << "    - Size: " << layout_size().to_string() << std::endl;
+    sout << gap << "    - Padding: " << padding().to_log_string() << std::endl;
+    sout << gap << "    - Cell Size: " << m_cell_size.to_string() << ", Spacing: " << m_spacing << std::endl;
+    sout << gap << "    - Items: " << item_count() << ( m_factory ? " (factory)" : "" ) << std::endl;
+    sout << gap << "    - Bound Cells: " << m_bound.size() << ", Pooled: " << m_recycled.size() << std::endl;
+    sout << gap << "    - Cells Created: " << m_stats.cells_created << ", Recycled: " << m_stats.cells_recycled << std::endl;
+    sout << gap << "    - Focus: " << ( m_focus ? std::to_string( m_focus.value() ) : std::string( "none" ) ) << std::endl;
+    return sout.str();
+}
+
+/****************************************/
+/*          Measure the Widgets         */
+/****************************************/
+SizeHint LayoutGrid::measure_content() const
+{
+    // A roughly square grid shows every item
+    const auto count = item_count();
+    const int  cols  = std::max( static_cast<int>( std::ceil( std::sqrt( static_cast<double>( count ) ) ) ), 1 );
+    const int  rows  = std::max( static_cast<int>( ( count + static_cast<size_t>( cols ) - 1 ) / static_cast<size_t>( cols ) ), 1 );
+
+    SizeHint hint;
+    hint.minimum   = m_cell_size;
+    hint.preferred = math::Size2i( { cols * m_cell_size.width()  + ( cols - 1 ) * m_spacing,
+                                     rows * m_cell_size.height() + ( rows - 1 ) * m_spacing } );
+    return hint;
+}
+
+/****************************************/
+/*          Bind a Factory Item         */
+/****************************************/
+WidgetBase::ptr_t LayoutGrid::bind_item( size_t index )
+{
+    WidgetBase::ptr_t recycled;
+    if( !m_recycled.empty() ){
+        recycled = m_recycled.back();
+        m_recycled.pop_back();
+    }
+
+    auto widget = m_factory( index, recycled );
+    if( !widget ){
+        std::stringstream sout;
+        sout << "LayoutGrid cell factory returned no widget for item " << index;
+        throw std::runtime_error( sout.str() );
+    }
+
+    if( recycled && widget == recycled ){
+        m_stats.cells_recycled++;
+    } else {
+        m_stats.cells_created++;
+        if( recycled ){
+            m_recycled.push_back( recycled );
+        }
+    }
+    return widget;
+}
+
+} // End of tmns::gui namespace
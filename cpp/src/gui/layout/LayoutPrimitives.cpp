@@ -16,8 +16,135 @@
  */
 #include <terminus/gui/layout/LayoutPrimitives.hpp>
 
+// C++ Standard Libraries
+#include <algorithm>
+#include <sstream>
+
 namespace tmns::gui {
 
+/****************************************/
+/*          Print Size Hint             */
+/****************************************/
+std::string SizeHint::to_string() const
+{
+    std::stringstream sout;
+    sout << "SizeHint (Min: " << minimum.width() << " x " << minimum.height()
+         << ", Preferred: " << preferred.width() << " x " << preferred.height()
+         << ", Max: " << maximum.width() << " x " << maximum.height() << ")";
+    return sout.str();
+}
+
+/****************************************/
+/*          Create Fixed Hint           */
+/****************************************/
+SizeHint SizeHint::fixed( math::Size2i size )
+{
+    SizeHint hint;
+    hint.minimum   = size;
+    hint.preferred = size;
+    hint.maximum   = size;
+    return hint;
+}
+
+/************************************************/
+/*          Split a Linear Layout's Axis        */
+/************************************************/
+std::vector<int> flex_distribute( const std::vector<FlexItem>& items,
+                                  int                          available )
+{
+    std::vector<int> lengths( items.size(), 0 );
+    available = std::max( available, 0 );
+
+    // Ratio items take their fraction first
+    double ratio_sum = 0;
+    for( const auto& item : items ){
+        ratio_sum += item.ratio.value_or( 0 );
+    }
+    const double multiplier = ratio_sum > 1 ? 1 / ratio_sum : 1;
+
+    int ratio_total = 0;
+    std::vector<size_t> flex;
+    for( size_t idx = 0; idx < items.size(); idx++ ){
+        if( items[idx].ratio ){
+            lengths[idx] = static_cast<int>( available * items[idx].ratio.value() * multiplier );
+            ratio_total += lengths[idx];
+        } else {
+            flex.push_back( idx );
+        }
+    }
+
+    // Ratios which cover the axis leave nothing, even if rounding left a pixel over
+    int remaining = ratio_sum >= 1 ? 0 : std::max( available - ratio_total, 0 );
+    if( flex.empty() ){
+        return lengths;
+    }
+
+    int min_total  = 0;
+    int pref_total = 0;
+    for( auto idx : flex ){
+        min_total  += items[idx].minimum;
+        pref_total += std::max( items[idx].preferred, items[idx].minimum );
+    }
+
+    // Everything fits, so share out the spare room
+    if( pref_total <= remaining ){
+        std::vector<size_t> growers;
+        for( auto idx : flex ){
+            lengths[idx] = std::max( items[idx].preferred, items[idx].minimum );
+            if( items[idx].stretch == StretchPolicy::GROW && lengths[idx] < items[idx].maximum ){
+                growers.push_back( idx );
+            }
+        }
+
+        // Each round either hands out all of the room or caps at least one item, whose
+        // unused share goes round again to the rest
+        int spare = remaining - pref_total;
+        while( spare > 0 && !growers.empty() ){
+            const int share = spare / static_cast<int>( growers.size() );
+            const int extra = spare % static_cast<int>( growers.size() );
+
+            std::vector<size_t> still_growing;
+            for( size_t i = 0; i < growers.size(); i++ ){
+                const auto idx   = growers[i];
+                const int  grant = std::min( share + ( static_cast<int>( i ) < extra ? 1 : 0 ),
+                                             items[idx].maximum - lengths[idx] );
+                lengths[idx] += grant;
+                spare        -= grant;
+                if( lengths[idx] < items[idx].maximum ){
+                    still_growing.push_back( idx );
+                }
+            }
+            growers = std::move( still_growing );
+        }
+        return lengths;
+    }
+
+    // Shrink towards the minimums
+    if( min_total < remaining ){
+        const double scale = static_cast<double>( remaining - min_total ) / ( pref_total - min_total );
+        int used = 0;
+        for( auto idx : flex ){
+            const int slack = std::max( items[idx].preferred - items[idx].minimum, 0 );
+            lengths[idx] = items[idx].minimum + static_cast<int>( slack * scale );
+            used += lengths[idx];
+        }
+
+        // Hand the rounding remainder out a pixel at a time
+        for( size_t i = 0; used < remaining && i < flex.size(); i++ ){
+            if( lengths[flex[i]] < items[flex[i]].preferred ){
+                lengths[flex[i]]++;
+                used++;
+            }
+        }
+        return lengths;
+    }
 
+    // Not even the minimums fit.  Fill in order and clip the rest.
+    for( auto idx : flex ){
+        lengths[idx] = std::min( items[idx].minimum, remaining );
+        remaining   -= lengths[idx];
+    }
+    return lengths;
+}
 
 } // End of tmns::gui namespace
@@ -19,8 +19,118 @@
 // Terminus Libraries
 #include <terminus/log/Logger.hpp>
 
+// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 
 namespace tmns::gui {
+namespace {
+
+/**
+ * Copy the pixels under a view into a frame, reusing its buffer when the size matches
+ */
+void copy_view( const img::Frame_View& image,
+                img::Frame&            output )
+{
+    const auto cols = static_cast<size_t>( image.cols() );
+    const auto rows = static_cast<size_t>( image.rows() );
+    if( output.cols() != cols || output.rows() != rows || output.channels() != 4 ){
+        output = img::Frame( img::Dimensions( cols, rows, 4 ) );
+    }
+    img::Frame_View view( output );
+    view.copy( image, img::CopyPolicy::FLEXIBILE );
+    output.set_premultiplied( image.frame().is_premultiplied() );
+}
+
+/**
+ * Check if a page image fits the view
+ */
+bool fits_view( const img::Frame&      frame,
+                const img::Frame_View& image )
+{
+    return frame.size().width()  == image.cols() &&
+           frame.size().height() == image.rows();
+}
+
+} // End of anonymous namespace
+
+/****************************************/
+/*          Convert to String           */
+/****************************************/
+std::string to_string( PageTransition transition )
+{
+    switch( transition ){
+        case PageTransition::NONE:
+            return "NONE";
+        case PageTransition::SLIDE:
+            return "SLIDE";
+        case PageTransition::CROSSFADE:
+            return "CROSSFADE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/****************************************/
+/*        Parse a transition name       */
+/****************************************/
+PageTransition page_transition_from_string( const std::string& name )
+{
+    if( name == "none" || name == "NONE" ){
+        return PageTransition::NONE;
+    }
+    if( name == "slide" || name == "SLIDE" ){
+        return PageTransition::SLIDE;
+    }
+    if( name == "crossfade" || name == "CROSSFADE" ){
+        return PageTransition::CROSSFADE;
+    }
+    std::stringstream sout;
+    sout << "Unknown page transition: " << name << ". Expected none, slide or crossfade.";
+    throw std::runtime_error( sout.str() );
+}
+
+/****************************************/
+/*      Draw a Page Transition Step     */
+/****************************************/
+void render_page_transition( PageTransition    transition,
+                             double            progress,
+                             bool              forward,
+                             const img::Frame& from,
+                             const img::Frame& to,
+                             img::Frame_View&  image )
+{
+    progress = std::clamp( progress, 0.0, 1.0 );
+    switch( transition ){
+
+        // Both pages move together, the new one entering where the old one leaves
+        case PageTransition::SLIDE: {
+            const int width     = image.cols();
+            const int direction = forward ? -1 : 1;
+            const int shift     = direction * static_cast<int>( std::lround( progress * width ) );
+
+            auto old_page = image.subview( math::Rect2i( shift, 0, width, image.rows() ) );
+            old_page.copy( from, img::CopyPolicy::FLEXIBILE );
+            auto new_page = image.subview( math::Rect2i( shift - direction * width, 0, width, image.rows() ) );
+            new_page.copy( to, img::CopyPolicy::FLEXIBILE );
+            break;
+        }
+
+        // The new page is blended over the old one with a rising opacity
+        case PageTransition::CROSSFADE: {
+            image.copy( from, img::CopyPolicy::FLEXIBILE );
+            auto new_page = image.subview( math::Rect2i( 0, 0, image.cols(), image.rows() ) );
+            new_page.set_opacity( static_cast<uint8_t>( std::lround( progress * 255.0 ) ) );
+            new_page.copy( to, img::CopyPolicy::BLEND );
+            break;
+        }
+
+        default:
+            image.copy( to, img::CopyPolicy::FLEXIBILE );
+            break;
+    }
+}
 
 /*****************************************/
 /*         Add Layout to Widget List     */
@@ -32,7 +142,7 @@ int LayoutStack::append( WidgetBase::ptr_t new_widget ){
     new_layout_item.widget = new_widget;
 
     // Add to layout
-    m_widgets.push_back( new_layout_item );
+    auto index = add_item( new_layout_item );
 
     // If the first item, initialize the current-frame index
     if( !m_current_frame.has_value() ){
@@ -41,7 +151,7 @@ int LayoutStack::append( WidgetBase::ptr_t new_widget ){
         m_current_frame.value()++;
     }
 
-    return static_cast<int>(m_widgets.size() - 1);
+    return index;
 }
 
 /*****************************************/
@@ -58,7 +168,7 @@ int LayoutStack::append( WidgetBase::ptr_t         new_widget,
     new_layout_item.widget = new_widget;
 
     // Add to layout
-    m_widgets.push_back( new_layout_item );
+    auto index = add_item( new_layout_item );
 
     // If the first item, initialize the current-frame index
     if( !m_current_frame.has_value() ){
@@ -67,7 +177,7 @@ int LayoutStack::append( WidgetBase::ptr_t         new_widget,
         m_current_frame.value()++;
     }
 
-    return static_cast<int>(m_widgets.size() - 1);
+    return index;
 }
 
 /****************************************/
@@ -79,9 +189,6 @@ bool LayoutStack::render( Session&         session,
     // First render the padding
     render_padding( session, image );
 
-    // Create subview
-    auto sub_view = image.subview( get_bbox_with_padding( image.bbox() ) );
-
     if( m_widgets.size() <= 0 ){
         throw std::runtime_error( "LayoutStack instance has no widgets added." );
     }
@@ -100,9 +207,175 @@ bool LayoutStack::render( Session&         session,
         sout << "Widget Info: " << m_widgets[m_current_frame.value()].widget->to_log_string();
         LOG_DEBUG(sout.str() );
     }
-    return m_widgets[m_current_frame.value()].widget->render( session, sub_view );
-    
-    return true;
+
+    // Every page fills the area inside the padding
+    const auto page = m_current_frame.value();
+    auto sub_view = image.subview( arrangement()[page] );
+
+    // Animate from the image of the last page to the image of this one
+    if( m_transition_from.has_value() ){
+        if( !m_transition_to.has_value() ){
+            if( auto cached = find_page( page ); cached && fits_view( *cached, sub_view ) ){
+                m_transition_to = *cached;
+                m_stats.cache_hits++;
+            } else {
+                // Draw the page once to get its image.  The first step covers it.
+                m_widgets[page].widget->render( session, sub_view, 255 );
+                m_stats.renders++;
+                m_stats.cache_misses++;
+                m_transition_to.emplace();
+                copy_view( sub_view, m_transition_to.value() );
+                if( m_page_cache_capacity > 0 ){
+                    store_page( page, sub_view );
+                }
+            }
+        }
+
+        // Step by the session's frame clock, so replays animate on the same frames as recordings
+        const auto now = session.frame_clock();
+        if( !m_transition_start.has_value() ){
+            m_transition_start = now;
+        }
+        const double progress = ( now - m_transition_start.value() ) /
+                                std::chrono::duration<double>( m_transition_duration );
+
+        if( progress < 1 && fits_view( m_transition_from.value(), sub_view ) ){
+            render_page_transition( m_transition,
+                                    progress,
+                                    m_transition_forward,
+                                    m_transition_from.value(),
+                                    m_transition_to.value(),
+                                    sub_view );
+            m_stats.transition_frames++;
+            session.request_animation();
+            return true;
+        }
+
+        // Done, so the page takes over
+        m_transition_from.reset();
+        m_transition_to.reset();
+        m_transition_start.reset();
+    }
+
+    // Show the last image of the page straight away, and the live page on the next frame
+    else if( m_show_cached ){
+        m_show_cached = false;
+        if( auto cached = find_page( page ); cached && fits_view( *cached, sub_view ) ){
+            sub_view.copy( *cached, img::CopyPolicy::FLEXIBILE );
+            m_stats.cache_hits++;
+            session.request_animation();
+            return true;
+        }
+        m_stats.cache_misses++;
+    }
+
+    const auto result = m_widgets[page].widget->render( session, sub_view, 255 );
+    m_stats.renders++;
+    if( m_page_cache_capacity > 0 ){
+        store_page( page, sub_view );
+    }
+    return result;
+}
+
+/****************************************/
+/*          Get the Current Page        */
+/****************************************/
+std::optional<size_t> LayoutStack::current() const
+{
+    return m_current_frame;
+}
+
+/****************************************/
+/*          Switch to a Page            */
+/****************************************/
+void LayoutStack::set_current( size_t index )
+{
+    if( index >= m_widgets.size() ){
+        std::stringstream sout;
+        sout << "Page " << index << " is out of range.  LayoutStack has " << m_widgets.size() << " pages.";
+        throw std::runtime_error( sout.str() );
+    }
+    if( m_current_frame == index ){
+        return;
+    }
+
+    const auto previous = m_current_frame;
+    m_current_frame = index;
+
+    // Drop any animation still running
+    m_transition_from.reset();
+    m_transition_to.reset();
+    m_transition_start.reset();
+    m_show_cached = false;
+
+    if( m_transition != PageTransition::NONE && m_transition_duration.count() > 0 && previous.has_value() ){
+        if( auto cached = find_page( previous.value() ) ){
+            m_transition_from    = *cached;
+            m_transition_forward = index > previous.value();
+        }
+    }
+    if( !m_transition_from.has_value() ){
+        m_show_cached = m_page_cache_capacity > 0;
+    }
+    invalidate_render();
+}
+
+/****************************************/
+/*          Set the Page Cache          */
+/****************************************/
+void LayoutStack::set_page_cache( size_t capacity )
+{
+    m_page_cache_capacity = capacity;
+    while( m_page_cache.size() > capacity ){
+        m_page_cache.pop_back();
+    }
+    if( capacity == 0 ){
+        m_show_cached = false;
+    }
+}
+
+/****************************************/
+/*        Get the Page Cache Size       */
+/****************************************/
+size_t LayoutStack::page_cache_capacity() const
+{
+    return m_page_cache_capacity;
+}
+
+/****************************************/
+/*       Check for a Cached Page        */
+/****************************************/
+bool LayoutStack::is_page_cached( size_t index ) const
+{
+    return std::any_of( m_page_cache.begin(),
+                        m_page_cache.end(),
+                        [index]( const Cached_Page& entry ){ return entry.index == index; } );
+}
+
+/****************************************/
+/*          Set the Transition          */
+/****************************************/
+void LayoutStack::set_transition( PageTransition            transition,
+                                  std::chrono::milliseconds duration )
+{
+    m_transition          = transition;
+    m_transition_duration = duration;
+}
+
+/****************************************/
+/*      Check for a Running Transition  */
+/****************************************/
+bool LayoutStack::in_transition() const
+{
+    return m_transition_from.has_value();
+}
+
+/****************************************/
+/*          Get the Statistics          */
+/****************************************/
+const LayoutStack::Stats& LayoutStack::stats() const
+{
+    return m_stats;
 }
 
 /****************************************/
@@ -110,13 +383,28 @@ bool LayoutStack::render( Session&         session,
 /****************************************/
 std::vector<math::Rect2i> LayoutStack::allocate_bboxes() const
 {
-    std::vector<math::Rect2i> bboxes;
-    
-    for( const auto& widget : m_widgets ){
-        bboxes.push_back( math::Rect2i( math::Point2i( { 0, 0 } ),
-                                        widget.widget->size_pixels() ) );
+    auto content = get_bbox_with_padding( math::Rect2i( math::Vector2i( { 0, 0 } ),
+                                                        layout_size() ) );
+    return std::vector<math::Rect2i>( m_widgets.size(), content );
+}
+
+/****************************************/
+/*          Measure the Widgets         */
+/****************************************/
+SizeHint LayoutStack::measure_content() const
+{
+    // Room for the largest page
+    SizeHint hint;
+    hint.maximum = math::Size2i( { 0, 0 } );
+    for( const auto& item : m_widgets ){
+        const auto child = item.widget->size_hint();
+        for( size_t axis = 0; axis < 2; axis++ ){
+            hint.minimum[axis]   = std::max( hint.minimum[axis],   child.minimum[axis] );
+            hint.preferred[axis] = std::max( hint.preferred[axis], child.preferred[axis] );
+            hint.maximum[axis]   = std::max( hint.maximum[axis],   child.maximum[axis] );
+        }
     }
-    return bboxes;
+    return hint;
 }
 
 /************************************************/
@@ -132,7 +420,42 @@ std::string LayoutStack::to_log_string( size_t offset ) const
     sout << gap << "    - Size: " << layout_size().to_string() << std::endl;
     sout << gap << "    - Padding: " << padding().to_log_string() << std::endl;
     sout << gap << "    - Number Widgets: " << m_widgets.size() << std::endl;
+    sout << gap << "    - Page Cache: " << m_page_cache.size() << " of " << m_page_cache_capacity << std::endl;
+    sout << gap << "    - Transition: " << to_string( m_transition ) << ", " << m_transition_duration.count() << " ms" << std::endl;
     return sout.str();
 }
 
+/****************************************/
+/*          Find a Page Image           */
+/****************************************/
+img::Frame* LayoutStack::find_page( size_t index )
+{
+    auto entry = std::find_if( m_page_cache.begin(),
+                               m_page_cache.end(),
+                               [index]( const Cached_Page& page ){ return page.index == index; } );
+    if( entry == m_page_cache.end() ){
+        return nullptr;
+    }
+    m_page_cache.splice( m_page_cache.begin(), m_page_cache, entry );
+    return &m_page_cache.front().image;
+}
+
+/****************************************/
+/*          Keep a Page Image           */
+/****************************************/
+void LayoutStack::store_page( size_t                 index,
+                              const img::Frame_View& image )
+{
+    // Reuse the page's own entry, or the oldest one once full
+    if( !find_page( index ) ){
+        if( m_page_cache.size() < m_page_cache_capacity ){
+            m_page_cache.emplace_front();
+        } else {
+            m_page_cache.splice( m_page_cache.begin(), m_page_cache, std::prev( m_page_cache.end() ) );
+        }
+        m_page_cache.front().index = index;
+    }
+    copy_view( image, m_page_cache.front().image );
+}
+
 } // End of tmns::gui namespace
\ No newline at end of file
@@ -0,0 +1,184 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    CachedWidget.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Render-to-Texture Widget Cache
+ */
+#include <terminus/gui/widget/CachedWidget.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+
+// Project Libraries
+#include <terminus/log.hpp>
+
+namespace tmns::gui {
+
+/****************************/
+/*      Constructor         */
+/****************************/
+CachedWidget::CachedWidget( WidgetBase::ptr_t child )
+    : m_child { std::move( child ) }
+{
+    if( !m_child ){
+        throw std::runtime_error( "CachedWidget requires a widget to cache." );
+    }
+    m_child->m_parent_widget = this;
+}
+
+/****************************/
+/*      Destructor          */
+/****************************/
+CachedWidget::~CachedWidget()
+{
+    if( m_child->m_parent_widget == this ){
+        m_child->m_parent_widget = nullptr;
+    }
+}
+
+/****************************/
+/*      Get the size        */
+/****************************/
+math::Size2i CachedWidget::size_pixels() const {
+    return m_child->size_pixels();
+}
+
+/****************************/
+/*      Get the size hint   */
+/****************************/
+SizeHint CachedWidget::size_hint() const {
+    return m_child->size_hint();
+}
+
+/********************************/
+/*      Take the Layout Size    */
+/********************************/
+void CachedWidget::arrange( math::Size2i size ) {
+    m_child->arrange( size );
+}
+
+/********************************/
+/*      Render the Widget       */
+/********************************/
+bool CachedWidget::render( Session&         session,
+                           img::Frame_View& image )
+{
+    if( image.cols() < 1 || image.rows() < 1 ){
+        return false;
+    }
+
+    // A new size always draws again
+    if( m_cache.cols() != static_cast<size_t>( image.cols() ) ||
+        m_cache.rows() != static_cast<size_t>( image.rows() ) )
+    {
+        m_cache = img::Frame( img::Dimensions( static_cast<size_t>( image.cols() ),
+                                               static_cast<size_t>( image.rows() ),
+                                               4 ) );
+        m_dirty = true;
+    }
+
+    if( m_dirty ){
+        m_dirty = false;
+
+        // Start from transparent, so the cache holds exactly what the child draws
+        auto pixels = m_cache.data();
+        std::fill( pixels, pixels + m_cache.dims().size_bytes(), 0 );
+
+        // Keep any earlier animation request, and see if the child makes its own
+        const bool requested = session.take_animation_request();
+        img::Frame_View view( m_cache );
+        m_child->render( session, view, 255 );
+        if( session.take_animation_request() ){
+            m_dirty = true;
+            session.request_animation();
+        }
+        else if( requested ){
+            session.request_animation();
+        }
+
+        // Blending draws premultiplied pixels onto the transparent start
+        m_cache.set_premultiplied( true );
+        m_opaque = true;
+        for( size_t idx = 3; idx < m_cache.dims().size_bytes(); idx += 4 ){
+            if( pixels[idx] != 255 ){
+                m_opaque = false;
+                break;
+            }
+        }
+        m_stats.renders++;
+    }
+    else {
+        m_stats.hits++;
+    }
+
+    // Opaque caches are copied a row at a time
+    image.copy( m_cache, m_opaque && image.opacity() == 255 ? img::CopyPolicy::FLEXIBILE
+                                                            : img::CopyPolicy::BLEND );
+    render_border( session, image );
+    return true;
+}
+
+/****************************/
+/*      Get the child       */
+/****************************/
+WidgetBase::ptr_t CachedWidget::child() const {
+    return m_child;
+}
+
+/********************************/
+/*      Check for a Cache       */
+/********************************/
+bool CachedWidget::is_cached() const {
+    return !m_dirty;
+}
+
+/****************************/
+/*      Get the Stats       */
+/****************************/
+const CachedWidget::Stats& CachedWidget::stats() const {
+    return m_stats;
+}
+
+/************************************************/
+/*          Create Log-Friendly String          */
+/************************************************/
+std::string CachedWidget::to_log_string( size_t offset ) const
+{
+    std::stringstream sout;
+
+    std::string gap( offset, ' ' );
+
+    sout << gap << " - CachedWidget:" << std::endl;
+    sout << gap << "     - Tag: [" << log_tag() << "]" << std::endl;
+    sout << gap << "     - Cached: " << std::boolalpha << !m_dirty << ", Opaque: " << m_opaque << std::endl;
+    sout << gap << "     - Renders: " << m_stats.renders << ", Hits: " << m_stats.hits << std::endl;
+    sout << gap << "     - Child:" << std::endl;
+    sout << m_child->to_log_string( offset + 6 );
+    return sout.str();
+}
+
+/****************************************/
+/*      Wrap a Widget in a Cache        */
+/****************************************/
+CachedWidget::ptr_t CachedWidget::create( WidgetBase::ptr_t child ) {
+    return std::make_shared<CachedWidget>( std::move( child ) );
+}
+
+/****************************/
+/*      Drop the Cache      */
+/****************************/
+void CachedWidget::render_invalidated() const {
+    m_dirty = true;
+}
+
+} // End of tmns::gui namespace
@@ -14,7 +14,13 @@
  */
 #include <terminus/gui/widget/Label.hpp>
 
+// C++ Standard Libraries
+#include <chrono>
+
 // Project Libraries
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Pixels.hpp>
+#include <terminus/image/Raster.hpp>
 #include <terminus/log.hpp>
 
 namespace tmns::gui {
@@ -23,7 +29,15 @@ namespace tmns::gui {
 /*      Get label size      */
 /****************************/
 math::Size2i Label::size_pixels() const {
-    return m_image->size();
+    return m_image ? m_image->size() : m_placeholder_size;
+}
+
+/****************************************/
+/*      Check if still loading          */
+/****************************************/
+bool Label::is_loading() const
+{
+    return m_pending.has_value();
 }
 
 /********************************/
@@ -32,6 +46,23 @@ math::Size2i Label::size_pixels() const {
 bool Label::render( gui::Session&     session,
                     img::Frame_View&  image )
 {
+    // Once the image arrives the label takes its size, so the layout has to be redone and
+    // this frame, drawn at the placeholder size, replaced.
+    if( resolve_pending() ){
+        invalidate_layout();
+        session.request_animation();
+    }
+
+    // Draw the placeholder, and keep frames coming so the image shows up promptly
+    if( !m_image ){
+        img::Raster( image ).fill( img::PIXEL_GREY( 64 ) );
+        render_border( session, image );
+        if( m_pending ){
+            session.request_animation();
+        }
+        return true;
+    }
+
     std::stringstream sout;
     sout << "Label Info: " << m_image->to_log_string() << ", View Size: " << image.to_log_string();
     LOG_DEBUG( sout.str() );
@@ -39,8 +70,8 @@ bool Label::render( gui::Session&     session,
     // Render the border
     render_border( session, image );
     
-    // Copy our label onto the frame image
-    image.copy( *m_image, img::CopyPolicy::FLEXIBILE );
+    // Composite our label onto the frame image
+    image.copy( *m_image, img::CopyPolicy::BLEND );
 
     return true;
 }
@@ -56,8 +87,14 @@ std::string Label::to_log_string( size_t offset ) const
 
     sout << gap << " - Label:" << std::endl;
     sout << gap << "     - Tag: [" << log_tag() << "]" << std::endl;
-    sout << gap << "     - Frame Information:" << std::endl;
-    sout << m_image->to_log_string( offset + 6 );
+    if( m_image ){
+        sout << gap << "     - Frame Information:" << std::endl;
+        sout << m_image->to_log_string( offset + 6 );
+    }
+    else {
+        sout << gap << "     - Placeholder: " << m_placeholder_size.width() << " x " << m_placeholder_size.height()
+             << ( m_pending ? " (loading)" : "" ) << std::endl;
+    }
     return sout.str();
 }
 
@@ -78,6 +115,60 @@ Label::ptr_t Label::from_image( const std::filesystem::path& image_path,
     return new_lbl;
 }
 
+/****************************************************/
+/*      Construct from an image loaded later        */
+/****************************************************/
+Label::ptr_t Label::from_image_async( const std::filesystem::path& image_path,
+                                      drv::Driver_Base&            driver,
+                                      math::Size2i                 placeholder_size )
+{
+    LOG_DEBUG( "Queueing Image: " + image_path.native() );
+
+    auto new_lbl = std::make_shared<Label>();
+
+    new_lbl->m_pending          = driver.load_image_async( image_path );
+    new_lbl->m_placeholder_size = placeholder_size;
+
+    return new_lbl;
+}
+
+/****************************************************/
+/*      Construct from a resource loaded later      */
+/****************************************************/
+Label::ptr_t Label::from_resource_async( const std::string& name,
+                                         Resource_Manager&  resources,
+                                         math::Size2i       placeholder_size )
+{
+    LOG_DEBUG( "Queueing Resource: " + name );
+
+    auto new_lbl = std::make_shared<Label>();
+
+    new_lbl->m_pending             = resources.load_image_async( name );
+    new_lbl->m_placeholder_size    = placeholder_size;
+    new_lbl->m_premultiply_on_load = true;
+
+    return new_lbl;
+}
+
+/****************************************/
+/*      Construct from a resource       */
+/****************************************/
+Label::ptr_t Label::from_resource( const std::string& name,
+                                   Resource_Manager&  resources )
+{
+    LOG_DEBUG( "Loading Resource: " + name );
+    auto frame = resources.load_image( name );
+    if( !frame ){
+        throw std::runtime_error( "Unable to find resource: " + name );
+    }
+
+    auto new_lbl = std::make_shared<Label>();
+
+    new_lbl->m_image = frame.value();
+
+    return new_lbl;
+}
+
 /************************************/
 /*      Construct from text         */
 /************************************/
@@ -105,4 +196,34 @@ Label::ptr_t Label::from_frame( img::Frame::ptr_t frame )
     return new_lbl;
 }
 
+/************************************************/
+/*      Take the image once it has loaded       */
+/************************************************/
+bool Label::resolve_pending()
+{
+    if( !m_pending || m_pending->wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready ){
+        return false;
+    }
+
+    try {
+        m_image = m_pending->get();
+    }
+    catch( const std::exception& e ){
+        LOG_WARNING( std::string( "Unable to load label image: " ) + e.what() );
+    }
+    m_pending.reset();
+
+    if( !m_image ){
+        return false;
+    }
+
+    // The loader shares its result, so convert a copy rather than the pixels other callers see
+    if( m_premultiply_on_load && m_image->channels() == 4 && !m_image->is_premultiplied() ){
+        m_image = std::make_shared<img::Frame>( *m_image );
+        img::premultiply_alpha( m_image->data(), m_image->cols() * m_image->rows() );
+        m_image->set_premultiplied( true );
+    }
+    return true;
+}
+
 } // End of tmns::gui namespace
\ No newline at end of file
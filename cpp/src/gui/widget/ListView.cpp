@@ -0,0 +1,509 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    ListView.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Virtualized Scrolling List Widget
+ */
+#include <terminus/gui/widget/ListView.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstdlib>
+
+// Project Libraries
+#include <terminus/image/Raster.hpp>
+#include <terminus/log.hpp>
+
+namespace tmns::gui {
+
+/****************************/
+/*      Constructor         */
+/****************************/
+ListView::ListView( math::Size2i size,
+                    int          estimated_row_height )
+    : m_size { size },
+      m_estimated_row_height { std::max( estimated_row_height, 1 ) }
+{
+}
+
+/****************************/
+/*      Get list size       */
+/****************************/
+math::Size2i ListView::size_pixels() const {
+    return m_size;
+}
+
+/****************************/
+/*      Get size hint       */
+/****************************/
+SizeHint ListView::size_hint() const
+{
+    SizeHint hint;
+    hint.minimum   = math::Size2i( { 0, m_estimated_row_height } );
+    hint.preferred = m_size;
+    return hint;
+}
+
+/********************************/
+/*      Take the Layout Size    */
+/********************************/
+void ListView::arrange( math::Size2i size )
+{
+    if( size.width() == m_size.width() && size.height() == m_size.height() ){
+        return;
+    }
+    m_size = size;
+
+    // Rows keep their heights, and take the new width
+    for( const auto& [index, widget] : m_bound ){
+        widget->arrange( math::Size2i( { m_size.width(), row_height( index ) } ) );
+    }
+    m_redraw_all = true;
+    clamp_to_end();
+    update_window();
+}
+
+/********************************/
+/*      Render the List         */
+/********************************/
+bool ListView::render( Session&         session,
+                       img::Frame_View& image )
+{
+    // Follow the size we are drawn at
+    arrange( math::Size2i( { image.cols(), image.rows() } ) );
+    if( m_size.width() < 1 || m_size.height() < 1 ){
+        return false;
+    }
+
+    if( m_cache.cols() != static_cast<size_t>( m_size.width() ) || m_cache.rows() != static_cast<size_t>( m_size.height() ) ){
+        m_cache = img::Frame( img::Dimensions( static_cast<size_t>( m_size.width() ),
+                                               static_cast<size_t>( m_size.height() ),
+                                               4 ) );
+        m_cache.set_premultiplied( true );
+        m_redraw_all = true;
+    }
+
+    // Move what is already drawn, and only draw the rows scrolled into view
+    const int height = m_size.height();
+    const int scroll = m_pending_scroll;
+    m_pending_scroll = 0;
+    if( m_redraw_all || std::abs( scroll ) >= height ){
+        draw_band( session, 0, height );
+        m_stats.full_redraws++;
+        m_redraw_all = false;
+    }
+    else if( scroll != 0 ){
+        m_cache.scroll_rows( scroll );
+        if( scroll > 0 ){
+            draw_band( session, height - scroll, height );
+        } else {
+            draw_band( session, 0, -scroll );
+        }
+        m_stats.scroll_blits++;
+    }
+
+    image.copy( m_cache, img::CopyPolicy::BLEND );
+    render_border( session, image );
+    return true;
+}
+
+/********************************/
+/*      Set the Data Source     */
+/********************************/
+void ListView::set_data_source( size_t      row_count,
+                                Row_Builder builder )
+{
+    // Widgets from the old source are not offered to the new builder
+    m_bound.clear();
+    m_pool.clear();
+    m_heights.clear();
+    m_measured_total = 0;
+
+    m_count   = row_count;
+    m_builder = std::move( builder );
+    m_first   = 0;
+    m_offset  = 0;
+
+    m_pending_scroll = 0;
+    m_redraw_all     = true;
+    update_window();
+    invalidate_render();
+}
+
+/****************************/
+/*      Get Row Count       */
+/****************************/
+size_t ListView::item_count() const {
+    return m_count;
+}
+
+/****************************/
+/*      Refresh the Rows    */
+/****************************/
+void ListView::refresh()
+{
+    release_all();
+    m_heights.clear();
+    m_measured_total = 0;
+    m_redraw_all     = true;
+    clamp_to_end();
+    update_window();
+    invalidate_render();
+}
+
+/****************************/
+/*      Scroll by Pixels    */
+/****************************/
+bool ListView::scroll_by( int pixels )
+{
+    if( m_count == 0 || pixels == 0 ){
+        return false;
+    }
+    const auto old_first  = m_first;
+    const auto old_offset = m_offset;
+
+    // Walk up through the rows coming into view
+    m_offset += pixels;
+    while( m_offset < 0 && m_first > 0 ){
+        m_first--;
+        m_offset += row_height( m_first );
+    }
+    m_offset = std::max( m_offset, 0 );
+
+    // Walk down, pooling the rows which leave the top
+    while( m_first + 1 < m_count && m_offset >= row_height( m_first ) ){
+        m_offset -= row_height( m_first );
+        release_row( m_first );
+        m_first++;
+    }
+    clamp_to_end();
+
+    const int moved = distance_from( old_first, old_offset );
+    m_pending_scroll += moved;
+    update_window();
+    if( moved != 0 ){
+        invalidate_render();
+    }
+    return moved != 0;
+}
+
+/****************************/
+/*      Scroll to a Row     */
+/****************************/
+void ListView::scroll_to( size_t index )
+{
+    if( m_count == 0 ){
+        return;
+    }
+
+    // Everything in view changes, so every row is free to be rebound
+    release_all();
+    m_first  = std::min( index, m_count - 1 );
+    m_offset = 0;
+    clamp_to_end();
+
+    m_pending_scroll = 0;
+    m_redraw_all     = true;
+    update_window();
+    invalidate_render();
+}
+
+/****************************/
+/*      Get the Top Row     */
+/****************************/
+size_t ListView::first_visible_row() const {
+    return m_first;
+}
+
+/********************************/
+/*      Get the Top Offset      */
+/********************************/
+int ListView::first_row_offset() const {
+    return m_offset;
+}
+
+/********************************/
+/*      Get the Rows in View    */
+/********************************/
+const std::vector<size_t>& ListView::visible_rows() const {
+    return m_window;
+}
+
+/************************************/
+/*      Get the Content Height      */
+/************************************/
+size_t ListView::content_height() const {
+    return m_measured_total + ( m_count - m_heights.size() ) * static_cast<size_t>( m_estimated_row_height );
+}
+
+/****************************/
+/*      Handle Key Input    */
+/****************************/
+bool ListView::handle_input( const drv::Input_Event& event )
+{
+    if( event.action == drv::Input_Action::RELEASE || m_count == 0 ){
+        return false;
+    }
+
+    switch( event.key ){
+        case drv::Key::UP:
+            scroll_by( -m_estimated_row_height );
+            break;
+        case drv::Key::DOWN:
+            scroll_by( m_estimated_row_height );
+            break;
+        case drv::Key::PAGE_UP:
+            scroll_by( -m_size.height() );
+            break;
+        case drv::Key::PAGE_DOWN:
+            scroll_by( m_size.height() );
+            break;
+        case drv::Key::HOME:
+            scroll_to( 0 );
+            break;
+        case drv::Key::END:
+            scroll_to( m_count - 1 );
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/********************************/
+/*      Set the Background      */
+/********************************/
+void ListView::set_background( math::Vector4u color )
+{
+    m_background = color;
+    m_redraw_all = true;
+    invalidate_render();
+}
+
+/****************************/
+/*      Get the Stats       */
+/****************************/
+const ListView::Stats& ListView::stats() const {
+    return m_stats;
+}
+
+/************************************************/
+/*          Create Log-Friendly String          */
+/************************************************/
+std::string ListView::to_log_string( size_t offset ) const
+{
+    std::stringstream sout;
+
+    std::string gap( offset, ' ' );
+
+    sout << gap << " - ListView:" << std::endl;
+    sout << gap << "     - Tag: [" << log_tag() << "]" << std::endl;
+    sout << gap << "     - Size: " << m_size.to_string() << std::endl;
+    sout << gap << "     - Rows: " << m_count << ", Measured: " << m_heights.size() << std::endl;
+    sout << gap << "     - Top Row: " << m_first << ", Offset: " << m_offset << std::endl;
+    sout << gap << "     - Bound Rows: " << m_bound.size() << ", Pooled: " << m_pool.size() << std::endl;
+    sout << gap << "     - Rows Built: " << m_stats.rows_built << ", Recycled: " << m_stats.rows_recycled << std::endl;
+    return sout.str();
+}
+
+/****************************/
+/*      Create a List       */
+/****************************/
+ListView::ptr_t ListView::create( math::Size2i size,
+                                  int          estimated_row_height )
+{
+    return std::make_shared<ListView>( size, estimated_row_height );
+}
+
+/****************************************/
+/*      Get a Widget for the Row        */
+/****************************************/
+WidgetBase::ptr_t ListView::build_row( size_t index )
+{
+    WidgetBase::ptr_t recycled;
+    if( !m_pool.empty() ){
+        recycled = m_pool.back();
+        m_pool.pop_back();
+    }
+
+    auto widget = m_builder( index, recycled );
+    if( !widget ){
+        std::stringstream sout;
+        sout << "ListView row builder returned no widget for row " << index;
+        throw std::runtime_error( sout.str() );
+    }
+
+    if( recycled && widget == recycled ){
+        m_stats.rows_recycled++;
+    } else {
+        m_stats.rows_built++;
+        if( recycled ){
+            m_pool.push_back( recycled );
+        }
+    }
+    return widget;
+}
+
+/****************************/
+/*      Get a Row Height    */
+/****************************/
+int ListView::row_height( size_t index )
+{
+    auto height_iter = m_heights.find( index );
+    if( height_iter != m_heights.end() ){
+        return height_iter->second;
+    }
+
+    // Rows are measured once, when first bound
+    auto& widget = m_bound[index];
+    if( !widget ){
+        widget = build_row( index );
+    }
+    const int height = std::max( widget->size_hint().preferred.height(), 1 );
+    widget->arrange( math::Size2i( { m_size.width(), height } ) );
+
+    m_heights[index]  = height;
+    m_measured_total += static_cast<size_t>( height );
+    return height;
+}
+
+/****************************/
+/*      Release a Row       */
+/****************************/
+void ListView::release_row( size_t index )
+{
+    auto bound = m_bound.find( index );
+    if( bound != m_bound.end() ){
+        m_pool.push_back( bound->second );
+        m_bound.erase( bound );
+    }
+}
+
+/****************************/
+/*      Release all Rows    */
+/****************************/
+void ListView::release_all()
+{
+    for( auto& [index, widget] : m_bound ){
+        m_pool.push_back( widget );
+    }
+    m_bound.clear();
+}
+
+/************************************/
+/*      Stop at the End of List     */
+/************************************/
+void ListView::clamp_to_end()
+{
+    if( m_count == 0 ){
+        return;
+    }
+
+    // See if the rows from the top down fill the view
+    int filled = -m_offset;
+    for( size_t index = m_first; index < m_count && filled < m_size.height(); index++ ){
+        filled += row_height( index );
+    }
+    if( filled >= m_size.height() ){
+        return;
+    }
+
+    // Pull the rows above into view instead
+    m_offset -= m_size.height() - filled;
+    while( m_offset < 0 && m_first > 0 ){
+        m_first--;
+        m_offset += row_height( m_first );
+    }
+    m_offset = std::max( m_offset, 0 );
+}
+
+/********************************************/
+/*      Distance from a Scroll Position     */
+/********************************************/
+int ListView::distance_from( size_t first,
+                             int    offset )
+{
+    int distance = m_offset - offset;
+    for( size_t index = std::min( first, m_first ); index < std::max( first, m_first ); index++ ){
+        distance += ( m_first > first ? 1 : -1 ) * row_height( index );
+    }
+    return distance;
+}
+
+/****************************************/
+/*      Bind the Rows in View           */
+/****************************************/
+void ListView::update_window()
+{
+    // Rows above the view go back first, so the rows coming in can reuse them
+    while( !m_bound.empty() && m_bound.begin()->first < m_first ){
+        release_row( m_bound.begin()->first );
+    }
+
+    m_window.clear();
+    int y = -m_offset;
+    for( size_t index = m_first; index < m_count && y < m_size.height(); index++ ){
+        const int height = row_height( index );
+        auto& widget = m_bound[index];
+        if( !widget ){
+            widget = build_row( index );
+            widget->arrange( math::Size2i( { m_size.width(), height } ) );
+        }
+        m_window.push_back( index );
+        y += height;
+    }
+
+    // Then the rows below it
+    while( !m_bound.empty() && ( m_window.empty() || m_bound.rbegin()->first > m_window.back() ) ){
+        release_row( m_bound.rbegin()->first );
+    }
+
+    // Keep the pool no bigger than a screenful
+    if( m_pool.size() > m_window.size() ){
+        m_pool.resize( m_window.size() );
+    }
+}
+
+/****************************************/
+/*      Draw the Rows in a Band         */
+/****************************************/
+void ListView::draw_band( Session& session,
+                          int      y0,
+                          int      y1 )
+{
+    img::Frame_View view( m_cache );
+    view.push_clip( math::Rect2i( math::ToPoint2<int>( 0, y0 ),
+                                  math::Size2i( { m_size.width(), y1 - y0 } ) ) );
+    img::Raster( view ).fill( m_background );
+
+    int y = -m_offset;
+    for( const auto index : m_window ){
+        const int height = row_height( index );
+        if( y < y1 && y + height > y0 ){
+            auto row_view = view.subview( math::Rect2i( math::ToPoint2<int>( 0, y ),
+                                                        math::Size2i( { m_size.width(), height } ) ) );
+            m_bound[index]->render( session, row_view, 255 );
+            m_stats.rows_rendered++;
+        }
+        y += height;
+    }
+    view.pop_clip();
+
+    {
+        std::stringstream sout;
+        sout << "ListView drew rows " << y0 << " to " << y1 << " of " << m_size.height();
+        LOG_TRACE( sout.str() );
+    }
+}
+
+} // End of tmns::gui namespace
@@ -0,0 +1,135 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Tile.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Launcher Tile Widget
+ */
+#include <terminus/gui/widget/Tile.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+
+// Project Libraries
+#include <terminus/image/Pixels.hpp>
+#include <terminus/image/Raster.hpp>
+
+namespace tmns::gui {
+
+namespace {
+
+/// Gap between the icon and the caption
+constexpr int CAPTION_GAP { 4 };
+
+} // End of anonymous namespace
+
+/****************************/
+/*      Constructor         */
+/****************************/
+Tile::Tile( math::Size2i size )
+    : m_size { size }
+{
+}
+
+/****************************/
+/*      Get tile size       */
+/****************************/
+math::Size2i Tile::size_pixels() const {
+    return m_size;
+}
+
+/********************************/
+/*      Render the Tile         */
+/********************************/
+bool Tile::render( Session&         session,
+                   img::Frame_View& image )
+{
+    render_border( session, image );
+
+    // The caption sits along the bottom, and the icon is centered in what is left
+    const int width          = m_size.width();
+    const int caption_height = m_caption ? std::min( m_caption->size().height(), m_size.height() ) : 0;
+    const int icon_height    = std::max( m_size.height() - caption_height - ( m_caption ? CAPTION_GAP : 0 ), 0 );
+
+    if( m_icon ){
+        const auto icon_size = m_icon->size_pixels();
+        const int x = ( width - icon_size.width() ) / 2;
+        const int y = ( icon_height - icon_size.height() ) / 2;
+        auto view = image.subview( math::Rect2i( math::ToPoint2<int>( x, y ), icon_size ) );
+        m_icon->render( session, view );
+    }
+    else if( icon_height > 0 ){
+        const int side = std::min( width, icon_height );
+        auto view = image.subview( math::Rect2i( math::ToPoint2<int>( ( width - side ) / 2, ( icon_height - side ) / 2 ),
+                                                 math::Size2i( { side, side } ) ) );
+        img::Raster( view ).fill( img::PIXEL_GREY( 64 ) );
+    }
+
+    if( m_caption ){
+        const int x = ( width - m_caption->size().width() ) / 2;
+        auto view = image.subview( math::Rect2i( math::ToPoint2<int>( x, m_size.height() - caption_height ),
+                                                 m_caption->size() ) );
+        view.copy( *m_caption, img::CopyPolicy::BLEND );
+    }
+    return true;
+}
+
+/****************************************/
+/*      Bind a new icon and caption     */
+/****************************************/
+void Tile::bind( Label::ptr_t      icon,
+                 img::Frame::ptr_t caption )
+{
+    m_icon    = icon;
+    m_caption = caption;
+    invalidate_render();
+}
+
+/****************************/
+/*      Get the icon        */
+/****************************/
+Label::ptr_t Tile::icon() const {
+    return m_icon;
+}
+
+/****************************/
+/*      Get the caption     */
+/****************************/
+img::Frame::ptr_t Tile::caption() const {
+    return m_caption;
+}
+
+/************************************************/
+/*          Create Log-Friendly String          */
+/************************************************/
+std::string Tile::to_log_string( size_t offset ) const
+{
+    std::stringstream sout;
+
+    std::string gap( offset, ' ' );
+
+    sout << gap << " - Tile:" << std::endl;
+    sout << gap << "     - Tag: [" << log_tag() << "]" << std::endl;
+    sout << gap << "     - Size: " << m_size.to_string() << std::endl;
+    sout << gap << "     - Icon: " << ( m_icon ? m_icon->size_pixels().to_string() : std::string( "none" ) ) << std::endl;
+    sout << gap << "     - Caption: " << ( m_caption ? m_caption->size().to_string() : std::string( "none" ) ) << std::endl;
+    return sout.str();
+}
+
+/****************************/
+/*      Create a Tile       */
+/****************************/
+Tile::ptr_t Tile::create( math::Size2i size ) {
+    return std::make_shared<Tile>( size );
+}
+
+} // End of tmns::gui namespace
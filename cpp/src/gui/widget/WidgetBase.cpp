@@ -16,13 +16,90 @@
  */
 #include <terminus/gui/widget/WidgetBase.hpp>
 
+// Project Libraries
+#include <terminus/gui/layout/LayoutBase.hpp>
+#include <terminus/image/Composite.hpp>
+
 namespace tmns::gui {
 
+/****************************************/
+/*          Render with Opacity         */
+/****************************************/
+bool WidgetBase::render( Session&         session,
+                         img::Frame_View& image,
+                         uint8_t          opacity )
+{
+    const auto combined = img::multiply_255( img::multiply_255( image.opacity(), opacity ), m_opacity );
+    if( combined == 0 ){
+        return false;
+    }
+
+    auto view = image;
+    view.set_opacity( combined );
+    return render( session, view );
+}
+
+/****************************************/
+/*          Get the Size Hint           */
+/****************************************/
+SizeHint WidgetBase::size_hint() const {
+    return SizeHint::fixed( size_pixels() );
+}
+
+/****************************************/
+/*          Take the Arranged Size      */
+/****************************************/
+void WidgetBase::arrange( [[maybe_unused]] math::Size2i size ){}
+
+/****************************************/
+/*          Invalidate the Layout       */
+/****************************************/
+void WidgetBase::invalidate_layout() const
+{
+    render_invalidated();
+    if( m_parent_widget ){
+        m_parent_widget->invalidate_layout();
+    }
+    else if( m_parent_layout ){
+        m_parent_layout->invalidate();
+    }
+}
+
+/****************************************/
+/*          Invalidate the Render       */
+/****************************************/
+void WidgetBase::invalidate_render() const
+{
+    render_invalidated();
+    if( m_parent_widget ){
+        m_parent_widget->invalidate_render();
+    }
+    else if( m_parent_layout ){
+        m_parent_layout->invalidate_render();
+    }
+}
+
+/****************************************/
+/*          Get the Opacity             */
+/****************************************/
+uint8_t WidgetBase::opacity() const {
+    return m_opacity;
+}
+
+/****************************************/
+/*          Set the Opacity             */
+/****************************************/
+void WidgetBase::set_opacity( uint8_t opacity ){
+    m_opacity = opacity;
+    invalidate_render();
+}
+
 /****************************************/
 /*          Set a Border Color          */
 /****************************************/
 void WidgetBase::set_border( math::Vector4u color ){
     m_border = color;
+    invalidate_render();
 }
 
 /****************************************/
@@ -62,4 +139,9 @@ bool WidgetBase::render_border( [[maybe_unused]] Session&  session,
     return true;
 }
 
+/****************************************/
+/*          Drop Rendered Pixels        */
+/****************************************/
+void WidgetBase::render_invalidated() const {}
+
 } // End of tmns::gui namespace
\ No newline at end of file
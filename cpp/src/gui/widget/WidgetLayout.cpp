@@ -29,6 +29,22 @@ math::Size2i WidgetLayout::size_pixels() const
     return m_layout->layout_size();
 }
 
+/****************************************/
+/*          Get the size hint           */
+/****************************************/
+SizeHint WidgetLayout::size_hint() const
+{
+    return m_layout->measure();
+}
+
+/****************************************/
+/*          Arrange the layout          */
+/****************************************/
+void WidgetLayout::arrange( math::Size2i size )
+{
+    m_layout->arrange( size );
+}
+
 /****************************************/
 /*          Get the layout info         */
 /****************************************/
@@ -56,6 +72,9 @@ bool WidgetLayout::render( gui::Session&    session,
     }
     render_border( session, image );
 
+    // Fit the layout to the view.  Nothing is recomputed if the size is unchanged.
+    m_layout->arrange( math::Size2i( { image.cols(), image.rows() } ) );
+
     // Render the internal layout on top of the image
     m_layout->render( session, image );
     
@@ -90,6 +109,19 @@ WidgetLayout::ptr_t WidgetLayout::from_layout( LayoutBase::ptr_t layout )
 /*          Constructor         */
 /********************************/
 WidgetLayout::WidgetLayout( LayoutBase::ptr_t layout )
-    : m_layout { layout }{}
+    : m_layout { layout }
+{
+    m_layout->m_owner = this;
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+WidgetLayout::~WidgetLayout()
+{
+    if( m_layout->m_owner == this ){
+        m_layout->m_owner = nullptr;
+    }
+}
 
 } // End of tmns::gui namespace
\ No newline at end of file
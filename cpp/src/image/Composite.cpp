@@ -0,0 +1,143 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Composite.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Premultiplied-alpha compositing.
+ */
+#include <terminus/image/Composite.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+// SIMD Intrinsics
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace tmns::img {
+
+namespace {
+
+/// Pixels scaled per chunk when an opacity is applied
+constexpr size_t CHUNK_PIXELS { 64 };
+
+/************************************************/
+/*          Composite with SIMD kernels         */
+/************************************************/
+size_t simd_composite( [[maybe_unused]] uint8_t*       dst,
+                       [[maybe_unused]] const uint8_t* src,
+                       [[maybe_unused]] size_t         count )
+{
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for( ; i + 8 <= count; i += 8 ){
+        const uint8x8x4_t s = vld4_u8( src + 4 * i );
+        uint8x8x4_t       d = vld4_u8( dst + 4 * i );
+        const uint8x8_t inverse = vmvn_u8( s.val[3] );
+        for( int c = 0; c < 4; c++ ){
+            const uint16x8_t t = vmull_u8( d.val[c], inverse );
+            d.val[c] = vqadd_u8( s.val[c], vraddhn_u16( t, vrshrq_n_u16( t, 8 ) ) );
+        }
+        vst4_u8( dst + 4 * i, d );
+    }
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16( 128 );
+    const __m128i full = _mm_set1_epi16( 255 );
+
+    // dst * ( 255 - alpha ) / 255 for two pixels widened to 16 bits
+    auto attenuate = [&]( __m128i d, __m128i s ){
+        __m128i alpha = _mm_shufflehi_epi16( _mm_shufflelo_epi16( s, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+        __m128i t = _mm_add_epi16( _mm_mullo_epi16( d, _mm_sub_epi16( full, alpha ) ), bias );
+        return _mm_srli_epi16( _mm_add_epi16( t, _mm_srli_epi16( t, 8 ) ), 8 );
+    };
+
+    for( ; i + 4 <= count; i += 4 ){
+        const __m128i s = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 4 * i ) );
+        __m128i* ptr = reinterpret_cast<__m128i*>( dst + 4 * i );
+        const __m128i d = _mm_loadu_si128( ptr );
+        const __m128i lo = attenuate( _mm_unpacklo_epi8( d, zero ), _mm_unpacklo_epi8( s, zero ) );
+        const __m128i hi = attenuate( _mm_unpackhi_epi8( d, zero ), _mm_unpackhi_epi8( s, zero ) );
+        _mm_storeu_si128( ptr, _mm_adds_epu8( s, _mm_packus_epi16( lo, hi ) ) );
+    }
+#endif
+    return i;
+}
+
+/************************************************/
+/*          Composite one run at full opacity   */
+/************************************************/
+void composite_opaque( uint8_t*       dst,
+                       const uint8_t* src,
+                       size_t         count )
+{
+    for( size_t i = simd_composite( dst, src, count ); i < count; i++ ){
+        const uint8_t* s = src + 4 * i;
+        uint8_t*       d = dst + 4 * i;
+        const unsigned inverse = 255u - s[3];
+        if( inverse == 0 ){
+            std::memcpy( d, s, 4 );
+        }
+        else if( inverse < 255u ){
+            for( size_t c = 0; c < 4; c++ ){
+                d[c] = static_cast<uint8_t>( std::min( 255u, static_cast<unsigned>( s[c] ) + multiply_255( d[c], inverse ) ) );
+            }
+        }
+    }
+}
+
+} // End of anonymous namespace
+
+/********************************************/
+/*          Composite a run of pixels       */
+/********************************************/
+void composite_row( uint8_t*       dst,
+                    const uint8_t* src,
+                    size_t         count,
+                    uint8_t        opacity )
+{
+    if( opacity == 255 ){
+        composite_opaque( dst, src, count );
+        return;
+    }
+    if( opacity == 0 ){
+        return;
+    }
+
+    // Fade the source a chunk at a time, then composite as usual
+    std::array<uint8_t,CHUNK_PIXELS * 4> faded;
+    for( size_t start = 0; start < count; start += CHUNK_PIXELS ){
+        const size_t run = std::min( CHUNK_PIXELS, count - start );
+        scale_row( faded.data(), src + 4 * start, run, opacity );
+        composite_opaque( dst + 4 * start, faded.data(), run );
+    }
+}
+
+/************************************/
+/*          Scale a run of pixels   */
+/************************************/
+void scale_row( uint8_t*       dst,
+                const uint8_t* src,
+                size_t         count,
+                uint8_t        opacity )
+{
+    for( size_t i = 0; i < count * 4; i++ ){
+        dst[i] = multiply_255( src[i], opacity );
+    }
+}
+
+} // End of tmns::img namespace
@@ -0,0 +1,677 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Convert.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Pixel format conversion.
+ */
+#include <terminus/image/Convert.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+// Project Libraries
+#include <terminus/image/Frame_Pool.hpp>
+
+// SIMD Intrinsics
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#endif
+
+namespace tmns::img {
+
+namespace {
+
+/// Intermediate RGBA pixel
+using Pixel = std::array<uint8_t,4>;
+
+/// Pixels converted per chunk when going through RGBA
+constexpr size_t CHUNK_PIXELS { 64 };
+
+/********************************************/
+/*          Compile-time pixel size         */
+/********************************************/
+constexpr size_t format_bpp( PixelFormat format )
+{
+    switch( format ){
+        case PixelFormat::GRAY:       return 1;
+        case PixelFormat::GRAY_ALPHA: return 2;
+        case PixelFormat::RGB565:     return 2;
+        case PixelFormat::RGB:        return 3;
+        case PixelFormat::BGR:        return 3;
+        case PixelFormat::RGBA:       return 4;
+        case PixelFormat::BGRA:       return 4;
+        default:                      return 0;
+    }
+}
+
+/************************************************/
+/*          Integer Rec.601 luma estimate       */
+/************************************************/
+inline uint8_t luma( uint8_t r, uint8_t g, uint8_t b )
+{
+    return static_cast<uint8_t>( ( 77 * r + 150 * g + 29 * b ) >> 8 );
+}
+
+/****************************************************/
+/*          Expand 5 and 6 bit color channels       */
+/****************************************************/
+inline uint8_t expand5( unsigned value )
+{
+    return static_cast<uint8_t>( ( value << 3 ) | ( value >> 2 ) );
+}
+
+inline uint8_t expand6( unsigned value )
+{
+    return static_cast<uint8_t>( ( value << 2 ) | ( value >> 4 ) );
+}
+
+/****************************************/
+/*          Load a single pixel         */
+/****************************************/
+template <PixelFormat FormatT>
+inline Pixel load( const uint8_t* p )
+{
+    if constexpr( FormatT == PixelFormat::GRAY ){
+        return { p[0], p[0], p[0], 255 };
+    }
+    else if constexpr( FormatT == PixelFormat::GRAY_ALPHA ){
+        return { p[0], p[0], p[0], p[1] };
+    }
+    else if constexpr( FormatT == PixelFormat::RGB ){
+        return { p[0], p[1], p[2], 255 };
+    }
+    else if constexpr( FormatT == PixelFormat::BGR ){
+        return { p[2], p[1], p[0], 255 };
+    }
+    else if constexpr( FormatT == PixelFormat::RGBA ){
+        return { p[0], p[1], p[2], p[3] };
+    }
+    else if constexpr( FormatT == PixelFormat::BGRA ){
+        return { p[2], p[1], p[0], p[3] };
+    }
+    else {
+        const unsigned value = static_cast<unsigned>( p[0] ) | ( static_cast<unsigned>( p[1] ) << 8 );
+        return { expand5( ( value >> 11 ) & 0x1f ),
+                 expand6( ( value >> 5 ) & 0x3f ),
+                 expand5( value & 0x1f ),
+                 255 };
+    }
+}
+
+/****************************************/
+/*          Store a single pixel        */
+/****************************************/
+template <PixelFormat FormatT>
+inline void store( const Pixel& px, uint8_t* p )
+{
+    if constexpr( FormatT == PixelFormat::GRAY ){
+        p[0] = luma( px[0], px[1], px[2] );
+    }
+    else if constexpr( FormatT == PixelFormat::GRAY_ALPHA ){
+        p[0] = luma( px[0], px[1], px[2] );
+        p[1] = px[3];
+    }
+    else if constexpr( FormatT == PixelFormat::RGB ){
+        p[0] = px[0]; p[1] = px[1]; p[2] = px[2];
+    }
+    else if constexpr( FormatT == PixelFormat::BGR ){
+        p[0] = px[2]; p[1] = px[1]; p[2] = px[0];
+    }
+    else if constexpr( FormatT == PixelFormat::RGBA ){
+        p[0] = px[0]; p[1] = px[1]; p[2] = px[2]; p[3] = px[3];
+    }
+    else if constexpr( FormatT == PixelFormat::BGRA ){
+        p[0] = px[2]; p[1] = px[1]; p[2] = px[0]; p[3] = px[3];
+    }
+    else {
+        const unsigned value = ( ( px[0] & 0xf8u ) << 8 ) | ( ( px[1] & 0xfcu ) << 3 ) | ( px[2] >> 3 );
+        p[0] = static_cast<uint8_t>( value & 0xff );
+        p[1] = static_cast<uint8_t>( value >> 8 );
+    }
+}
+
+/********************************************************/
+/*          Call a functor with a constant format       */
+/********************************************************/
+template <typename FuncT>
+void dispatch( PixelFormat format, FuncT&& func )
+{
+    switch( format ){
+        case PixelFormat::GRAY:
+            func( std::integral_constant<PixelFormat,PixelFormat::GRAY>{} );
+            return;
+        case PixelFormat::GRAY_ALPHA:
+            func( std::integral_constant<PixelFormat,PixelFormat::GRAY_ALPHA>{} );
+            return;
+        case PixelFormat::RGB:
+            func( std::integral_constant<PixelFormat,PixelFormat::RGB>{} );
+            return;
+        case PixelFormat::RGBA:
+            func( std::integral_constant<PixelFormat,PixelFormat::RGBA>{} );
+            return;
+        case PixelFormat::BGR:
+            func( std::integral_constant<PixelFormat,PixelFormat::BGR>{} );
+            return;
+        case PixelFormat::BGRA:
+            func( std::integral_constant<PixelFormat,PixelFormat::BGRA>{} );
+            return;
+        case PixelFormat::RGB565:
+            func( std::integral_constant<PixelFormat,PixelFormat::RGB565>{} );
+            return;
+        default:
+        {
+            std::stringstream sout;
+            sout << "Unsupported pixel format: " << static_cast<int>( format );
+            throw std::runtime_error( sout.str() );
+        }
+    }
+}
+
+/************************************************************/
+/*          Scalar conversion between any two formats       */
+/*                                                          */
+/*  Runs back to front when expanding in place, so no       */
+/*  source pixel is overwritten before it has been read.    */
+/************************************************************/
+void convert_scalar( const uint8_t* src,
+                     PixelFormat    src_format,
+                     uint8_t*       dst,
+                     PixelFormat    dst_format,
+                     size_t         count,
+                     bool           backward )
+{
+    dispatch( src_format, [&]( auto src_tag ){
+        dispatch( dst_format, [&]( auto dst_tag ){
+            constexpr auto SRC = decltype( src_tag )::value;
+            constexpr auto DST = decltype( dst_tag )::value;
+            constexpr size_t SRC_BPP = format_bpp( SRC );
+            constexpr size_t DST_BPP = format_bpp( DST );
+
+            if( backward ){
+                for( size_t i = count; i-- > 0; ){
+                    store<DST>( load<SRC>( src + i * SRC_BPP ), dst + i * DST_BPP );
+                }
+            }
+            else {
+                for( size_t i = 0; i < count; i++ ){
+                    store<DST>( load<SRC>( src + i * SRC_BPP ), dst + i * DST_BPP );
+                }
+            }
+        });
+    });
+}
+
+#if defined(__SSE2__) && !defined(__ARM_NEON)
+
+/// Alpha channel mask for 4 RGBA pixels
+inline __m128i sse_alpha_mask()
+{
+    return _mm_set1_epi32( static_cast<int>( 0xff000000u ) );
+}
+
+/************************************************/
+/*          Swap red and blue in 4 pixels       */
+/************************************************/
+inline __m128i sse_swap_rb( __m128i px )
+{
+    const __m128i ag = _mm_and_si128( px, _mm_set1_epi32( static_cast<int>( 0xff00ff00u ) ) );
+    const __m128i rb = _mm_and_si128( px, _mm_set1_epi32( 0x00ff00ff ) );
+    const __m128i br = _mm_or_si128( _mm_slli_epi32( rb, 16 ), _mm_srli_epi32( rb, 16 ) );
+    return _mm_or_si128( ag, _mm_and_si128( br, _mm_set1_epi32( 0x00ff00ff ) ) );
+}
+
+/****************************************************/
+/*          Expand 4 RGB565 pixels to RGBA          */
+/****************************************************/
+inline __m128i sse_expand_565( __m128i value )
+{
+    const __m128i mask5 = _mm_set1_epi32( 0x1f );
+    const __m128i mask6 = _mm_set1_epi32( 0x3f );
+    const __m128i r5 = _mm_and_si128( _mm_srli_epi32( value, 11 ), mask5 );
+    const __m128i g6 = _mm_and_si128( _mm_srli_epi32( value, 5 ), mask6 );
+    const __m128i b5 = _mm_and_si128( value, mask5 );
+    const __m128i r  = _mm_or_si128( _mm_slli_epi32( r5, 3 ), _mm_srli_epi32( r5, 2 ) );
+    const __m128i g  = _mm_or_si128( _mm_slli_epi32( g6, 2 ), _mm_srli_epi32( g6, 4 ) );
+    const __m128i b  = _mm_or_si128( _mm_slli_epi32( b5, 3 ), _mm_srli_epi32( b5, 2 ) );
+    return _mm_or_si128( _mm_or_si128( r, _mm_slli_epi32( g, 8 ) ),
+                         _mm_or_si128( _mm_slli_epi32( b, 16 ), sse_alpha_mask() ) );
+}
+
+/****************************************************/
+/*          Pack 4 RGBA pixels into RGB565          */
+/****************************************************/
+inline __m128i sse_pack_565( __m128i px )
+{
+    const __m128i r = _mm_slli_epi32( _mm_and_si128( px, _mm_set1_epi32( 0xf8 ) ), 8 );
+    const __m128i g = _mm_and_si128( _mm_srli_epi32( px, 5 ), _mm_set1_epi32( 0x7e0 ) );
+    const __m128i b = _mm_and_si128( _mm_srli_epi32( px, 19 ), _mm_set1_epi32( 0x1f ) );
+
+    // Bias into signed range so the saturating pack keeps all 16 bits
+    return _mm_sub_epi32( _mm_or_si128( r, _mm_or_si128( g, b ) ), _mm_set1_epi32( 0x8000 ) );
+}
+
+#endif
+
+/********************************************************/
+/*          Vectorized conversions into RGBA            */
+/*                                                      */
+/*  Returns the number of pixels converted.  The caller */
+/*  finishes the remainder with the scalar path.        */
+/********************************************************/
+size_t simd_to_rgba( [[maybe_unused]] const uint8_t* src,
+                     [[maybe_unused]] PixelFormat    format,
+                     [[maybe_unused]] uint8_t*       dst,
+                     [[maybe_unused]] size_t         count )
+{
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    switch( format ){
+        case PixelFormat::GRAY:
+            for( ; i + 16 <= count; i += 16 ){
+                const uint8x16_t gray = vld1q_u8( src + i );
+                uint8x16x4_t out;
+                out.val[0] = gray;
+                out.val[1] = gray;
+                out.val[2] = gray;
+                out.val[3] = vdupq_n_u8( 255 );
+                vst4q_u8( dst + 4 * i, out );
+            }
+            break;
+        case PixelFormat::GRAY_ALPHA:
+            for( ; i + 16 <= count; i += 16 ){
+                const uint8x16x2_t in = vld2q_u8( src + 2 * i );
+                uint8x16x4_t out;
+                out.val[0] = in.val[0];
+                out.val[1] = in.val[0];
+                out.val[2] = in.val[0];
+                out.val[3] = in.val[1];
+                vst4q_u8( dst + 4 * i, out );
+            }
+            break;
+        case PixelFormat::RGB:
+        case PixelFormat::BGR:
+        {
+            const bool swap = ( format == PixelFormat::BGR );
+            for( ; i + 16 <= count; i += 16 ){
+                const uint8x16x3_t in = vld3q_u8( src + 3 * i );
+                uint8x16x4_t out;
+                out.val[0] = swap ? in.val[2] : in.val[0];
+                out.val[1] = in.val[1];
+                out.val[2] = swap ? in.val[0] : in.val[2];
+                out.val[3] = vdupq_n_u8( 255 );
+                vst4q_u8( dst + 4 * i, out );
+            }
+            break;
+        }
+        case PixelFormat::BGRA:
+            for( ; i + 16 <= count; i += 16 ){
+                uint8x16x4_t px = vld4q_u8( src + 4 * i );
+                const uint8x16_t blue = px.val[0];
+                px.val[0] = px.val[2];
+                px.val[2] = blue;
+                vst4q_u8( dst + 4 * i, px );
+            }
+            break;
+        case PixelFormat::RGB565:
+            for( ; i + 8 <= count; i += 8 ){
+                const uint16x8_t value = vreinterpretq_u16_u8( vld1q_u8( src + 2 * i ) );
+                const uint8x8_t  r = vshrn_n_u16( value, 8 );
+                const uint8x8_t  g = vshrn_n_u16( value, 3 );
+                const uint8x8_t  b = vmovn_u16( vshlq_n_u16( value, 3 ) );
+                uint8x8x4_t out;
+                out.val[0] = vsri_n_u8( r, r, 5 );
+                out.val[1] = vsri_n_u8( g, g, 6 );
+                out.val[2] = vsri_n_u8( b, b, 5 );
+                out.val[3] = vdup_n_u8( 255 );
+                vst4_u8( dst + 4 * i, out );
+            }
+            break;
+        default:
+            break;
+    }
+#elif defined(__SSE2__)
+    switch( format ){
+        case PixelFormat::GRAY:
+            for( ; i + 16 <= count; i += 16 ){
+                const __m128i gray = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) );
+                const __m128i gg_lo = _mm_unpacklo_epi8( gray, gray );
+                const __m128i gg_hi = _mm_unpackhi_epi8( gray, gray );
+                __m128i* out = reinterpret_cast<__m128i*>( dst + 4 * i );
+                _mm_storeu_si128( out + 0, _mm_or_si128( _mm_unpacklo_epi16( gg_lo, gg_lo ), sse_alpha_mask() ) );
+                _mm_storeu_si128( out + 1, _mm_or_si128( _mm_unpackhi_epi16( gg_lo, gg_lo ), sse_alpha_mask() ) );
+                _mm_storeu_si128( out + 2, _mm_or_si128( _mm_unpacklo_epi16( gg_hi, gg_hi ), sse_alpha_mask() ) );
+                _mm_storeu_si128( out + 3, _mm_or_si128( _mm_unpackhi_epi16( gg_hi, gg_hi ), sse_alpha_mask() ) );
+            }
+            break;
+        case PixelFormat::GRAY_ALPHA:
+            for( ; i + 8 <= count; i += 8 ){
+                const __m128i ga   = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 2 * i ) );
+                const __m128i gray = _mm_and_si128( ga, _mm_set1_epi16( 0x00ff ) );
+                const __m128i gg   = _mm_or_si128( gray, _mm_slli_epi16( gray, 8 ) );
+                __m128i* out = reinterpret_cast<__m128i*>( dst + 4 * i );
+                _mm_storeu_si128( out + 0, _mm_unpacklo_epi16( gg, ga ) );
+                _mm_storeu_si128( out + 1, _mm_unpackhi_epi16( gg, ga ) );
+            }
+            break;
+#if defined(__SSSE3__)
+        case PixelFormat::RGB:
+        case PixelFormat::BGR:
+        {
+            const __m128i shuffle = ( format == PixelFormat::RGB )
+                ? _mm_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 )
+                : _mm_setr_epi8( 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1 );
+
+            // Each load reads 16 bytes but only uses 12, so stop before over-reading
+            for( ; i + 6 <= count; i += 4 ){
+                const __m128i in = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 3 * i ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + 4 * i ),
+                                  _mm_or_si128( _mm_shuffle_epi8( in, shuffle ), sse_alpha_mask() ) );
+            }
+            break;
+        }
+#endif
+        case PixelFormat::BGRA:
+            for( ; i + 4 <= count; i += 4 ){
+                const __m128i px = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 4 * i ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + 4 * i ), sse_swap_rb( px ) );
+            }
+            break;
+        case PixelFormat::RGB565:
+            for( ; i + 8 <= count; i += 8 ){
+                const __m128i value = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 2 * i ) );
+                const __m128i zero  = _mm_setzero_si128();
+                __m128i* out = reinterpret_cast<__m128i*>( dst + 4 * i );
+                _mm_storeu_si128( out + 0, sse_expand_565( _mm_unpacklo_epi16( value, zero ) ) );
+                _mm_storeu_si128( out + 1, sse_expand_565( _mm_unpackhi_epi16( value, zero ) ) );
+            }
+            break;
+        default:
+            break;
+    }
+#endif
+    return i;
+}
+
+/********************************************************/
+/*          Vectorized conversions from RGBA            */
+/********************************************************/
+size_t simd_from_rgba( [[maybe_unused]] const uint8_t* src,
+                       [[maybe_unused]] uint8_t*       dst,
+                       [[maybe_unused]] PixelFormat    format,
+                       [[maybe_unused]] size_t         count )
+{
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    switch( format ){
+        case PixelFormat::RGB:
+        case PixelFormat::BGR:
+        {
+            const bool swap = ( format == PixelFormat::BGR );
+            for( ; i + 16 <= count; i += 16 ){
+                const uint8x16x4_t in = vld4q_u8( src + 4 * i );
+                uint8x16x3_t out;
+                out.val[0] = swap ? in.val[2] : in.val[0];
+                out.val[1] = in.val[1];
+                out.val[2] = swap ? in.val[0] : in.val[2];
+                vst3q_u8( dst + 3 * i, out );
+            }
+            break;
+        }
+        case PixelFormat::BGRA:
+            for( ; i + 16 <= count; i += 16 ){
+                uint8x16x4_t px = vld4q_u8( src + 4 * i );
+                const uint8x16_t red = px.val[0];
+                px.val[0] = px.val[2];
+                px.val[2] = red;
+                vst4q_u8( dst + 4 * i, px );
+            }
+            break;
+        case PixelFormat::RGB565:
+            for( ; i + 8 <= count; i += 8 ){
+                const uint8x8x4_t in = vld4_u8( src + 4 * i );
+                uint16x8_t value = vshll_n_u8( in.val[0], 8 );
+                value = vsriq_n_u16( value, vshll_n_u8( in.val[1], 8 ), 5 );
+                value = vsriq_n_u16( value, vshll_n_u8( in.val[2], 8 ), 11 );
+                vst1q_u8( dst + 2 * i, vreinterpretq_u8_u16( value ) );
+            }
+            break;
+        default:
+            break;
+    }
+#elif defined(__SSE2__)
+    switch( format ){
+        case PixelFormat::BGRA:
+            for( ; i + 4 <= count; i += 4 ){
+                const __m128i px = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 4 * i ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + 4 * i ), sse_swap_rb( px ) );
+            }
+            break;
+        case PixelFormat::RGB565:
+            for( ; i + 8 <= count; i += 8 ){
+                const __m128i lo = sse_pack_565( _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 4 * i ) ) );
+                const __m128i hi = sse_pack_565( _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 4 * i + 16 ) ) );
+                const __m128i packed = _mm_xor_si128( _mm_packs_epi32( lo, hi ),
+                                                      _mm_set1_epi16( static_cast<short>( 0x8000u ) ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + 2 * i ), packed );
+            }
+            break;
+        default:
+            break;
+    }
+#endif
+    return i;
+}
+
+/****************************************************/
+/*          Vectorized alpha premultiplication      */
+/*                                                  */
+/*  Every path computes round(c * a / 255) exactly  */
+/*  via (t + (t >> 8)) >> 8 with t = c * a + 128.   */
+/****************************************************/
+size_t simd_premultiply( [[maybe_unused]] uint8_t* rgba,
+                         [[maybe_unused]] size_t   count )
+{
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for( ; i + 16 <= count; i += 16 ){
+        uint8x16x4_t px = vld4q_u8( rgba + 4 * i );
+        for( int c = 0; c < 3; c++ ){
+            const uint16x8_t lo = vmull_u8( vget_low_u8( px.val[c] ),  vget_low_u8( px.val[3] ) );
+            const uint16x8_t hi = vmull_u8( vget_high_u8( px.val[c] ), vget_high_u8( px.val[3] ) );
+            px.val[c] = vcombine_u8( vraddhn_u16( lo, vrshrq_n_u16( lo, 8 ) ),
+                                     vraddhn_u16( hi, vrshrq_n_u16( hi, 8 ) ) );
+        }
+        vst4q_u8( rgba + 4 * i, px );
+    }
+#elif defined(__SSE2__)
+    const __m128i zero   = _mm_setzero_si128();
+    const __m128i bias   = _mm_set1_epi16( 128 );
+    const __m128i color  = _mm_set_epi16( 0, -1, -1, -1, 0, -1, -1, -1 );
+    const __m128i opaque = _mm_set_epi16( 255, 0, 0, 0, 255, 0, 0, 0 );
+
+    auto premultiply = [&]( __m128i px ){
+        // Alpha in the color lanes, 255 in the alpha lane
+        __m128i alpha = _mm_shufflehi_epi16( _mm_shufflelo_epi16( px, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+        alpha = _mm_or_si128( _mm_and_si128( alpha, color ), opaque );
+        __m128i t = _mm_add_epi16( _mm_mullo_epi16( px, alpha ), bias );
+        return _mm_srli_epi16( _mm_add_epi16( t, _mm_srli_epi16( t, 8 ) ), 8 );
+    };
+
+    for( ; i + 4 <= count; i += 4 ){
+        __m128i* ptr = reinterpret_cast<__m128i*>( rgba + 4 * i );
+        const __m128i px = _mm_loadu_si128( ptr );
+        _mm_storeu_si128( ptr, _mm_packus_epi16( premultiply( _mm_unpacklo_epi8( px, zero ) ),
+                                                 premultiply( _mm_unpackhi_epi8( px, zero ) ) ) );
+    }
+#endif
+    return i;
+}
+
+/************************************************/
+/*          Convert a run via RGBA              */
+/************************************************/
+void to_rgba( const uint8_t* src, PixelFormat format, uint8_t* dst, size_t count )
+{
+    const size_t done = simd_to_rgba( src, format, dst, count );
+    convert_scalar( src + done * format_bpp( format ), format,
+                    dst + done * 4, PixelFormat::RGBA,
+                    count - done, false );
+}
+
+void from_rgba( const uint8_t* src, uint8_t* dst, PixelFormat format, size_t count )
+{
+    const size_t done = simd_from_rgba( src, dst, format, count );
+    convert_scalar( src + done * 4, PixelFormat::RGBA,
+                    dst + done * format_bpp( format ), format,
+                    count - done, false );
+}
+
+} // End of anonymous namespace
+
+/****************************************/
+/*          Convert a row of pixels     */
+/****************************************/
+void convert_row( const uint8_t* src,
+                  PixelFormat    src_format,
+                  uint8_t*       dst,
+                  PixelFormat    dst_format,
+                  size_t         count )
+{
+    const size_t src_bpp = format_bpp( src_format );
+    const size_t dst_bpp = format_bpp( dst_format );
+    if( src_bpp == 0 || dst_bpp == 0 ){
+        std::stringstream sout;
+        sout << "Unsupported pixel conversion: " << static_cast<int>( src_format )
+             << " -> " << static_cast<int>( dst_format );
+        throw std::runtime_error( sout.str() );
+    }
+
+    if( src_format == dst_format ){
+        if( src != dst ){
+            std::memmove( dst, src, count * src_bpp );
+        }
+        return;
+    }
+
+    // Expanding in place has to run back to front
+    if( src == dst && dst_bpp > src_bpp ){
+        convert_scalar( src, src_format, dst, dst_format, count, true );
+        return;
+    }
+
+    if( dst_format == PixelFormat::RGBA ){
+        to_rgba( src, src_format, dst, count );
+        return;
+    }
+    if( src_format == PixelFormat::RGBA ){
+        from_rgba( src, dst, dst_format, count );
+        return;
+    }
+
+    // Everything else goes through RGBA in small chunks.  When converting in place, each
+    // chunk's output ends before the next chunk's input starts, so this is still safe.
+    std::array<uint8_t,CHUNK_PIXELS * 4> buffer;
+    for( size_t start = 0; start < count; start += CHUNK_PIXELS ){
+        const size_t n = std::min( CHUNK_PIXELS, count - start );
+        to_rgba( src + start * src_bpp, src_format, buffer.data(), n );
+        from_rgba( buffer.data(), dst + start * dst_bpp, dst_format, n );
+    }
+}
+
+/****************************************/
+/*          Convert a strided image     */
+/****************************************/
+void convert( const uint8_t* src,
+              size_t         src_stride,
+              PixelFormat    src_format,
+              uint8_t*       dst,
+              size_t         dst_stride,
+              PixelFormat    dst_format,
+              size_t         cols,
+              size_t         rows )
+{
+    for( size_t row = 0; row < rows; row++ ){
+        convert_row( src + row * src_stride, src_format,
+                     dst + row * dst_stride, dst_format,
+                     cols );
+    }
+}
+
+/************************************************/
+/*          Convert an image into a frame       */
+/************************************************/
+Frame::ptr_t convert( std::span<const uint8_t> pixels,
+                      size_t                   cols,
+                      size_t                   rows,
+                      size_t                   stride,
+                      PixelFormat              src_format,
+                      PixelFormat              dst_format )
+{
+    if( rows > 0 && pixels.size() < stride * ( rows - 1 ) + cols * bytes_per_pixel( src_format ) ){
+        std::stringstream sout;
+        sout << "Pixel buffer is too small for a " << cols << " x " << rows << " " << to_string( src_format ) << " image";
+        throw std::runtime_error( sout.str() );
+    }
+
+    const size_t dst_bpp = bytes_per_pixel( dst_format );
+    auto frame = Frame_Pool::instance().acquire( Dimensions( cols, rows, dst_bpp ) );
+    convert( pixels.data(), stride, src_format,
+             frame->data(), cols * dst_bpp, dst_format,
+             cols, rows );
+    return frame;
+}
+
+/****************************************************/
+/*          Premultiply color by alpha              */
+/****************************************************/
+void premultiply_alpha( uint8_t* rgba,
+                        size_t   count )
+{
+    for( size_t i = simd_premultiply( rgba, count ); i < count; i++ ){
+        uint8_t* px = rgba + 4 * i;
+        for( size_t c = 0; c < 3; c++ ){
+            const unsigned t = px[c] * px[3] + 128u;
+            px[c] = static_cast<uint8_t>( ( t + ( t >> 8 ) ) >> 8 );
+        }
+    }
+}
+
+/****************************************************/
+/*          Undo alpha premultiplication            */
+/****************************************************/
+void unpremultiply_alpha( uint8_t* rgba,
+                          size_t   count )
+{
+    for( size_t i = 0; i < count; i++ ){
+        uint8_t* px = rgba + 4 * i;
+        const unsigned alpha = px[3];
+        if( alpha == 255 ){
+            continue;
+        }
+        for( size_t c = 0; c < 3; c++ ){
+            px[c] = ( alpha == 0 ) ? 0 : static_cast<uint8_t>( std::min( 255u, ( px[c] * 255u + alpha / 2 ) / alpha ) );
+        }
+    }
+}
+
+} // End of tmns::img namespace
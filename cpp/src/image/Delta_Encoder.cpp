@@ -0,0 +1,318 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Delta_Encoder.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Encodes a sequence of frames as compressed changes from the previous frame.
+ */
+#include <terminus/image/Delta_Encoder.hpp>
+
+// C++ Standard Libraries
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#include <terminus/core/LZ_Codec.hpp>
+
+namespace tmns::img {
+
+namespace {
+
+/// Bytes in a keyframe body before the pixels
+constexpr size_t KEY_HEADER_BYTES { 9 };
+
+/// Bytes before the pixels of each delta span
+constexpr size_t SPAN_HEADER_BYTES { 12 };
+
+/************************************************/
+/*          Append a little-endian value        */
+/************************************************/
+void append_u32( std::vector<uint8_t>& output, size_t value )
+{
+    const size_t pos = output.size();
+    output.resize( pos + 4 );
+    core::write_le<uint32_t>( output.data() + pos, static_cast<uint32_t>( value ) );
+}
+
+/************************************************/
+/*          First byte where buffers differ     */
+/************************************************/
+size_t first_difference( const uint8_t* a, const uint8_t* b, size_t count )
+{
+    size_t i = 0;
+    for( uint64_t wa, wb; i + 8 <= count; i += 8 ){
+        std::memcpy( &wa, a + i, 8 );
+        std::memcpy( &wb, b + i, 8 );
+        if( wa != wb ){
+            break;
+        }
+    }
+    while( i < count && a[i] == b[i] ){
+        i++;
+    }
+    return i;
+}
+
+/************************************************/
+/*          One past the last differing byte    */
+/************************************************/
+size_t last_difference( const uint8_t* a, const uint8_t* b, size_t count )
+{
+    size_t i = count;
+    for( uint64_t wa, wb; i >= 8; i -= 8 ){
+        std::memcpy( &wa, a + i - 8, 8 );
+        std::memcpy( &wb, b + i - 8, 8 );
+        if( wa != wb ){
+            break;
+        }
+    }
+    while( i > 0 && a[i - 1] == b[i - 1] ){
+        i--;
+    }
+    return i;
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*      Convert to String       */
+/********************************/
+std::string to_string( DeltaPacket packet_type )
+{
+    switch( packet_type ){
+        case DeltaPacket::KEY:
+            return "KEY";
+        case DeltaPacket::DELTA:
+            return "DELTA";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Delta_Encoder::Delta_Encoder( size_t keyframe_interval )
+    : m_keyframe_interval { keyframe_interval }
+{}
+
+/************************************/
+/*          Encode a frame          */
+/************************************/
+bool Delta_Encoder::encode( const Frame&          frame,
+                            std::vector<uint8_t>& packet )
+{
+    const Dimensions dims      = frame.dims();
+    const size_t     bpp       = dims.channels();
+    const size_t     row_bytes = dims.cols() * bpp;
+    const uint8_t*   pixels    = frame.data();
+
+    m_stats.frames++;
+    m_stats.raw_bytes += dims.size_bytes();
+
+    const bool resized = dims.cols() != m_dims.cols() ||
+                         dims.rows() != m_dims.rows() ||
+                         bpp         != m_dims.channels();
+    if( resized || m_need_keyframe ){
+        m_dims = dims;
+        m_previous.assign( pixels, pixels + dims.size_bytes() );
+        write_keyframe( packet );
+        return true;
+    }
+
+    // Keep only the changed span of each row
+    m_body.clear();
+    for( size_t row = 0; row < dims.rows(); row++ ){
+        const uint8_t* current  = pixels + row * row_bytes;
+        uint8_t*       previous = m_previous.data() + row * row_bytes;
+
+        const size_t first_byte = first_difference( current, previous, row_bytes );
+        if( first_byte == row_bytes ){
+            continue;
+        }
+        const size_t first = first_byte / bpp;
+        const size_t last  = ( last_difference( current, previous, row_bytes ) + bpp - 1 ) / bpp;
+        const size_t count = last - first;
+
+        append_u32( m_body, row );
+        append_u32( m_body, first );
+        append_u32( m_body, count );
+
+        const size_t start = m_body.size();
+        m_body.resize( start + count * bpp );
+        for( size_t i = 0; i < count * bpp; i++ ){
+            m_body[start + i] = static_cast<uint8_t>( current[first * bpp + i] ^ previous[first * bpp + i] );
+        }
+        std::memcpy( previous + first * bpp, current + first * bpp, count * bpp );
+        m_stats.changed_rows++;
+    }
+
+    if( m_body.empty() ){
+        m_stats.unchanged++;
+        return false;
+    }
+
+    // The previous pixels now match the frame, so a due keyframe can be built from them
+    if( m_keyframe_interval > 0 && m_since_keyframe >= m_keyframe_interval ){
+        write_keyframe( packet );
+        return true;
+    }
+    m_since_keyframe++;
+    finish_packet( DeltaPacket::DELTA, packet );
+    return true;
+}
+
+/****************************************/
+/*          Force a keyframe            */
+/****************************************/
+void Delta_Encoder::request_keyframe()
+{
+    m_need_keyframe = true;
+}
+
+/************************************/
+/*          Get the counters        */
+/************************************/
+Delta_Encoder::Stats Delta_Encoder::stats() const
+{
+    return m_stats;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Delta_Encoder::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Delta_Encoder:" << std::endl;
+    sout << gap << "  - Keyframe Interval: " << m_keyframe_interval << std::endl;
+    sout << gap << "  - Frames: " << m_stats.frames << ", Keyframes: " << m_stats.keyframes
+         << ", Unchanged: " << m_stats.unchanged << ", Changed Rows: " << m_stats.changed_rows << std::endl;
+    sout << gap << "  - Raw Bytes: " << m_stats.raw_bytes << ", Encoded Bytes: " << m_stats.encoded_bytes << std::endl;
+    return sout.str();
+}
+
+/****************************************/
+/*          Write a keyframe            */
+/****************************************/
+void Delta_Encoder::write_keyframe( std::vector<uint8_t>& packet )
+{
+    m_body.clear();
+    append_u32( m_body, m_dims.cols() );
+    append_u32( m_body, m_dims.rows() );
+    m_body.push_back( static_cast<uint8_t>( m_dims.channels() ) );
+    m_body.insert( m_body.end(), m_previous.begin(), m_previous.end() );
+
+    m_need_keyframe  = false;
+    m_since_keyframe = 0;
+    m_stats.keyframes++;
+    finish_packet( DeltaPacket::KEY, packet );
+}
+
+/****************************************/
+/*          Compress the body           */
+/****************************************/
+void Delta_Encoder::finish_packet( DeltaPacket           packet_type,
+                                   std::vector<uint8_t>& packet )
+{
+    packet.resize( PACKET_HEADER_BYTES );
+    packet[0] = static_cast<uint8_t>( packet_type );
+    core::write_le<uint32_t>( packet.data() + 1, static_cast<uint32_t>( m_body.size() ) );
+    core::lz_compress( m_body, packet );
+    m_stats.encoded_bytes += packet.size();
+}
+
+/****************************************/
+/*          Apply the next packet       */
+/****************************************/
+void Delta_Decoder::decode( std::span<const uint8_t> packet )
+{
+    if( packet.size() < Delta_Encoder::PACKET_HEADER_BYTES ){
+        throw std::runtime_error( "Delta packet is too small" );
+    }
+    const auto packet_type = static_cast<DeltaPacket>( packet[0] );
+    m_body.resize( core::read_le<uint32_t>( packet.data() + 1 ) );
+    core::lz_decompress( packet.subspan( Delta_Encoder::PACKET_HEADER_BYTES ), m_body );
+
+    if( packet_type == DeltaPacket::KEY ){
+        if( m_body.size() < KEY_HEADER_BYTES ){
+            throw std::runtime_error( "Keyframe packet is too small" );
+        }
+        Dimensions dims( core::read_le<uint32_t>( m_body.data() ),
+                         core::read_le<uint32_t>( m_body.data() + 4 ),
+                         m_body[8] );
+        if( m_body.size() != KEY_HEADER_BYTES + dims.size_bytes() ){
+            throw std::runtime_error( "Keyframe packet does not match its dimensions" );
+        }
+        m_frame.resize( dims, 0 );
+        std::memcpy( m_frame.data(), m_body.data() + KEY_HEADER_BYTES, dims.size_bytes() );
+        m_has_keyframe = true;
+    }
+    else if( packet_type == DeltaPacket::DELTA ){
+        if( !m_has_keyframe ){
+            throw std::runtime_error( "Delta packet arrived before the first keyframe" );
+        }
+        const size_t bpp       = m_frame.channels();
+        const size_t row_bytes = m_frame.cols() * bpp;
+        uint8_t*     pixels    = m_frame.data();
+
+        size_t pos = 0;
+        while( pos < m_body.size() ){
+            if( pos + SPAN_HEADER_BYTES > m_body.size() ){
+                throw std::runtime_error( "Delta span header is truncated" );
+            }
+            const size_t row   = core::read_le<uint32_t>( m_body.data() + pos );
+            const size_t first = core::read_le<uint32_t>( m_body.data() + pos + 4 );
+            const size_t count = core::read_le<uint32_t>( m_body.data() + pos + 8 );
+            pos += SPAN_HEADER_BYTES;
+
+            if( row >= m_frame.rows() || first + count > m_frame.cols() ||
+                pos + count * bpp > m_body.size() )
+            {
+                throw std::runtime_error( "Delta span is out of range" );
+            }
+            uint8_t* dst = pixels + row * row_bytes + first * bpp;
+            for( size_t i = 0; i < count * bpp; i++ ){
+                dst[i] ^= m_body[pos + i];
+            }
+            pos += count * bpp;
+        }
+    }
+    else {
+        std::stringstream sout;
+        sout << "Unknown delta packet type: " << static_cast<int>( packet[0] );
+        throw std::runtime_error( sout.str() );
+    }
+    m_last_packet = packet_type;
+}
+
+/************************************/
+/*          Get the frame           */
+/************************************/
+const Frame& Delta_Decoder::frame() const
+{
+    return m_frame;
+}
+
+/****************************************/
+/*          Last packet decoded         */
+/****************************************/
+DeltaPacket Delta_Decoder::last_packet() const
+{
+    return m_last_packet;
+}
+
+} // End of tmns::img namespace
@@ -17,8 +17,13 @@
 #include <terminus/image/Frame.hpp>
 
 // C++ Standard Libraries
+#include <cstring>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/image/Frame_Pool.hpp>
 
 namespace tmns::img {
 
@@ -41,7 +46,44 @@ Frame::Frame( std::span<char>   pixel_data,
     resize( m_dims, 0 );
     std::copy( pixel_data.begin(),
                pixel_data.end(),
-               m_image.begin() );
+               m_storage->begin() );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Frame::Frame( std::shared_ptr<std::vector<uint8_t>> storage,
+              const Dimensions&                     dims )
+    : m_storage( std::move( storage ) ),
+      m_dims( dims )
+{
+    m_storage->assign( m_dims.size_bytes(), 0 );
+}
+
+/********************************/
+/*       Copy Constructor       */
+/********************************/
+Frame::Frame( const Frame& other )
+    : m_storage( other.m_storage ),
+      m_external( other.m_external ),
+      m_external_owner( other.m_external_owner ),
+      m_dims( other.m_dims ),
+      m_premultiplied( other.m_premultiplied )
+{}
+
+/********************************/
+/*      Assignment Operator     */
+/********************************/
+Frame& Frame::operator = ( const Frame& other )
+{
+    if( this != &other ){
+        m_storage           = other.m_storage;
+        m_external          = other.m_external;
+        m_external_owner    = other.m_external_owner;
+        m_dims              = other.m_dims;
+        m_premultiplied     = other.m_premultiplied;
+    }
+    return (*this);
 }
 
 /******************************/
@@ -50,7 +92,10 @@ Frame::Frame( std::span<char>   pixel_data,
 void Frame::clear()
 {
     m_dims = Dimensions();
-    m_image.clear();
+    m_premultiplied = false;
+    m_storage.reset();
+    m_external = std::span<const uint8_t>();
+    m_external_owner.reset();
 }
 
 /******************************/
@@ -58,22 +103,24 @@ void Frame::clear()
 /******************************/
 void Frame::resize( Dimensions new_dims, uint8_t pixel )
 {
+    if( !m_external.empty() ){
+        copy_external();
+    }
+    else if( is_shared() ){
+        unshare();
+    }
+    if( !m_storage ){
+        m_storage = std::make_shared<std::vector<uint8_t>>();
+    }
     m_dims = new_dims;
-    m_image.resize( new_dims.size_bytes(), pixel );   
-}
-
-/******************************/
-/*      Get Pixel Value       */
-/******************************/
-uint8_t& Frame::get_pixel( size_t col, size_t row, size_t channel ){
-    return m_image[ row * m_dims.cols() + col * m_dims.channels() + channel];
+    m_storage->resize( new_dims.size_bytes(), pixel );
 }
 
 /******************************/
 /*      Get Pixel Value       */
 /******************************/
 uint8_t Frame::get_pixel( size_t col, size_t row, size_t channel ) const {
-    return m_image[ row * m_dims.cols() + col * m_dims.channels() + channel];
+    return data()[ offset( col, row ) + channel ];
 }
 
 /******************************/
@@ -82,19 +129,19 @@ uint8_t Frame::get_pixel( size_t col, size_t row, size_t channel ) const {
 math::Vector4u Frame::get_pixel( size_t col, size_t row ) const {
 
     // Get the start position
-    size_t pos = row * m_dims.cols() * m_dims.channels() + col * m_dims.channels();
+    const uint8_t* pixel = data() + offset( col, row );
 
-    return math::Vector4u( { m_image[pos+0],
-                             m_image[pos+1],
-                             m_image[pos+2],
-                             m_image[pos+3]});
+    return math::Vector4u( { pixel[0],
+                             pixel[1],
+                             pixel[2],
+                             pixel[3] } );
 }
 
 /******************************/
 /*      Set Pixel Value       */
 /******************************/
 void Frame::set_pixel( size_t col, size_t row, size_t channel, uint8_t value ){
-    m_image[ row * m_dims.cols() * m_dims.channels() + col * m_dims.channels() + channel] = value;
+    data()[ offset( col, row ) + channel ] = value;
 }
 
 /******************************/
@@ -102,12 +149,9 @@ void Frame::set_pixel( size_t col, size_t row, size_t channel, uint8_t value ){
 /******************************/
 void Frame::set_pixel( size_t col, size_t row, math::Vector4u value ){
 
-    // Point to the first position
-    size_t pos = row * m_dims.cols() * m_dims.channels() + col * m_dims.channels();
-
     std::copy( value.begin(), 
                value.end(),
-               m_image.begin() + static_cast<long int>(pos) );
+               data() + offset( col, row ) );
 }
 
 /******************************/
@@ -121,6 +165,26 @@ void Frame::set_all_pixels( math::Vector4u value ){
     }}
 }
 
+/****************************************/
+/*          Scroll the Rows             */
+/****************************************/
+void Frame::scroll_rows( int delta )
+{
+    const size_t shift = static_cast<size_t>( delta < 0 ? -delta : delta );
+    if( shift == 0 || shift >= rows() ){
+        return;
+    }
+
+    const size_t row_bytes = cols() * channels();
+    const size_t moved     = ( rows() - shift ) * row_bytes;
+    auto pixels = data();
+    if( delta > 0 ){
+        std::memmove( pixels, pixels + shift * row_bytes, moved );
+    } else {
+        std::memmove( pixels + shift * row_bytes, pixels, moved );
+    }
+}
+
 /************************************************/
 /*          Print Log-Friendly String           */
 /************************************************/
@@ -131,9 +195,54 @@ std::string Frame::to_log_string( size_t offset ) const
     std::stringstream sout;
     sout << gap << "Frame:" << std::endl;
     sout << gap << "  - Cols: " << cols() << ", Rows: " << rows() << ", Channels: " << channels() << std::endl;
-    sout << gap << "  - Image Allocated Size: " << m_image.size() << std::endl; 
+    sout << gap << "  - Image Allocated Size: " << ( m_storage ? m_storage->size() : 0 ) << std::endl; 
+    sout << gap << "  - External Pixels: " << std::boolalpha << is_external() << std::endl;
+    sout << gap << "  - Shared Pixels: " << std::boolalpha << is_shared() << std::endl;
+    sout << gap << "  - Premultiplied: " << std::boolalpha << is_premultiplied() << std::endl;
     return sout.str();
 }
 
+/****************************************************/
+/*          Wrap externally owned pixel data        */
+/****************************************************/
+Frame::ptr_t Frame::from_external( std::span<const uint8_t>    pixels,
+                                   const Dimensions&           dims,
+                                   std::shared_ptr<const void> owner )
+{
+    if( pixels.size() < dims.size_bytes() ){
+        std::stringstream sout;
+        sout << "External pixel buffer is too small. Expected: " << dims.size_bytes()
+             << ", Actual: " << pixels.size();
+        throw std::runtime_error( sout.str() );
+    }
+
+    auto frame = std::make_shared<Frame>();
+    frame->m_dims           = dims;
+    frame->m_external       = pixels.subspan( 0, dims.size_bytes() );
+    frame->m_external_owner = std::move( owner );
+    return frame;
+}
+
+/****************************************************/
+/*      Copy external pixels into owned storage     */
+/****************************************************/
+void Frame::copy_external()
+{
+    m_storage = Frame_Pool::instance().acquire_storage( m_external.size() );
+    m_storage->assign( m_external.begin(), m_external.end() );
+    m_external = std::span<const uint8_t>();
+    m_external_owner.reset();
+}
+
+/****************************************************/
+/*          Take a private copy of the pixels       */
+/****************************************************/
+void Frame::unshare()
+{
+    auto storage = Frame_Pool::instance().acquire_storage( m_storage->size() );
+    storage->assign( m_storage->begin(), m_storage->end() );
+    m_storage = std::move( storage );
+}
+
 
 } // End of tmns::img namespace
\ No newline at end of file
@@ -0,0 +1,374 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_File.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Native Terminus Frame (.tfrm) asset format.
+ */
+#include <terminus/image/Frame_File.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#if TERMINUS_POSIX
+#include <terminus/core/Memory_Map.hpp>
+#endif
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_Pool.hpp>
+
+namespace tmns::img {
+
+namespace {
+
+/// Longest run a single RLE control byte can describe
+constexpr size_t RLE_MAX_RUN { 129 };
+
+/// Longest literal block a single RLE control byte can describe
+constexpr size_t RLE_MAX_LITERAL { 128 };
+
+/****************************************************************/
+/*          Run-length encode a buffer of fixed-size pixels     */
+/*                                                              */
+/*  Control byte 0..127   -> (n+1) literal pixels follow        */
+/*  Control byte 128..255 -> next pixel repeats (n-126) times   */
+/****************************************************************/
+std::vector<uint8_t> rle_encode( std::span<const uint8_t> pixels, size_t bpp )
+{
+    std::vector<uint8_t> output;
+    output.reserve( pixels.size() / 2 );
+
+    const size_t npixels = pixels.size() / bpp;
+    auto same_pixel = [&]( size_t a, size_t b ){
+        return std::memcmp( pixels.data() + a * bpp, pixels.data() + b * bpp, bpp ) == 0;
+    };
+
+    size_t idx = 0;
+    while( idx < npixels ){
+
+        // Measure the run starting here
+        size_t run = 1;
+        while( idx + run < npixels && run < RLE_MAX_RUN && same_pixel( idx, idx + run ) ){
+            run++;
+        }
+
+        if( run >= 2 ){
+            output.push_back( static_cast<uint8_t>( run + 126 ) );
+            output.insert( output.end(), pixels.begin() + static_cast<long>( idx * bpp ),
+                                         pixels.begin() + static_cast<long>( ( idx + 1 ) * bpp ) );
+            idx += run;
+            continue;
+        }
+
+        // Collect literals until the next run of at least two pixels
+        size_t count = 1;
+        while( idx + count < npixels && count < RLE_MAX_LITERAL ){
+            if( idx + count + 1 < npixels && same_pixel( idx + count, idx + count + 1 ) ){
+                break;
+            }
+            count++;
+        }
+        output.push_back( static_cast<uint8_t>( count - 1 ) );
+        output.insert( output.end(), pixels.begin() + static_cast<long>( idx * bpp ),
+                                     pixels.begin() + static_cast<long>( ( idx + count ) * bpp ) );
+        idx += count;
+    }
+    return output;
+}
+
+/********************************************/
+/*          Decode an RLE pixel buffer      */
+/********************************************/
+void rle_decode( std::span<const uint8_t> payload,
+                 size_t                   bpp,
+                 std::span<uint8_t>       output )
+{
+    size_t in_pos  = 0;
+    size_t out_pos = 0;
+    while( in_pos < payload.size() && out_pos < output.size() ){
+
+        const uint8_t control = payload[in_pos++];
+        const bool    is_run  = control >= 128;
+        const size_t  count   = is_run ? static_cast<size_t>( control - 126 ) : static_cast<size_t>( control + 1 );
+        const size_t  nbytes  = is_run ? bpp : count * bpp;
+
+        if( in_pos + nbytes > payload.size() || out_pos + count * bpp > output.size() ){
+            throw std::runtime_error( "Corrupt RLE payload in frame file" );
+        }
+
+        if( is_run ){
+            for( size_t i = 0; i < count; i++ ){
+                std::memcpy( output.data() + out_pos, payload.data() + in_pos, bpp );
+                out_pos += bpp;
+            }
+        } else {
+            std::memcpy( output.data() + out_pos, payload.data() + in_pos, nbytes );
+            out_pos += nbytes;
+        }
+        in_pos += nbytes;
+    }
+
+    if( out_pos != output.size() ){
+        throw std::runtime_error( "RLE payload in frame file is truncated" );
+    }
+}
+
+/**
+ * Format of the frame a file loads into.  Frames have no format tag, so only layouts their
+ * channel count implies are kept as they are.
+ */
+PixelFormat frame_format_for( PixelFormat format )
+{
+    switch( format ){
+        case PixelFormat::BGR:
+        case PixelFormat::RGB565:
+            return PixelFormat::RGB;
+        case PixelFormat::BGRA:
+            return PixelFormat::RGBA;
+        default:
+            return format;
+    }
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*      Convert to String       */
+/********************************/
+std::string to_string( FrameCompression compression )
+{
+    switch( compression ){
+        case FrameCompression::NONE:
+            return "NONE";
+        case FrameCompression::RLE:
+            return "RLE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/************************************/
+/*          Parse the header        */
+/************************************/
+Frame_File_Header Frame_File_Header::parse( std::span<const uint8_t> buffer )
+{
+    if( buffer.size() < SIZE_BYTES ||
+        !std::equal( MAGIC.begin(), MAGIC.end(), buffer.begin(),
+                     []( char a, uint8_t b ){ return static_cast<uint8_t>( a ) == b; } ) )
+    {
+        throw std::runtime_error( "Buffer is not a Terminus frame file" );
+    }
+
+    Frame_File_Header header;
+    header.version      = core::read_le<uint16_t>( buffer.data() + 4 );
+    header.format       = static_cast<PixelFormat>( buffer[6] );
+    header.compression  = static_cast<FrameCompression>( buffer[7] );
+    header.cols         = core::read_le<uint32_t>( buffer.data() + 8 );
+    header.rows         = core::read_le<uint32_t>( buffer.data() + 12 );
+    header.stride       = core::read_le<uint32_t>( buffer.data() + 16 );
+    header.payload_size = core::read_le<uint32_t>( buffer.data() + 20 );
+    header.data_offset  = core::read_le<uint32_t>( buffer.data() + 24 );
+    header.flags        = core::read_le<uint32_t>( buffer.data() + 28 );
+
+    std::stringstream sout;
+    if( header.version != VERSION ){
+        sout << "Unsupported frame file version: " << header.version;
+    }
+    else if( header.compression != FrameCompression::NONE &&
+             header.compression != FrameCompression::RLE ){
+        sout << "Unsupported frame file compression: " << static_cast<int>( header.compression );
+    }
+    else if( buffer[6] < static_cast<uint8_t>( PixelFormat::GRAY ) ||
+             buffer[6] > static_cast<uint8_t>( PixelFormat::RGB565 ) ){
+        sout << "Unsupported frame file pixel format: " << static_cast<int>( buffer[6] );
+    }
+    else if( static_cast<size_t>( header.stride ) < header.cols * bytes_per_pixel( header.format ) ){
+        sout << "Frame file stride (" << header.stride << ") is smaller than a row";
+    }
+    else if( static_cast<size_t>( header.data_offset ) + header.payload_size > buffer.size() ){
+        sout << "Frame file payload extends past the end of the buffer";
+    }
+    if( !sout.str().empty() ){
+        throw std::runtime_error( sout.str() );
+    }
+    return header;
+}
+
+/****************************************/
+/*          Serialize the header        */
+/****************************************/
+std::vector<uint8_t> Frame_File_Header::serialize() const
+{
+    std::vector<uint8_t> output( SIZE_BYTES, 0 );
+    std::copy( MAGIC.begin(), MAGIC.end(), output.begin() );
+    core::write_le<uint16_t>( output.data() + 4, version );
+    output[6] = static_cast<uint8_t>( format );
+    output[7] = static_cast<uint8_t>( compression );
+    core::write_le<uint32_t>( output.data() + 8,  cols );
+    core::write_le<uint32_t>( output.data() + 12, rows );
+    core::write_le<uint32_t>( output.data() + 16, stride );
+    core::write_le<uint32_t>( output.data() + 20, payload_size );
+    core::write_le<uint32_t>( output.data() + 24, data_offset );
+    core::write_le<uint32_t>( output.data() + 28, flags );
+    return output;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Frame_File_Header::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Frame_File_Header:" << std::endl;
+    sout << gap << "  - Version: " << version << std::endl;
+    sout << gap << "  - Format: " << to_string( format ) << std::endl;
+    sout << gap << "  - Compression: " << to_string( compression ) << std::endl;
+    sout << gap << "  - Size: " << cols << " x " << rows << ", stride: " << stride << std::endl;
+    sout << gap << "  - Payload: " << payload_size << " bytes at offset " << data_offset << std::endl;
+    sout << gap << "  - Flags: 0x" << std::hex << flags << std::dec << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Build a frame from a buffer         */
+/************************************************/
+Frame::ptr_t frame_from_buffer( std::span<const uint8_t>    buffer,
+                                std::shared_ptr<const void> owner )
+{
+    auto header = Frame_File_Header::parse( buffer );
+
+    // Frames only know their channel count, so other layouts are converted to the matching
+    // RGB or RGBA frame as they load
+    const size_t      bpp        = bytes_per_pixel( header.format );
+    const size_t      row_bytes  = header.cols * bpp;
+    const PixelFormat out_format = frame_format_for( header.format );
+    const size_t      out_bpp    = bytes_per_pixel( out_format );
+    Dimensions dims( header.cols, header.rows, out_bpp );
+
+    auto payload = buffer.subspan( header.data_offset, header.payload_size );
+
+    // Zero-copy path
+    const bool premultiplied = ( header.flags & Frame_File_Header::FLAG_PREMULTIPLIED ) != 0;
+    if( header.compression == FrameCompression::NONE && header.stride == row_bytes && out_format == header.format ){
+        auto frame = Frame::from_external( payload, dims, std::move( owner ) );
+        frame->set_premultiplied( premultiplied );
+        return frame;
+    }
+
+    // Gather the rows, unpacked and in the file's format
+    std::vector<uint8_t> unpacked;
+    std::span<const uint8_t> rows;
+    if( header.compression == FrameCompression::RLE ){
+        unpacked.resize( row_bytes * header.rows );
+        rle_decode( payload, bpp, unpacked );
+        rows = unpacked;
+    }
+    else {
+        if( payload.size() < static_cast<size_t>( header.stride ) * header.rows ){
+            throw std::runtime_error( "Frame file payload is smaller than stride x rows" );
+        }
+        rows = payload;
+    }
+    const size_t src_stride = ( header.compression == FrameCompression::RLE ) ? row_bytes : header.stride;
+
+    auto frame = Frame_Pool::instance().acquire( dims );
+    frame->set_premultiplied( premultiplied );
+    uint8_t* pixels = frame->data();
+    for( size_t row = 0; row < header.rows; row++ ){
+        const uint8_t* src = rows.data() + row * src_stride;
+        uint8_t*       dst = pixels + row * header.cols * out_bpp;
+        if( out_format == header.format ){
+            std::memcpy( dst, src, row_bytes );
+        }
+        else {
+            convert_row( src, header.format, dst, out_format, header.cols );
+        }
+    }
+    return frame;
+}
+
+/************************************************/
+/*          Memory-map a frame from disk        */
+/************************************************/
+Frame::ptr_t read_frame_file( const std::filesystem::path& pathname )
+{
+#if !TERMINUS_POSIX
+    throw std::runtime_error( "Reading frame files needs memory mapping, which this build does not have: " + pathname.native() );
+#else
+    auto mapping = core::Memory_Map::open( pathname );
+    auto buffer  = mapping->data();
+    try {
+        return frame_from_buffer( buffer, mapping );
+    }
+    catch( const std::runtime_error& e ){
+        throw std::runtime_error( std::string( e.what() ) + ": " + pathname.native() );
+    }
+#endif
+}
+
+/************************************************/
+/*          Encode a frame into a buffer        */
+/************************************************/
+std::vector<uint8_t> encode_frame_file( const Frame&     frame,
+                                        FrameCompression compression )
+{
+    const size_t bpp = frame.channels();
+
+    Frame_File_Header header;
+    header.format      = pixel_format_from_channels( bpp );
+    header.compression = compression;
+    header.cols        = static_cast<uint32_t>( frame.cols() );
+    header.rows        = static_cast<uint32_t>( frame.rows() );
+    header.stride      = static_cast<uint32_t>( frame.cols() * bpp );
+    header.data_offset = static_cast<uint32_t>( Frame_File_Header::SIZE_BYTES );
+    header.flags       = frame.is_premultiplied() ? Frame_File_Header::FLAG_PREMULTIPLIED : 0u;
+
+    std::span<const uint8_t> pixels( frame.data(), frame.dims().size_bytes() );
+    std::vector<uint8_t> payload;
+    if( compression == FrameCompression::RLE ){
+        payload = rle_encode( pixels, bpp );
+    }
+    else {
+        payload.assign( pixels.begin(), pixels.end() );
+    }
+    header.payload_size = static_cast<uint32_t>( payload.size() );
+
+    auto output = header.serialize();
+    output.insert( output.end(), payload.begin(), payload.end() );
+    return output;
+}
+
+/****************************************/
+/*          Write a frame to disk       */
+/****************************************/
+void write_frame_file( const Frame&                 frame,
+                       const std::filesystem::path& pathname,
+                       FrameCompression             compression )
+{
+    auto buffer = encode_frame_file( frame, compression );
+
+    std::ofstream fout( pathname, std::ios::binary | std::ios::trunc );
+    fout.write( reinterpret_cast<const char*>( buffer.data() ),
+                static_cast<std::streamsize>( buffer.size() ) );
+    if( !fout.good() ){
+        throw std::runtime_error( "Unable to write frame file: " + pathname.native() );
+    }
+}
+
+} // End of tmns::img namespace
@@ -0,0 +1,194 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_Pool.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Recycles frame pixel buffers.
+ */
+#include <terminus/image/Frame_Pool.hpp>
+
+// C++ Standard Libraries
+#include <sstream>
+
+namespace tmns::img {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Frame_Pool::Frame_Pool( size_t max_cached_bytes )
+    : m_state( std::make_shared<State>() )
+{
+    m_state->max_cached_bytes = max_cached_bytes;
+}
+
+/****************************************/
+/*          Get a pooled frame          */
+/****************************************/
+Frame::ptr_t Frame_Pool::acquire( const Dimensions& dims )
+{
+    return std::make_shared<Frame>( acquire_storage( dims.size_bytes() ), dims );
+}
+
+/****************************************/
+/*          Get a pooled buffer         */
+/****************************************/
+std::shared_ptr<std::vector<uint8_t>> Frame_Pool::acquire_storage( size_t bytes )
+{
+    const size_t index = size_class( bytes );
+
+    std::vector<uint8_t> buffer;
+    if( index < NUM_CLASSES ){
+        std::lock_guard<std::mutex> lock( m_state->mutex );
+        auto& free_list = m_state->free_lists[index];
+        if( !free_list.empty() ){
+            buffer = std::move( free_list.back() );
+            free_list.pop_back();
+            m_state->stats.cached_bytes -= buffer.capacity();
+            m_state->stats.hits++;
+        }
+        else {
+            m_state->stats.misses++;
+        }
+    }
+
+    // Fresh buffers get the full class size, so they can be reused by anything in the class
+    if( buffer.capacity() == 0 && index < NUM_CLASSES ){
+        buffer.reserve( class_bytes( index ) );
+    }
+
+    std::weak_ptr<State> weak_state = m_state;
+    return std::shared_ptr<std::vector<uint8_t>>( new std::vector<uint8_t>( std::move( buffer ) ),
+                                                  [weak_state]( std::vector<uint8_t>* storage ){
+                                                      if( auto state = weak_state.lock() ){
+                                                          std::lock_guard<std::mutex> lock( state->mutex );
+                                                          state->recycle( std::move( *storage ) );
+                                                      }
+                                                      delete storage;
+                                                  } );
+}
+
+/********************************************/
+/*          Set the cached byte cap         */
+/********************************************/
+void Frame_Pool::set_max_cached_bytes( size_t max_cached_bytes )
+{
+    std::lock_guard<std::mutex> lock( m_state->mutex );
+    m_state->max_cached_bytes = max_cached_bytes;
+    m_state->evict();
+}
+
+/************************************/
+/*          Free the cache          */
+/************************************/
+void Frame_Pool::trim()
+{
+    std::lock_guard<std::mutex> lock( m_state->mutex );
+    for( auto& free_list : m_state->free_lists ){
+        free_list.clear();
+    }
+    m_state->stats.cached_bytes = 0;
+}
+
+/************************************/
+/*          Get the counters        */
+/************************************/
+Frame_Pool::Stats Frame_Pool::stats() const
+{
+    std::lock_guard<std::mutex> lock( m_state->mutex );
+    return m_state->stats;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Frame_Pool::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+    auto counters = stats();
+
+    std::stringstream sout;
+    sout << gap << "Frame_Pool:" << std::endl;
+    sout << gap << "  - Hits: " << counters.hits << ", Misses: " << counters.misses
+         << ", Evictions: " << counters.evictions << std::endl;
+    sout << gap << "  - Cached Bytes: " << counters.cached_bytes << std::endl;
+    return sout.str();
+}
+
+/****************************************/
+/*          Get Shared Instance         */
+/****************************************/
+Frame_Pool& Frame_Pool::instance()
+{
+    // Constructed once, thread-safe, on first use from any thread
+    static Frame_Pool pool;
+    return pool;
+}
+
+/********************************************/
+/*          Size class for a buffer         */
+/********************************************/
+size_t Frame_Pool::size_class( size_t bytes )
+{
+    size_t index = 0;
+    while( index < NUM_CLASSES && class_bytes( index ) < bytes ){
+        index++;
+    }
+    return index;
+}
+
+/********************************************/
+/*          Bytes in a size class           */
+/********************************************/
+size_t Frame_Pool::class_bytes( size_t index )
+{
+    // Each octave is split into even steps, 256, 320, 384, 448, 512, 640, ...
+    const size_t octave = MIN_CLASS_BYTES << ( index / CLASSES_PER_OCTAVE );
+    return octave + ( octave / CLASSES_PER_OCTAVE ) * ( index % CLASSES_PER_OCTAVE );
+}
+
+/************************************/
+/*          Take a buffer back      */
+/************************************/
+void Frame_Pool::State::recycle( std::vector<uint8_t>&& buffer )
+{
+    // File the buffer under the largest class it holds, so it fits every request for that class
+    const size_t capacity = buffer.capacity();
+    if( capacity < MIN_CLASS_BYTES || capacity > class_bytes( NUM_CLASSES - 1 ) ){
+        return;
+    }
+    size_t index = size_class( capacity );
+    if( class_bytes( index ) > capacity ){
+        index--;
+    }
+
+    buffer.clear();
+    stats.cached_bytes += buffer.capacity();
+    free_lists[index].push_back( std::move( buffer ) );
+    evict();
+}
+
+/****************************************/
+/*          Shrink to the cap           */
+/****************************************/
+void Frame_Pool::State::evict()
+{
+    for( size_t index = NUM_CLASSES; index > 0 && stats.cached_bytes > max_cached_bytes; index-- ){
+        auto& free_list = free_lists[index - 1];
+        while( !free_list.empty() && stats.cached_bytes > max_cached_bytes ){
+            stats.cached_bytes -= free_list.back().capacity();
+            free_list.pop_back();
+            stats.evictions++;
+        }
+    }
+}
+
+} // End of tmns::img namespace
@@ -0,0 +1,199 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Frame_Recording.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Streaming recording (.trec) of displayed frames.
+ */
+#include <terminus/image/Frame_Recording.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/core/Byte_Order.hpp>
+#if TERMINUS_POSIX
+#include <terminus/core/Memory_Map.hpp>
+#endif
+
+namespace tmns::img {
+
+/****************************************/
+/*          Add a frame to the file     */
+/****************************************/
+void Recording_Writer::write( const Frame&              frame,
+                              std::chrono::microseconds timestamp )
+{
+    if( !m_encoder.encode( frame, m_packet ) ){
+        return;
+    }
+
+    uint8_t header[Frame_Recording::RECORD_HEADER_BYTES];
+    core::write_le<uint64_t>( header, static_cast<uint64_t>( timestamp.count() ) );
+    core::write_le<uint32_t>( header + 8, static_cast<uint32_t>( m_packet.size() ) );
+    m_fout.write( reinterpret_cast<const char*>( header ), sizeof( header ) );
+    m_fout.write( reinterpret_cast<const char*>( m_packet.data() ),
+                  static_cast<std::streamsize>( m_packet.size() ) );
+
+    // Keyframes are the recovery points, so make sure they reach the disk
+    if( static_cast<DeltaPacket>( m_packet[0] ) == DeltaPacket::KEY ){
+        m_fout.flush();
+    }
+
+    if( !m_fout.good() ){
+        throw std::runtime_error( "Unable to write recording: " + m_pathname.native() );
+    }
+}
+
+/************************************/
+/*          Flush the stream        */
+/************************************/
+void Recording_Writer::flush()
+{
+    m_fout.flush();
+}
+
+/************************************/
+/*          Get the encoder         */
+/************************************/
+const Delta_Encoder& Recording_Writer::encoder() const
+{
+    return m_encoder;
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Recording_Writer::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Recording_Writer:" << std::endl;
+    sout << gap << "  - Path: " << m_pathname.native() << std::endl;
+    sout << m_encoder.to_log_string( offset + 2 );
+    return sout.str();
+}
+
+/****************************************/
+/*          Create a new recording      */
+/****************************************/
+Recording_Writer::ptr_t Recording_Writer::create( const std::filesystem::path& pathname,
+                                                  size_t                       keyframe_interval )
+{
+    return Recording_Writer::ptr_t( new Recording_Writer( pathname, keyframe_interval ) );
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Recording_Writer::Recording_Writer( const std::filesystem::path& pathname,
+                                    size_t                       keyframe_interval )
+    : m_pathname { pathname },
+      m_fout { pathname, std::ios::binary | std::ios::trunc },
+      m_encoder { keyframe_interval }
+{
+    uint8_t header[Frame_Recording::HEADER_BYTES] {};
+    std::copy( Frame_Recording::MAGIC.begin(), Frame_Recording::MAGIC.end(), header );
+    core::write_le<uint16_t>( header + 4, Frame_Recording::VERSION );
+    m_fout.write( reinterpret_cast<const char*>( header ), sizeof( header ) );
+
+    if( !m_fout.good() ){
+        throw std::runtime_error( "Unable to create recording: " + pathname.native() );
+    }
+}
+
+/****************************************/
+/*          Decode the next record      */
+/****************************************/
+bool Recording_Reader::next()
+{
+    auto buffer = m_buffer;
+    if( m_position + Frame_Recording::RECORD_HEADER_BYTES > buffer.size() ){
+        return false;
+    }
+    const uint64_t timestamp = core::read_le<uint64_t>( buffer.data() + m_position );
+    const size_t   size      = core::read_le<uint32_t>( buffer.data() + m_position + 8 );
+    const size_t   start     = m_position + Frame_Recording::RECORD_HEADER_BYTES;
+    if( start + size > buffer.size() ){
+        return false;
+    }
+
+    m_decoder.decode( buffer.subspan( start, size ) );
+    m_timestamp = std::chrono::microseconds( static_cast<int64_t>( timestamp ) );
+    m_position  = start + size;
+    return true;
+}
+
+/************************************/
+/*          Get the frame           */
+/************************************/
+const Frame& Recording_Reader::frame() const
+{
+    return m_decoder.frame();
+}
+
+/************************************/
+/*          Get the timestamp       */
+/************************************/
+std::chrono::microseconds Recording_Reader::timestamp() const
+{
+    return m_timestamp;
+}
+
+/************************************/
+/*          Get the decoder         */
+/************************************/
+const Delta_Decoder& Recording_Reader::decoder() const
+{
+    return m_decoder;
+}
+
+/****************************************/
+/*          Open a recording            */
+/****************************************/
+Recording_Reader::ptr_t Recording_Reader::open( const std::filesystem::path& pathname )
+{
+#if !TERMINUS_POSIX
+    throw std::runtime_error( "Reading recordings needs memory mapping, which this build does not have: " + pathname.native() );
+#else
+    auto mapping = core::Memory_Map::open( pathname );
+    auto buffer  = mapping->data();
+    if( buffer.size() < Frame_Recording::HEADER_BYTES ||
+        !std::equal( Frame_Recording::MAGIC.begin(), Frame_Recording::MAGIC.end(), buffer.begin(),
+                     []( char a, uint8_t b ){ return static_cast<uint8_t>( a ) == b; } ) )
+    {
+        throw std::runtime_error( "File is not a Terminus recording: " + pathname.native() );
+    }
+
+    const uint16_t version = core::read_le<uint16_t>( buffer.data() + 4 );
+    if( version != Frame_Recording::VERSION ){
+        std::stringstream sout;
+        sout << "Unsupported recording version " << version << ": " << pathname.native();
+        throw std::runtime_error( sout.str() );
+    }
+    return Recording_Reader::ptr_t( new Recording_Reader( buffer, std::move( mapping ) ) );
+#endif
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Recording_Reader::Recording_Reader( std::span<const uint8_t>    buffer,
+                                    std::shared_ptr<const void> owner )
+    : m_buffer { buffer },
+      m_owner { std::move( owner ) }
+{}
+
+} // End of tmns::img namespace
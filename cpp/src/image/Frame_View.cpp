@@ -16,13 +16,54 @@
  */
 #include <terminus/image/Frame_View.hpp>
 
+// C++ Standard Libraries
+#include <algorithm>
+#include <array>
+
 /// Terminus Libraries
+#include <terminus/image/Composite.hpp>
+#include <terminus/image/Convert.hpp>
 #include <terminus/log/Logger.hpp>
 #include <terminus/math/Point_Utilities.hpp>
 #include <terminus/math/Size.hpp>
 
 namespace tmns::img {
 
+namespace {
+
+/// Pixels converted per chunk when blending a frame that is not premultiplied RGBA
+constexpr size_t BLEND_CHUNK_PIXELS { 64 };
+
+/************************************************/
+/*          Check if a rectangle is empty       */
+/************************************************/
+inline bool is_empty( const math::Rect2i& rect )
+{
+    return rect.width() <= 0 || rect.height() <= 0;
+}
+
+/************************************************/
+/*          Get the extent of a frame           */
+/************************************************/
+inline math::Rect2i frame_extent( const Frame& frame )
+{
+    return math::Rect2i( 0, 0, static_cast<int>( frame.cols() ), static_cast<int>( frame.rows() ) );
+}
+
+/**
+ * Throw if a pixel read would fall outside the view's clip
+ */
+void require_visible( const Frame_View& view, size_t col, size_t row )
+{
+    if( !view.is_visible( static_cast<int>( col ), static_cast<int>( row ) ) ){
+        std::stringstream sout;
+        sout << "Pixel (" << col << ", " << row << ") is outside the view clip " << view.clip().to_string();
+        throw std::runtime_error( sout.str() );
+    }
+}
+
+} // End of anonymous namespace
+
 /****************************/
 /*      Constructor         */
 /****************************/
@@ -31,6 +72,7 @@ Frame_View::Frame_View( Frame& frame )
 {
     m_bbox = math::Rect2i( math::ToPoint2<int>( 0, 0 ),
                            frame.size() );
+    m_clip = m_bbox;
 }
 
 /****************************/
@@ -40,17 +82,40 @@ Frame_View::Frame_View( Frame&              frame,
                         const math::Rect2i& bbox )
     : m_frame { frame },
       m_bbox { bbox }
-{}
+{
+    m_clip = math::Rect2i::intersection( m_bbox, frame_extent( frame ) );
+}
 
-/****************************************/
-/*          Get Specific Pixel          */
-/****************************************/
-uint8_t& Frame_View::get_pixel( size_t col, size_t row, size_t channel )
+/************************************************/
+/*          Get the clip rectangle              */
+/************************************************/
+math::Rect2i Frame_View::clip() const
 {
-    size_t act_col = col - static_cast<size_t>(m_bbox.bl().x());
-    size_t act_row = row - static_cast<size_t>(m_bbox.bl().y());
+    return math::Rect2i( m_clip.bl().x() - m_bbox.bl().x(),
+                         m_clip.bl().y() - m_bbox.bl().y(),
+                         m_clip.width(),
+                         m_clip.height() );
+}
 
-    return m_frame.get_pixel( act_col, act_row, channel );
+/************************************************/
+/*          Narrow the clip rectangle           */
+/************************************************/
+void Frame_View::push_clip( const math::Rect2i& rect )
+{
+    m_clip_stack.push_back( m_clip );
+    m_clip = math::Rect2i::intersection( m_clip, rect + m_bbox.bl() );
+}
+
+/************************************************/
+/*          Restore the clip rectangle          */
+/************************************************/
+void Frame_View::pop_clip()
+{
+    if( m_clip_stack.empty() ){
+        throw std::runtime_error( "Frame_View::pop_clip() called without a matching push_clip()" );
+    }
+    m_clip = m_clip_stack.back();
+    m_clip_stack.pop_back();
 }
 
 /****************************************/
@@ -58,10 +123,12 @@ uint8_t& Frame_View::get_pixel( size_t col, size_t row, size_t channel )
 /****************************************/
 uint8_t Frame_View::get_pixel( size_t col, size_t row, size_t channel ) const
 {
-    size_t act_col = col - static_cast<size_t>(m_bbox.bl().x());
-    size_t act_row = row - static_cast<size_t>(m_bbox.bl().y());
+    require_visible( *this, col, row );
 
-    return m_frame.get_pixel( act_col, act_row, channel );
+    size_t act_col = col + static_cast<size_t>(m_bbox.bl().x());
+    size_t act_row = row + static_cast<size_t>(m_bbox.bl().y());
+
+    return static_cast<const Frame&>( m_frame ).get_pixel( act_col, act_row, channel );
 }
 
 /****************************************/
@@ -69,8 +136,10 @@ uint8_t Frame_View::get_pixel( size_t col, size_t row, size_t channel ) const
 /****************************************/
 math::Vector4u Frame_View::get_pixel( size_t col, size_t row ) const
 {
-    size_t act_col = col - static_cast<size_t>(m_bbox.bl().x());
-    size_t act_row = row - static_cast<size_t>(m_bbox.bl().y());
+    require_visible( *this, col, row );
+
+    size_t act_col = col + static_cast<size_t>(m_bbox.bl().x());
+    size_t act_row = row + static_cast<size_t>(m_bbox.bl().y());
 
     return m_frame.get_pixel( act_col, act_row );
 }
@@ -80,6 +149,9 @@ math::Vector4u Frame_View::get_pixel( size_t col, size_t row ) const
 /****************************************/
 void Frame_View::set_pixel( size_t col, size_t row, size_t channel, uint8_t value )
 {
+    if( !is_visible( static_cast<int>( col ), static_cast<int>( row ) ) ){
+        return;
+    }
     size_t act_col = col + static_cast<size_t>(m_bbox.bl().x());
     size_t act_row = row + static_cast<size_t>(m_bbox.bl().y());
     m_frame.set_pixel( act_col, act_row, channel, value  );
@@ -90,6 +162,9 @@ void Frame_View::set_pixel( size_t col, size_t row, size_t channel, uint8_t valu
 /****************************************/
 void Frame_View::set_pixel( size_t col, size_t row, math::Vector4u value )
 {
+    if( !is_visible( static_cast<int>( col ), static_cast<int>( row ) ) ){
+        return;
+    }
     size_t act_col = col + static_cast<size_t>(m_bbox.bl().x());
     size_t act_row = row + static_cast<size_t>(m_bbox.bl().y());
     m_frame.set_pixel( act_col, act_row, value  );
@@ -101,18 +176,14 @@ void Frame_View::set_pixel( size_t col, size_t row, math::Vector4u value )
 Frame_View Frame_View::subview( const math::Rect2i& bbox )
 {
     LOG_DEBUG( "This BBOX: " + m_bbox.to_string() + " that bbox: " + bbox.to_string() );
-    // Adjust bottom left corner (Not by actual values, but by DELTA!)
-    auto new_bl = m_bbox.bl();
-    
-    // @todo:  Add some error checking here
-    new_bl += bbox.bl();
 
-    auto new_size = math::Size2i( { bbox.width(), bbox.height() } );
+    // Adjust bottom left corner (Not by actual values, but by DELTA!)
+    Frame_View output( m_frame, bbox + m_bbox.bl() );
 
-    // The new size of the scene
-    auto new_bbox = math::Rect2i( new_bl, new_size );
-    
-    return Frame_View( m_frame, new_bbox );
+    // Never draw outside of the parent
+    output.m_clip    = math::Rect2i::intersection( output.m_clip, m_clip );
+    output.m_opacity = m_opacity;
+    return output;
 }
 
 /**************************************************/
@@ -121,8 +192,7 @@ Frame_View Frame_View::subview( const math::Rect2i& bbox )
 bool Frame_View::copy( const Frame& frame,
                       CopyPolicy   copy_policy )
 {
-    // @todo:  Think about other policies
-    if( copy_policy != CopyPolicy::FLEXIBILE ){
+    if( copy_policy != CopyPolicy::FLEXIBILE && copy_policy != CopyPolicy::BLEND ){
         std::stringstream sout;
         sout << "Unsupported CopyPolicy: " << to_string( copy_policy );
         throw std::runtime_error( sout.str() );
@@ -134,23 +204,17 @@ bool Frame_View::copy( const Frame& frame,
         LOG_DEBUG(sout.str());
     }
 
-    // Copy the image row  by row
-    for( size_t r = 0; r < frame.rows(); r++ )
-    {
-        // Get the destination row
-        size_t dest_row = static_cast<size_t>(m_bbox.bl()[1]) + r;
-
-        // Iterate over each input column
-        for( size_t c = 0; c < frame.cols(); c++ )
-        {
-            // Get the destination column
-            size_t dest_col = static_cast<size_t>(m_bbox.bl()[0]) + c;
-
-            auto pixel = frame.get_pixel( c, r );
-            m_frame.set_pixel( dest_col, dest_row, pixel );
-        }
+    if( frame.dims().size_bytes() == 0 ){
+        return true;
     }
 
+    copy_rows( frame.data(),
+               frame.cols() * frame.channels(),
+               pixel_format_from_channels( frame.channels() ),
+               math::ToPoint2<int>( 0, 0 ),
+               frame.size(),
+               copy_policy,
+               frame.is_premultiplied() );
     return true;    
 }
 
@@ -160,27 +224,30 @@ bool Frame_View::copy( const Frame& frame,
 bool Frame_View::copy( const Frame_View& frame,
                        CopyPolicy        copy_policy )
 {
-    // @todo:  Think about other policies
-    if( copy_policy != CopyPolicy::FLEXIBILE ){
+    if( copy_policy != CopyPolicy::FLEXIBILE && copy_policy != CopyPolicy::BLEND ){
         std::stringstream sout;
         sout << "Unsupported CopyPolicy: " << to_string( copy_policy );
         throw std::runtime_error( sout.str() );
     }
 
-    // Copy the image row  by row
-    for( size_t r = 0; r < static_cast<size_t>(frame.rows()); r++ )
-    {
-        // Iterate over each input column
-        for( size_t c = 0; c < static_cast<size_t>(frame.cols()); c++ )
-        {
-            for( size_t x = 0; x < frame.channels(); x++ )
-            {
-                auto pixel = frame.get_pixel( r, c, x );
-                m_frame.set_pixel( r, c, x, pixel );
-            }
-        }
+    // Only the part of the source inside its own frame can be read
+    const auto& source = frame.frame();
+    auto region = math::Rect2i::intersection( frame.bbox(), frame_extent( source ) );
+    if( is_empty( region ) ){
+        return true;
     }
 
+    const size_t bpp = source.channels();
+    const uint8_t* pixels = source.data() + ( static_cast<size_t>( region.bl().y() ) * source.cols() +
+                                              static_cast<size_t>( region.bl().x() ) ) * bpp;
+    copy_rows( pixels,
+               source.cols() * bpp,
+               pixel_format_from_channels( bpp ),
+               math::ToPoint2<int>( region.bl().x() - frame.bbox().bl().x(),
+                                    region.bl().y() - frame.bbox().bl().y() ),
+               math::Size2i( { region.width(), region.height() } ),
+               copy_policy,
+               source.is_premultiplied() );
     return true;    
 }
 
@@ -196,7 +263,81 @@ std::string Frame_View::to_log_string( size_t offset ) const
     sout << gap << "  - Frame Information: " << std::endl;
     sout << m_frame.to_log_string( offset + 4 );
     sout << gap << "  - Bounding Box: " << m_bbox.to_string() << std::endl;
+    sout << gap << "  - Clip: " << m_clip.to_string() << std::endl;
+    sout << gap << "  - Opacity: " << static_cast<int>( m_opacity ) << std::endl;
     return sout.str();
 }
 
+/************************************************/
+/*          Copy clipped rows of pixels         */
+/************************************************/
+void Frame_View::copy_rows( const uint8_t*       pixels,
+                            size_t               stride,
+                            PixelFormat          format,
+                            const math::Point2i& dest_bl,
+                            const math::Size2i&  size,
+                            CopyPolicy           policy,
+                            bool                 premultiplied )
+{
+    // Clip once for the whole copy
+    const math::Rect2i dest( m_bbox.bl().x() + dest_bl.x(),
+                             m_bbox.bl().y() + dest_bl.y(),
+                             size.width(),
+                             size.height() );
+    const auto region = math::Rect2i::intersection( dest, m_clip );
+    if( is_empty( region ) ){
+        return;
+    }
+
+    // Every remaining row is in bounds, so copy without per-pixel checks
+    const size_t skip_cols  = static_cast<size_t>( region.bl().x() - dest.bl().x() );
+    const size_t skip_rows  = static_cast<size_t>( region.bl().y() - dest.bl().y() );
+    const size_t cols       = static_cast<size_t>( region.width() );
+    const size_t rows       = static_cast<size_t>( region.height() );
+    const size_t dest_bpp   = m_frame.channels();
+    const size_t dest_cols  = m_frame.cols();
+
+    const uint8_t* input = pixels + skip_rows * stride + skip_cols * bytes_per_pixel( format );
+    uint8_t* output = m_frame.data() + ( static_cast<size_t>( region.bl().y() ) * dest_cols +
+                                         static_cast<size_t>( region.bl().x() ) ) * dest_bpp;
+    if( policy != CopyPolicy::BLEND ){
+        convert( input,  stride, format,
+                 output, dest_cols * dest_bpp, pixel_format_from_channels( dest_bpp ),
+                 cols, rows );
+        return;
+    }
+
+    if( dest_bpp != 4 ){
+        std::stringstream sout;
+        sout << "Blending requires a 4 channel frame, got " << dest_bpp;
+        throw std::runtime_error( sout.str() );
+    }
+    if( m_opacity == 0 ){
+        return;
+    }
+
+    // Premultiplied RGBA composites straight from the source
+    if( format == PixelFormat::RGBA && premultiplied ){
+        for( size_t row = 0; row < rows; row++ ){
+            composite_row( output + row * dest_cols * 4, input + row * stride, cols, m_opacity );
+        }
+        return;
+    }
+
+    // Anything else is converted a chunk at a time first
+    const size_t src_bpp = bytes_per_pixel( format );
+    std::array<uint8_t,BLEND_CHUNK_PIXELS * 4> chunk;
+    for( size_t row = 0; row < rows; row++ ){
+        for( size_t start = 0; start < cols; start += BLEND_CHUNK_PIXELS ){
+            const size_t run = std::min( BLEND_CHUNK_PIXELS, cols - start );
+            convert_row( input + row * stride + start * src_bpp, format,
+                         chunk.data(), PixelFormat::RGBA, run );
+            if( !premultiplied ){
+                premultiply_alpha( chunk.data(), run );
+            }
+            composite_row( output + ( row * dest_cols + start ) * 4, chunk.data(), run, m_opacity );
+        }
+    }
+}
+
 } // End of tmns::img namespace
\ No newline at end of file
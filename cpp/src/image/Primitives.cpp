@@ -16,6 +16,10 @@
  */
 #include <terminus/image/Primitives.hpp>
 
+// C++ Standard Libraries
+#include <sstream>
+#include <stdexcept>
+
 namespace tmns::img {
 
 /********************************/
@@ -26,11 +30,87 @@ std::string to_string( CopyPolicy policy )
     switch( policy ){
         case CopyPolicy::FLEXIBILE:
             return "FLEXIBLE";
+        case CopyPolicy::BLEND:
+            return "BLEND";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/********************************/
+/*      Convert to String       */
+/********************************/
+std::string to_string( PixelFormat format )
+{
+    switch( format ){
+        case PixelFormat::GRAY:
+            return "GRAY";
+        case PixelFormat::GRAY_ALPHA:
+            return "GRAY_ALPHA";
+        case PixelFormat::RGB:
+            return "RGB";
+        case PixelFormat::RGBA:
+            return "RGBA";
+        case PixelFormat::BGR:
+            return "BGR";
+        case PixelFormat::BGRA:
+            return "BGRA";
+        case PixelFormat::RGB565:
+            return "RGB565";
         default:
             return "UNKNOWN";
     }
 }
 
+/****************************************/
+/*      Get the bytes per pixel         */
+/****************************************/
+size_t bytes_per_pixel( PixelFormat format )
+{
+    switch( format ){
+        case PixelFormat::GRAY:
+            return 1;
+        case PixelFormat::GRAY_ALPHA:
+        case PixelFormat::RGB565:
+            return 2;
+        case PixelFormat::RGB:
+        case PixelFormat::BGR:
+            return 3;
+        case PixelFormat::RGBA:
+        case PixelFormat::BGRA:
+            return 4;
+        default:
+        {
+            std::stringstream sout;
+            sout << "Unsupported pixel format: " << static_cast<int>( format );
+            throw std::runtime_error( sout.str() );
+        }
+    }
+}
+
+/************************************************/
+/*      Get the pixel format from channels      */
+/************************************************/
+PixelFormat pixel_format_from_channels( size_t channels )
+{
+    switch( channels ){
+        case 1:
+            return PixelFormat::GRAY;
+        case 2:
+            return PixelFormat::GRAY_ALPHA;
+        case 3:
+            return PixelFormat::RGB;
+        case 4:
+            return PixelFormat::RGBA;
+        default:
+        {
+            std::stringstream sout;
+            sout << "No pixel format has " << channels << " channels";
+            throw std::runtime_error( sout.str() );
+        }
+    }
+}
+
 /********************************/
 /*          Constructor         */
 /********************************/
@@ -0,0 +1,935 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Raster.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details 2D rasterization primitives.
+ */
+#include <terminus/image/Raster.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <sstream>
+#include <stdexcept>
+
+// Project Libraries
+#include <terminus/image/Composite.hpp>
+
+namespace tmns::img {
+
+namespace {
+
+/// Coordinates are clamped to this before converting to int
+constexpr double COORD_LIMIT { 1.0e9 };
+
+/************************************************/
+/*          Convert a coordinate to int         */
+/************************************************/
+inline int to_int( double value )
+{
+    return static_cast<int>( std::clamp( value, -COORD_LIMIT, COORD_LIMIT ) );
+}
+
+/********************************************************/
+/*          Blend a straight RGBA color over a pixel    */
+/********************************************************/
+inline void blend( uint8_t* px, const std::array<uint8_t,4>& color, unsigned alpha )
+{
+    const unsigned inverse = 255u - alpha;
+    px[0] = static_cast<uint8_t>( ( color[0] * alpha + px[0] * inverse + 127u ) / 255u );
+    px[1] = static_cast<uint8_t>( ( color[1] * alpha + px[1] * inverse + 127u ) / 255u );
+    px[2] = static_cast<uint8_t>( ( color[2] * alpha + px[2] * inverse + 127u ) / 255u );
+    px[3] = static_cast<uint8_t>( alpha + ( px[3] * inverse + 127u ) / 255u );
+}
+
+/************************************************************/
+/*          Walk one octant of a midpoint circle            */
+/************************************************************/
+template <typename FuncT>
+void walk_circle( int radius, FuncT&& func )
+{
+    int x = 0;
+    int y = radius;
+    int d = 1 - radius;
+    while( x <= y ){
+        func( x, y );
+        if( d < 0 ){
+            d += 2 * x + 3;
+        }
+        else {
+            d += 2 * ( x - y ) + 5;
+            y--;
+        }
+        x++;
+    }
+}
+
+/************************************************************/
+/*          Walk one quadrant of a midpoint ellipse         */
+/*                                                          */
+/*  Decision variables are scaled by 4 to stay integral.    */
+/************************************************************/
+template <typename FuncT>
+void walk_ellipse( int radius_x, int radius_y, FuncT&& func )
+{
+    const int64_t rx2 = static_cast<int64_t>( radius_x ) * radius_x;
+    const int64_t ry2 = static_cast<int64_t>( radius_y ) * radius_y;
+
+    int64_t x  = 0;
+    int64_t y  = radius_y;
+    int64_t px = 0;
+    int64_t py = 2 * rx2 * y;
+
+    // Region 1, where the slope is shallower than -1
+    int64_t p = 4 * ry2 - 4 * rx2 * radius_y + rx2;
+    while( px < py ){
+        func( static_cast<int>( x ), static_cast<int>( y ) );
+        x++;
+        px += 2 * ry2;
+        if( p < 0 ){
+            p += 4 * ( ry2 + px );
+        }
+        else {
+            y--;
+            py -= 2 * rx2;
+            p += 4 * ( ry2 + px - py );
+        }
+    }
+
+    // Region 2, one step per row
+    p = ry2 * ( 4 * x * x + 4 * x + 1 ) + 4 * rx2 * ( y - 1 ) * ( y - 1 ) - 4 * rx2 * ry2;
+    while( y >= 0 ){
+        func( static_cast<int>( x ), static_cast<int>( y ) );
+        y--;
+        py -= 2 * rx2;
+        if( p > 0 ){
+            p += 4 * ( rx2 - py );
+        }
+        else {
+            x++;
+            px += 2 * ry2;
+            p += 4 * ( rx2 - py + px );
+        }
+    }
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*      Convert to String       */
+/********************************/
+std::string to_string( LineJoin join )
+{
+    switch( join ){
+        case LineJoin::MITER:
+            return "MITER";
+        case LineJoin::ROUND:
+            return "ROUND";
+        case LineJoin::BEVEL:
+            return "BEVEL";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/****************************/
+/*      Constructor         */
+/****************************/
+Raster::Raster( Frame_View view )
+    : m_view { view }
+{
+    auto& frame = m_view.frame();
+    if( frame.channels() != 4 && frame.dims().size_bytes() > 0 ){
+        std::stringstream sout;
+        sout << "Raster requires a 4 channel frame, got " << frame.channels();
+        throw std::runtime_error( sout.str() );
+    }
+
+    // The view's clip already excludes anything outside the frame
+    const auto clip = m_view.clip();
+    m_offset_x = m_view.bbox().bl().x();
+    m_offset_y = m_view.bbox().bl().y();
+    m_clip_x0  = clip.bl().x();
+    m_clip_y0  = clip.bl().y();
+    m_clip_x1  = clip.bl().x() + clip.width();
+    m_clip_y1  = clip.bl().y() + clip.height();
+    m_opacity  = m_view.opacity();
+}
+
+/****************************/
+/*      Constructor         */
+/****************************/
+Raster::Raster( Frame& frame )
+    : Raster( Frame_View( frame ) )
+{}
+
+/************************************/
+/*          Get the clip box        */
+/************************************/
+math::Rect2i Raster::clip_box() const
+{
+    return math::Rect2i( m_clip_x0,
+                         m_clip_y0,
+                         std::max( 0, m_clip_x1 - m_clip_x0 ),
+                         std::max( 0, m_clip_y1 - m_clip_y0 ) );
+}
+
+/****************************************/
+/*          Fill the drawable area      */
+/****************************************/
+void Raster::fill( const Color& color )
+{
+    const Pixel pixel = unpack( color );
+    for( int y = m_clip_y0; y < m_clip_y1; y++ ){
+        blend_span( m_clip_x0, m_clip_x1, y, pixel );
+    }
+}
+
+/************************************/
+/*          Fill a rectangle        */
+/************************************/
+void Raster::fill_rect( const math::Rect2i& rect,
+                        const Color&        color )
+{
+    const Pixel pixel = unpack( color );
+    const int y0 = std::max( rect.bl().y(), m_clip_y0 );
+    const int y1 = std::min( rect.bl().y() + rect.height(), m_clip_y1 );
+    for( int y = y0; y < y1; y++ ){
+        blend_span( rect.bl().x(), rect.bl().x() + rect.width(), y, pixel );
+    }
+}
+
+/****************************************/
+/*          Draw a horizontal line      */
+/****************************************/
+void Raster::draw_hline( int          x0,
+                         int          x1,
+                         int          y,
+                         const Color& color )
+{
+    const Pixel pixel = unpack( color );
+    blend_span( std::min( x0, x1 ), std::max( x0, x1 ) + 1, y, pixel );
+}
+
+/****************************************/
+/*          Draw a vertical line        */
+/****************************************/
+void Raster::draw_vline( int          x,
+                         int          y0,
+                         int          y1,
+                         const Color& color )
+{
+    if( x < m_clip_x0 || x >= m_clip_x1 ){
+        return;
+    }
+    const int top    = std::max( std::min( y0, y1 ), m_clip_y0 );
+    const int bottom = std::min( std::max( y0, y1 ) + 1, m_clip_y1 );
+    if( top >= bottom ){
+        return;
+    }
+
+    const Pixel pixel = unpack( color );
+    const size_t stride = m_view.frame().cols() * 4;
+    uint8_t* px = pixel_ptr( x, top );
+    for( int y = top; y < bottom; y++, px += stride ){
+        if( pixel[3] == 255 ){
+            std::memcpy( px, pixel.data(), 4 );
+        }
+        else {
+            blend( px, pixel, pixel[3] );
+        }
+    }
+}
+
+/****************************************/
+/*          Draw a Bresenham line       */
+/****************************************/
+void Raster::draw_line( const math::Point2i& p0,
+                        const math::Point2i& p1,
+                        const Color&         color )
+{
+    const Pixel pixel = unpack( color );
+    bresenham( p0, p1, pixel, false, false );
+}
+
+/********************************************/
+/*          Draw a Wu antialiased line      */
+/********************************************/
+void Raster::draw_line_aa( const math::Point2d& p0,
+                           const math::Point2d& p1,
+                           const Color&         color )
+{
+    double x0 = p0.x(), y0 = p0.y();
+    double x1 = p1.x(), y1 = p1.y();
+    if( !clip_segment( x0, y0, x1, y1, 1.5 ) ){
+        return;
+    }
+
+    const Pixel pixel = unpack( color );
+    const bool steep = std::abs( y1 - y0 ) > std::abs( x1 - x0 );
+    if( steep ){
+        std::swap( x0, y0 );
+        std::swap( x1, y1 );
+    }
+    if( x0 > x1 ){
+        std::swap( x0, x1 );
+        std::swap( y0, y1 );
+    }
+
+    auto plot = [&]( int x, int y, double coverage ){
+        const auto value = static_cast<uint8_t>( std::lround( std::clamp( coverage, 0.0, 1.0 ) * 255.0 ) );
+        if( steep ){
+            blend_pixel( y, x, pixel, value );
+        }
+        else {
+            blend_pixel( x, y, pixel, value );
+        }
+    };
+    auto fpart  = []( double v ){ return v - std::floor( v ); };
+    auto rfpart = [&]( double v ){ return 1.0 - fpart( v ); };
+
+    const double dx = x1 - x0;
+    const double gradient = ( dx == 0.0 ) ? 1.0 : ( y1 - y0 ) / dx;
+
+    // First endpoint
+    double x_end  = std::floor( x0 + 0.5 );
+    double y_end  = y0 + gradient * ( x_end - x0 );
+    double x_gap  = rfpart( x0 + 0.5 );
+    const int x_first = static_cast<int>( x_end );
+    const int y_first = static_cast<int>( std::floor( y_end ) );
+    plot( x_first, y_first,     rfpart( y_end ) * x_gap );
+    plot( x_first, y_first + 1, fpart( y_end )  * x_gap );
+    double inter_y = y_end + gradient;
+
+    // Second endpoint
+    x_end = std::floor( x1 + 0.5 );
+    y_end = y1 + gradient * ( x_end - x1 );
+    x_gap = fpart( x1 + 0.5 );
+    const int x_last = static_cast<int>( x_end );
+    const int y_last = static_cast<int>( std::floor( y_end ) );
+    if( x_last != x_first ){
+        plot( x_last, y_last,     rfpart( y_end ) * x_gap );
+        plot( x_last, y_last + 1, fpart( y_end )  * x_gap );
+    }
+
+    // Main span, two pixels per step
+    for( int x = x_first + 1; x < x_last; x++ ){
+        const int y = static_cast<int>( std::floor( inter_y ) );
+        plot( x, y,     rfpart( inter_y ) );
+        plot( x, y + 1, fpart( inter_y ) );
+        inter_y += gradient;
+    }
+}
+
+/****************************************/
+/*          Draw a thick line           */
+/****************************************/
+void Raster::draw_thick_line( const math::Point2d& p0,
+                              const math::Point2d& p1,
+                              double               width,
+                              const Color&         color )
+{
+    draw_polyline( { p0, p1 }, width, color, LineJoin::BEVEL, false );
+}
+
+/****************************************/
+/*          Draw a polyline             */
+/****************************************/
+void Raster::draw_polyline( const std::vector<math::Point2d>& points,
+                            double                            width,
+                            const Color&                      color,
+                            LineJoin                          join,
+                            bool                              closed )
+{
+    const Pixel pixel = unpack( color );
+
+    // Drop repeated points, which have no direction
+    std::vector<Vertex> pts;
+    pts.reserve( points.size() );
+    for( const auto& point : points ){
+        if( pts.empty() || pts.back().x != point.x() || pts.back().y != point.y() ){
+            pts.push_back( { point.x(), point.y() } );
+        }
+    }
+    if( closed && pts.size() > 2 && pts.front().x == pts.back().x && pts.front().y == pts.back().y ){
+        pts.pop_back();
+    }
+    if( pts.size() < 2 ){
+        return;
+    }
+    const size_t segments = ( closed && pts.size() > 2 ) ? pts.size() : pts.size() - 1;
+
+    // Thin lines
+    if( width <= 1.0 ){
+        auto to_point = []( const Vertex& v ){
+            return math::ToPoint2<int>( static_cast<int>( std::lround( v.x ) ),
+                                        static_cast<int>( std::lround( v.y ) ) );
+        };
+        for( size_t i = 0; i < segments; i++ ){
+            // Shared vertices belong to the segment that reaches them first
+            const bool closing = closed && segments > 1 && ( i + 1 == segments );
+            bresenham( to_point( pts[i] ), to_point( pts[( i + 1 ) % pts.size()] ), pixel, i > 0, closing );
+        }
+        return;
+    }
+
+    // Segment directions
+    const double half_width = width / 2.0;
+    std::vector<Vertex> directions( segments );
+    for( size_t i = 0; i < segments; i++ ){
+        const auto& a = pts[i];
+        const auto& b = pts[( i + 1 ) % pts.size()];
+        const double length = std::hypot( b.x - a.x, b.y - a.y );
+        directions[i] = { ( b.x - a.x ) / length, ( b.y - a.y ) / length };
+    }
+
+    // One quad per segment
+    std::vector<Edge> edges;
+    for( size_t i = 0; i < segments; i++ ){
+        const auto& a = pts[i];
+        const auto& b = pts[( i + 1 ) % pts.size()];
+        const Vertex n { -directions[i].y * half_width, directions[i].x * half_width };
+        add_edges( edges, { { a.x + n.x, a.y + n.y },
+                            { b.x + n.x, b.y + n.y },
+                            { b.x - n.x, b.y - n.y },
+                            { a.x - n.x, a.y - n.y } }, true );
+    }
+
+    // Joins on the outside of each interior vertex
+    for( size_t j = closed ? 0 : 1; j < segments; j++ ){
+        const auto& p  = pts[j];
+        const auto& d0 = directions[( j + segments - 1 ) % segments];
+        const auto& d1 = directions[j % segments];
+        const double cross = d0.x * d1.y - d0.y * d1.x;
+        const double dot   = d0.x * d1.x + d0.y * d1.y;
+        if( std::abs( cross ) < 1e-9 && dot > 0 ){
+            continue;
+        }
+
+        // The second segment turns toward one side, so the gap opens on the other
+        const double side = ( cross > 0 ) ? -1.0 : 1.0;
+        const Vertex n0 { -d0.y * half_width * side, d0.x * half_width * side };
+        const Vertex n1 { -d1.y * half_width * side, d1.x * half_width * side };
+
+        if( join == LineJoin::ROUND ){
+            const int steps = std::max( 8, static_cast<int>( std::ceil( half_width * 4 ) ) );
+            std::vector<Vertex> circle( static_cast<size_t>( steps ) );
+            for( int k = 0; k < steps; k++ ){
+                const double angle = 2.0 * std::numbers::pi * k / steps;
+                circle[static_cast<size_t>( k )] = { p.x + half_width * std::cos( angle ),
+                                                     p.y + half_width * std::sin( angle ) };
+            }
+            add_edges( edges, circle, true );
+            continue;
+        }
+
+        if( join == LineJoin::MITER ){
+            const double mx = n0.x + n1.x;
+            const double my = n0.y + n1.y;
+            const double length = std::hypot( mx, my );
+            const double cos_half = ( length / 2.0 ) / half_width;
+            if( length > 0 && cos_half > 1.0 / MITER_LIMIT ){
+                const double miter = half_width / cos_half;
+                add_edges( edges, { { p.x, p.y },
+                                    { p.x + n0.x, p.y + n0.y },
+                                    { p.x + mx / length * miter, p.y + my / length * miter },
+                                    { p.x + n1.x, p.y + n1.y } }, true );
+                continue;
+            }
+        }
+
+        add_edges( edges, { { p.x, p.y },
+                            { p.x + n0.x, p.y + n0.y },
+                            { p.x + n1.x, p.y + n1.y } }, true );
+    }
+
+    fill_edges( edges, pixel, FillRule::NON_ZERO );
+}
+
+/****************************************/
+/*          Draw a circle outline       */
+/****************************************/
+void Raster::draw_circle( const math::Point2i& center,
+                          int                  radius,
+                          const Color&         color )
+{
+    const int cx = center.x();
+    const int cy = center.y();
+    if( radius < 0 ||
+        cx + radius < m_clip_x0 || cx - radius >= m_clip_x1 ||
+        cy + radius < m_clip_y0 || cy - radius >= m_clip_y1 ){
+        return;
+    }
+
+    const Pixel pixel = unpack( color );
+    walk_circle( radius, [&]( int x, int y ){
+        plot_symmetric( cx, cy, x, y, pixel );
+        if( x != y ){
+            plot_symmetric( cx, cy, y, x, pixel );
+        }
+    });
+}
+
+/****************************************/
+/*          Fill a circle               */
+/****************************************/
+void Raster::fill_circle( const math::Point2i& center,
+                          int                  radius,
+                          const Color&         color )
+{
+    if( radius < 0 ){
+        return;
+    }
+
+    // Widest span on each row, taken from the same points as the outline
+    std::vector<int> half_widths( static_cast<size_t>( radius ) + 1, 0 );
+    walk_circle( radius, [&]( int x, int y ){
+        auto& row_y = half_widths[static_cast<size_t>( y )];
+        auto& row_x = half_widths[static_cast<size_t>( x )];
+        row_y = std::max( row_y, x );
+        row_x = std::max( row_x, y );
+    });
+
+    const Pixel pixel = unpack( color );
+    fill_rows( center.x(), center.y(), half_widths, pixel );
+}
+
+/****************************************/
+/*          Draw an ellipse outline     */
+/****************************************/
+void Raster::draw_ellipse( const math::Point2i& center,
+                           int                  radius_x,
+                           int                  radius_y,
+                           const Color&         color )
+{
+    const int cx = center.x();
+    const int cy = center.y();
+    if( radius_x < 0 || radius_y < 0 ||
+        cx + radius_x < m_clip_x0 || cx - radius_x >= m_clip_x1 ||
+        cy + radius_y < m_clip_y0 || cy - radius_y >= m_clip_y1 ){
+        return;
+    }
+    if( radius_y == 0 ){
+        draw_hline( cx - radius_x, cx + radius_x, cy, color );
+        return;
+    }
+
+    const Pixel pixel = unpack( color );
+    walk_ellipse( radius_x, radius_y, [&]( int x, int y ){
+        plot_symmetric( cx, cy, x, y, pixel );
+    });
+}
+
+/****************************************/
+/*          Fill an ellipse             */
+/****************************************/
+void Raster::fill_ellipse( const math::Point2i& center,
+                           int                  radius_x,
+                           int                  radius_y,
+                           const Color&         color )
+{
+    if( radius_x < 0 || radius_y < 0 ){
+        return;
+    }
+
+    std::vector<int> half_widths( static_cast<size_t>( radius_y ) + 1, 0 );
+    if( radius_y == 0 ){
+        half_widths[0] = radius_x;
+    }
+    else {
+        walk_ellipse( radius_x, radius_y, [&]( int x, int y ){
+            auto& row = half_widths[static_cast<size_t>( y )];
+            row = std::max( row, x );
+        });
+    }
+
+    const Pixel pixel = unpack( color );
+    fill_rows( center.x(), center.y(), half_widths, pixel );
+}
+
+/****************************************/
+/*          Fill a polygon              */
+/****************************************/
+void Raster::fill_polygon( const std::vector<math::Point2d>& points,
+                           const Color&                      color )
+{
+    if( points.size() < 3 ){
+        return;
+    }
+
+    std::vector<Vertex> vertices;
+    vertices.reserve( points.size() );
+    for( const auto& point : points ){
+        vertices.push_back( { point.x(), point.y() } );
+    }
+
+    std::vector<Edge> edges;
+    add_edges( edges, vertices, false );
+
+    const Pixel pixel = unpack( color );
+    fill_edges( edges, pixel, FillRule::EVEN_ODD );
+}
+
+/************************************************/
+/*          Print Log-Friendly String           */
+/************************************************/
+std::string Raster::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+
+    std::stringstream sout;
+    sout << gap << "Raster:" << std::endl;
+    sout << gap << "  - Clip Box: " << clip_box().to_string() << std::endl;
+    sout << m_view.to_log_string( offset + 4 );
+    return sout.str();
+}
+
+/************************************/
+/*          Unpack a color          */
+/************************************/
+Raster::Pixel Raster::unpack( const Color& color ) const
+{
+    return { color[0], color[1], color[2], multiply_255( color[3], m_opacity ) };
+}
+
+/************************************/
+/*          Get a pixel pointer     */
+/************************************/
+uint8_t* Raster::pixel_ptr( int x, int y )
+{
+    auto& frame = m_view.frame();
+    const size_t col = static_cast<size_t>( x + m_offset_x );
+    const size_t row = static_cast<size_t>( y + m_offset_y );
+    return frame.data() + ( row * frame.cols() + col ) * 4;
+}
+
+/************************************/
+/*          Blend a span            */
+/************************************/
+void Raster::blend_span( int          x0,
+                         int          x1,
+                         int          y,
+                         const Pixel& color )
+{
+    if( y < m_clip_y0 || y >= m_clip_y1 || color[3] == 0 ){
+        return;
+    }
+    x0 = std::max( x0, m_clip_x0 );
+    x1 = std::min( x1, m_clip_x1 );
+    if( x0 >= x1 ){
+        return;
+    }
+
+    uint8_t* px = pixel_ptr( x0, y );
+    uint8_t* const end = px + static_cast<size_t>( x1 - x0 ) * 4;
+    if( color[3] == 255 ){
+        for( ; px != end; px += 4 ){
+            std::memcpy( px, color.data(), 4 );
+        }
+    }
+    else {
+        for( ; px != end; px += 4 ){
+            blend( px, color, color[3] );
+        }
+    }
+}
+
+/************************************/
+/*          Blend a pixel           */
+/************************************/
+void Raster::blend_pixel( int          x,
+                          int          y,
+                          const Pixel& color,
+                          uint8_t      coverage )
+{
+    if( x < m_clip_x0 || x >= m_clip_x1 || y < m_clip_y0 || y >= m_clip_y1 ){
+        return;
+    }
+
+    const unsigned alpha = ( color[3] * static_cast<unsigned>( coverage ) + 127u ) / 255u;
+    if( alpha == 0 ){
+        return;
+    }
+
+    uint8_t* px = pixel_ptr( x, y );
+    if( alpha == 255 ){
+        std::memcpy( px, color.data(), 4 );
+    }
+    else {
+        blend( px, color, alpha );
+    }
+}
+
+/****************************************/
+/*          Plot mirrored points        */
+/****************************************/
+void Raster::plot_symmetric( int          cx,
+                             int          cy,
+                             int          dx,
+                             int          dy,
+                             const Pixel& color )
+{
+    blend_pixel( cx + dx, cy + dy, color );
+    if( dx != 0 ){
+        blend_pixel( cx - dx, cy + dy, color );
+    }
+    if( dy != 0 ){
+        blend_pixel( cx + dx, cy - dy, color );
+        if( dx != 0 ){
+            blend_pixel( cx - dx, cy - dy, color );
+        }
+    }
+}
+
+/****************************************/
+/*          Bresenham's algorithm       */
+/****************************************/
+void Raster::bresenham( const math::Point2i& p0,
+                        const math::Point2i& p1,
+                        const Pixel&         color,
+                        bool                 skip_first,
+                        bool                 skip_last )
+{
+    // Clip first, so off-screen segments cost nothing
+    double fx0 = p0.x(), fy0 = p0.y();
+    double fx1 = p1.x(), fy1 = p1.y();
+    if( !clip_segment( fx0, fy0, fx1, fy1, 0.5 ) ){
+        return;
+    }
+    int x0 = to_int( std::round( fx0 ) );
+    int y0 = to_int( std::round( fy0 ) );
+    const int x1 = to_int( std::round( fx1 ) );
+    const int y1 = to_int( std::round( fy1 ) );
+
+    // End pixels are only shared if clipping left them in place
+    skip_first = skip_first && x0 == p0.x() && y0 == p0.y();
+    skip_last  = skip_last  && x1 == p1.x() && y1 == p1.y();
+    if( x0 == x1 && y0 == y1 && ( skip_first || skip_last ) ){
+        return;
+    }
+
+    // Horizontal runs are spans
+    if( y0 == y1 ){
+        const int step  = ( x1 >= x0 ) ? 1 : -1;
+        const int start = skip_first ? x0 + step : x0;
+        const int end   = skip_last  ? x1 - step : x1;
+        blend_span( std::min( start, end ), std::max( start, end ) + 1, y0, color );
+        return;
+    }
+
+    const int dx =  std::abs( x1 - x0 );
+    const int dy = -std::abs( y1 - y0 );
+    const int sx = ( x0 < x1 ) ? 1 : -1;
+    const int sy = ( y0 < y1 ) ? 1 : -1;
+    int err = dx + dy;
+    while( true ){
+        const bool at_end = ( x0 == x1 && y0 == y1 );
+        if( !skip_first && !( at_end && skip_last ) ){
+            blend_pixel( x0, y0, color );
+        }
+        skip_first = false;
+        if( at_end ){
+            break;
+        }
+        const int e2 = 2 * err;
+        if( e2 >= dy ){
+            err += dy;
+            x0 += sx;
+        }
+        if( e2 <= dx ){
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/********************************************/
+/*          Append polygon edges            */
+/********************************************/
+void Raster::add_edges( std::vector<Edge>&         edges,
+                        const std::vector<Vertex>& points,
+                        bool                       orient )
+{
+    // Signed area tells us which way the points wind
+    double area = 0;
+    for( size_t i = 0; i < points.size(); i++ ){
+        const auto& a = points[i];
+        const auto& b = points[( i + 1 ) % points.size()];
+        area += a.x * b.y - b.x * a.y;
+    }
+    const bool reverse = orient && area < 0;
+
+    for( size_t i = 0; i < points.size(); i++ ){
+        auto a = points[i];
+        auto b = points[( i + 1 ) % points.size()];
+        if( reverse ){
+            std::swap( a, b );
+        }
+        if( a.y == b.y ){
+            continue;
+        }
+
+        const int winding = ( a.y < b.y ) ? 1 : -1;
+        if( a.y > b.y ){
+            std::swap( a, b );
+        }
+        edges.push_back( { a.y, b.y, a.x, ( b.x - a.x ) / ( b.y - a.y ), winding } );
+    }
+}
+
+/********************************************/
+/*          Scanline polygon fill           */
+/********************************************/
+void Raster::fill_edges( std::vector<Edge>& edges,
+                         const Pixel&       color,
+                         FillRule           rule )
+{
+    if( edges.empty() ){
+        return;
+    }
+    std::sort( edges.begin(), edges.end(), []( const Edge& a, const Edge& b ){
+        return a.y_top < b.y_top;
+    });
+
+    // Rows are sampled at pixel centers, and an edge covers [y_top, y_bottom)
+    double y_max = edges.front().y_bottom;
+    for( const auto& edge : edges ){
+        y_max = std::max( y_max, edge.y_bottom );
+    }
+    const int y_start = std::max( m_clip_y0, to_int( std::ceil( edges.front().y_top ) ) );
+    const int y_end   = std::min( m_clip_y1, to_int( std::ceil( y_max ) ) );
+
+    std::vector<size_t> active;
+    std::vector<std::pair<double,int>> crossings;
+    size_t next = 0;
+    for( int y = y_start; y < y_end; y++ ){
+        const double row = y;
+        while( next < edges.size() && edges[next].y_top <= row ){
+            active.push_back( next++ );
+        }
+        std::erase_if( active, [&]( size_t index ){ return edges[index].y_bottom <= row; } );
+
+        crossings.clear();
+        for( const auto index : active ){
+            const auto& edge = edges[index];
+            crossings.emplace_back( edge.x_top + ( row - edge.y_top ) * edge.slope, edge.winding );
+        }
+        std::sort( crossings.begin(), crossings.end() );
+
+        // Pixels whose centers fall in [left, right)
+        auto span = [&]( double left, double right ){
+            blend_span( to_int( std::ceil( left ) ), to_int( std::ceil( right ) ), y, color );
+        };
+
+        if( rule == FillRule::EVEN_ODD ){
+            for( size_t i = 0; i + 1 < crossings.size(); i += 2 ){
+                span( crossings[i].first, crossings[i+1].first );
+            }
+        }
+        else {
+            int winding = 0;
+            double left = 0;
+            for( const auto& [x, direction] : crossings ){
+                const int previous = winding;
+                winding += direction;
+                if( previous == 0 && winding != 0 ){
+                    left = x;
+                }
+                else if( previous != 0 && winding == 0 ){
+                    span( left, x );
+                }
+            }
+        }
+    }
+}
+
+/********************************************/
+/*          Fill symmetric rows             */
+/********************************************/
+void Raster::fill_rows( int                     cx,
+                        int                     cy,
+                        const std::vector<int>& half_widths,
+                        const Pixel&            color )
+{
+    for( size_t i = 0; i < half_widths.size(); i++ ){
+        const int dy = static_cast<int>( i );
+        const int half = half_widths[i];
+        blend_span( cx - half, cx + half + 1, cy + dy, color );
+        if( dy != 0 ){
+            blend_span( cx - half, cx + half + 1, cy - dy, color );
+        }
+    }
+}
+
+/************************************************/
+/*          Liang-Barsky segment clipping       */
+/************************************************/
+bool Raster::clip_segment( double& x0,
+                           double& y0,
+                           double& x1,
+                           double& y1,
+                           double  margin ) const
+{
+    const double x_min = m_clip_x0 - margin;
+    const double y_min = m_clip_y0 - margin;
+    const double x_max = m_clip_x1 - 1 + margin;
+    const double y_max = m_clip_y1 - 1 + margin;
+    if( x_min > x_max || y_min > y_max ){
+        return false;
+    }
+
+    const double dx = x1 - x0;
+    const double dy = y1 - y0;
+    double t0 = 0;
+    double t1 = 1;
+    auto clip = [&]( double p, double q ){
+        if( p == 0 ){
+            return q >= 0;
+        }
+        const double r = q / p;
+        if( p < 0 ){
+            if( r > t1 ){
+                return false;
+            }
+            t0 = std::max( t0, r );
+        }
+        else {
+            if( r < t0 ){
+                return false;
+            }
+            t1 = std::min( t1, r );
+        }
+        return true;
+    };
+
+    if( !clip( -dx, x0 - x_min ) || !clip( dx, x_max - x0 ) ||
+        !clip( -dy, y0 - y_min ) || !clip( dy, y_max - y0 ) ){
+        return false;
+    }
+
+    const double start_x = x0;
+    const double start_y = y0;
+    if( t1 < 1 ){
+        x1 = start_x + t1 * dx;
+        y1 = start_y + t1 * dy;
+    }
+    if( t0 > 0 ){
+        x0 = start_x + t0 * dx;
+        y0 = start_y + t0 * dy;
+    }
+    return true;
+}
+
+} // End of tmns::img namespace
@@ -0,0 +1,106 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_CachedWidget.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details CachedWidget Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/layout/LayoutGrid.hpp>
+#include <terminus/gui/layout/LayoutVertical.hpp>
+#include <terminus/gui/widget/CachedWidget.hpp>
+#include <terminus/gui/widget/Label.hpp>
+#include <terminus/gui/widget/Tile.hpp>
+#include <terminus/gui/widget/WidgetLayout.hpp>
+#include <terminus/image/Pixels.hpp>
+
+using namespace tmns;
+
+namespace {
+
+/// Cache which counts the invalidations reaching it
+class Counting_Cache : public gui::CachedWidget
+{
+    public:
+
+        using gui::CachedWidget::CachedWidget;
+
+        mutable size_t invalidations { 0 };
+
+    protected:
+
+        void render_invalidated() const override {
+            invalidations++;
+            gui::CachedWidget::render_invalidated();
+        }
+
+}; // End of Counting_Cache class
+
+} // End of anonymous namespace
+
+/**
+ * Changes anywhere below the cache reach it, through widgets and layouts
+ */
+TEST( gui_CachedWidget, invalidated_from_below )
+{
+    auto tile  = gui::Tile::create( math::Size2i( { 50, 50 } ) );
+    auto label = gui::Label::from_frame( std::make_shared<img::Frame>( img::Dimensions( 50, 20, 4 ) ) );
+
+    auto inner = std::make_shared<gui::LayoutVertical>();
+    inner->append( tile );
+    inner->append( label );
+
+    auto cache = std::make_shared<Counting_Cache>( gui::WidgetLayout::from_layout( inner ) );
+    ASSERT_FALSE( cache->is_cached() );
+    ASSERT_EQ( cache->size_hint().preferred.height(), 70 );
+
+    // Appearance changes in a widget two levels down
+    tile->bind( nullptr, nullptr );
+    ASSERT_EQ( cache->invalidations, 1u );
+    label->set_border( img::PIXEL_BLACK() );
+    ASSERT_EQ( cache->invalidations, 2u );
+
+    // Layout changes
+    inner->set_padding_color( img::PIXEL_RED() );
+    ASSERT_EQ( cache->invalidations, 3u );
+    inner->set_padding( 1, 1, 1, 1 );
+    ASSERT_EQ( cache->invalidations, 4u );
+    ASSERT_EQ( cache->size_hint().preferred.height(), 72 );
+
+    // A cache held in a layout passes changes on to the layouts above it
+    auto outer = std::make_shared<gui::LayoutVertical>();
+    outer->append( cache );
+    const auto before = outer->measure().preferred.height();
+    inner->set_padding( 2, 2, 2, 2 );
+    ASSERT_EQ( outer->measure().preferred.height(), before + 2 );
+
+    ASSERT_THROW( gui::CachedWidget::create( nullptr ), std::runtime_error );
+}
+
+/**
+ * Moving the focus or scrolling a grid redraws the cache holding it
+ */
+TEST( gui_CachedWidget, grid_focus )
+{
+    auto grid = std::make_shared<gui::LayoutGrid>( math::Size2i( { 20, 20 } ) );
+    grid->set_layout_size( math::Size2i( { 40, 40 } ) );
+    for( size_t i = 0; i < 6; i++ ){
+        grid->append( gui::Tile::create( math::Size2i( { 20, 20 } ) ) );
+    }
+
+    auto cache = std::make_shared<Counting_Cache>( gui::WidgetLayout::from_layout( grid ) );
+    const auto before = cache->invalidations;
+    grid->set_focus( 5 );
+    ASSERT_GT( cache->invalidations, before );
+}
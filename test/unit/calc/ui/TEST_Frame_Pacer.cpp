@@ -0,0 +1,98 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Frame_Pacer.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Frame Pacer Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/core/Frame_Pacer.hpp>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+/**
+ * The rate holds through the burst, then decays to idle
+ */
+TEST( gui_Frame_Pacer, burst_and_decay )
+{
+    gui::Frame_Pacer pacer( 60, 4, 500ms, 200ms );
+    const auto start = gui::Frame_Pacer::Clock::now();
+    pacer.request_burst( start );
+
+    ASSERT_DOUBLE_EQ( pacer.fps( start ), 60 );
+    ASSERT_DOUBLE_EQ( pacer.target_fps(), 60 );
+    ASSERT_DOUBLE_EQ( pacer.fps( start + 500ms ), 60 );
+
+    // One half-life after the burst, halfway to idle
+    ASSERT_NEAR( pacer.fps( start + 700ms ), 32, 1e-6 );
+    ASSERT_LT( pacer.fps( start + 900ms ), pacer.fps( start + 700ms ) );
+    ASSERT_DOUBLE_EQ( pacer.fps( start + 5s ), 4 );
+
+    // New activity goes straight back to the target
+    pacer.request_burst( start + 5s );
+    ASSERT_DOUBLE_EQ( pacer.fps( start + 5s ), 60 );
+}
+
+/**
+ * Deadlines follow a fixed schedule, and late frames are counted without a catch-up rush
+ */
+TEST( gui_Frame_Pacer, missed_deadlines )
+{
+    gui::Frame_Pacer pacer( 50, 50, 0ms, 0ms );
+    const auto start = gui::Frame_Pacer::Clock::now();
+
+    // 20 ms per frame.  A frame ending early still waits for its slot.
+    auto deadline = pacer.end_frame( start );
+    ASSERT_EQ( deadline - start, 20ms );
+    deadline = pacer.end_frame( start + 25ms );
+    ASSERT_EQ( deadline - start, 40ms );
+    ASSERT_EQ( pacer.stats().missed_deadlines, 0u );
+
+    // This frame ends 30 ms past its own deadline, which is also past the next one
+    deadline = pacer.end_frame( start + 70ms );
+    ASSERT_EQ( deadline - start, 70ms );
+
+    auto stats = pacer.stats();
+    ASSERT_EQ( stats.frames, 3u );
+    ASSERT_EQ( stats.missed_deadlines, 1u );
+    ASSERT_EQ( stats.worst_overrun, 10ms );
+    ASSERT_EQ( stats.last_frame_time, 30ms );
+    ASSERT_DOUBLE_EQ( stats.current_fps, 50 );
+}
+
+/**
+ * The waiter gets the next deadline, and input starts the next frame at once
+ */
+TEST( gui_Frame_Pacer, waiter_ends_idle_frame )
+{
+    gui::Frame_Pacer pacer( 50, 1, 0ms, 0ms );
+
+    gui::Frame_Pacer::Clock::time_point until;
+    gui::Frame_Pacer::Clock::duration   poll_interval;
+    pacer.wait_for_next_frame( [&]( auto deadline, auto interval ){
+        until         = deadline;
+        poll_interval = interval;
+        return true;
+    });
+
+    // Idle frames are a second long, but the waiter is asked to poll at the target rate
+    ASSERT_EQ( poll_interval, std::chrono::duration_cast<gui::Frame_Pacer::Clock::duration>( 20ms ) );
+    ASSERT_GT( until - gui::Frame_Pacer::Clock::now(), 500ms );
+
+    // Input moved the deadline up, so the next frame is not waiting on the idle one
+    const auto now = gui::Frame_Pacer::Clock::now();
+    pacer.request_burst( now );
+    ASSERT_LT( pacer.end_frame( now ) - now, 500ms );
+}
@@ -0,0 +1,181 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_LayoutGrid.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details LayoutGrid Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/layout/LayoutGrid.hpp>
+#include <terminus/gui/widget/Label.hpp>
+#include <terminus/gui/widget/Tile.hpp>
+
+// C++ Standard Libraries
+#include <map>
+
+using namespace tmns;
+
+namespace {
+
+/// Key press for the grid
+drv::Input_Event press( drv::Key key,
+                        drv::Input_Action action = drv::Input_Action::PRESS )
+{
+    drv::Input_Event event;
+    event.action = action;
+    event.key    = key;
+    return event;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Only the rows in view are bound, and each cell lands on its row and column
+ */
+TEST( gui_LayoutGrid, binds_visible_cells )
+{
+    // 3 columns of 100 x 50 cells, 3 rows in view
+    auto layout = std::make_shared<gui::LayoutGrid>( math::Size2i( { 100, 50 } ), 10 );
+    layout->set_layout_size( math::Size2i( { 330, 170 } ) );
+
+    size_t calls = 0;
+    layout->set_cell_factory( 20, [&calls]( size_t, gui::WidgetBase::ptr_t recycled ) -> gui::WidgetBase::ptr_t {
+        calls++;
+        return recycled ? recycled : gui::Tile::create( math::Size2i( { 100, 50 } ) );
+    } );
+
+    ASSERT_EQ( layout->item_count(), 20u );
+    ASSERT_EQ( layout->columns(), 3u );
+    ASSERT_EQ( layout->rows(), 7u );
+    ASSERT_EQ( layout->visible_rows(), 3u );
+
+    layout->update_view();
+    ASSERT_EQ( layout->bound_items().size(), 9u );
+    ASSERT_EQ( layout->bound_items().front(), 0u );
+    ASSERT_EQ( layout->bound_items().back(), 8u );
+    ASSERT_EQ( layout->stats().cells_created, 9u );
+    ASSERT_EQ( calls, 9u );
+
+    // Nothing changes until the view moves
+    layout->update_view();
+    ASSERT_EQ( calls, 9u );
+
+    auto bboxes = layout->allocate_bboxes();
+    ASSERT_EQ( bboxes.size(), 9u );
+    ASSERT_EQ( bboxes[4].min().x(), 110 );
+    ASSERT_EQ( bboxes[4].min().y(), 60 );
+    ASSERT_EQ( bboxes[4].width(), 100 );
+    ASSERT_EQ( bboxes[4].height(), 50 );
+
+    // A narrower grid has fewer columns
+    layout->set_layout_size( math::Size2i( { 205, 170 } ) );
+    ASSERT_EQ( layout->columns(), 1u );
+    layout->set_layout_size( math::Size2i( { 210, 170 } ) );
+    ASSERT_EQ( layout->columns(), 2u );
+}
+
+/**
+ * Scrolling rebinds the cells which left the view instead of building new ones
+ */
+TEST( gui_LayoutGrid, scrolling_recycles_cells )
+{
+    auto layout = std::make_shared<gui::LayoutGrid>( math::Size2i( { 100, 50 } ), 10 );
+    layout->set_layout_size( math::Size2i( { 330, 170 } ) );
+
+    std::map<gui::WidgetBase*,size_t> shown;
+    layout->set_cell_factory( 20, [&shown]( size_t index, gui::WidgetBase::ptr_t recycled ) -> gui::WidgetBase::ptr_t {
+        auto cell = recycled ? recycled : gui::Tile::create( math::Size2i( { 100, 50 } ) );
+        shown[cell.get()] = index;
+        return cell;
+    } );
+    layout->update_view();
+
+    // Focusing the fourth row scrolls down by one
+    layout->set_focus( 10 );
+    ASSERT_EQ( layout->first_visible_row(), 1u );
+    ASSERT_EQ( layout->bound_items().front(), 3u );
+    ASSERT_EQ( layout->bound_items().back(), 11u );
+    ASSERT_EQ( layout->stats().cells_created, 9u );
+    ASSERT_EQ( layout->stats().cells_recycled, 3u );
+
+    // The last row stops at the bottom of the view
+    layout->set_focus( 19 );
+    ASSERT_EQ( layout->first_visible_row(), 4u );
+    ASSERT_EQ( layout->bound_items().size(), 8u );
+    ASSERT_EQ( layout->stats().cells_created, 9u );
+    ASSERT_EQ( layout->stats().cells_recycled, 11u );
+    ASSERT_EQ( shown.size(), 9u );
+
+    // Scrolling back to the top keeps the focus in view
+    layout->set_focus( 0 );
+    ASSERT_EQ( layout->first_visible_row(), 0u );
+    ASSERT_EQ( layout->stats().cells_created, 9u );
+
+    ASSERT_THROW( layout->set_focus( 20 ), std::runtime_error );
+}
+
+/**
+ * Keys move the focus around appended widgets, and Enter activates it
+ */
+TEST( gui_LayoutGrid, keyboard_focus )
+{
+    auto layout = std::make_shared<gui::LayoutGrid>( math::Size2i( { 100, 50 } ), 10 );
+    layout->set_layout_size( math::Size2i( { 330, 170 } ) );
+    for( size_t i = 0; i < 7; i++ ){
+        layout->append( gui::Label::from_frame( std::make_shared<img::Frame>( img::Dimensions( 100, 50, 4 ) ) ) );
+    }
+
+    std::optional<size_t> activated;
+    layout->set_activate_callback( [&activated]( size_t index ){ activated = index; } );
+
+    // Nothing is activated before something is focused
+    ASSERT_FALSE( layout->handle_input( press( drv::Key::ENTER ) ) );
+
+    // The first key only shows the focus
+    ASSERT_TRUE( layout->handle_input( press( drv::Key::RIGHT ) ) );
+    ASSERT_EQ( layout->focus().value(), 0u );
+
+    layout->handle_input( press( drv::Key::RIGHT ) );
+    ASSERT_EQ( layout->focus().value(), 1u );
+    layout->handle_input( press( drv::Key::DOWN, drv::Input_Action::REPEAT ) );
+    ASSERT_EQ( layout->focus().value(), 4u );
+
+    // Down into the short last row lands on its last item
+    layout->handle_input( press( drv::Key::DOWN ) );
+    ASSERT_EQ( layout->focus().value(), 6u );
+    layout->handle_input( press( drv::Key::DOWN ) );
+    ASSERT_EQ( layout->focus().value(), 6u );
+
+    layout->handle_input( press( drv::Key::UP ) );
+    ASSERT_EQ( layout->focus().value(), 3u );
+    layout->handle_input( press( drv::Key::HOME ) );
+    ASSERT_EQ( layout->focus().value(), 0u );
+    layout->handle_input( press( drv::Key::LEFT ) );
+    ASSERT_EQ( layout->focus().value(), 0u );
+    layout->handle_input( press( drv::Key::END ) );
+    ASSERT_EQ( layout->focus().value(), 6u );
+
+    // Releases and unknown keys are left for others
+    ASSERT_FALSE( layout->handle_input( press( drv::Key::HOME, drv::Input_Action::RELEASE ) ) );
+    ASSERT_FALSE( layout->handle_input( press( drv::Key::ESCAPE ) ) );
+    ASSERT_EQ( layout->focus().value(), 6u );
+
+    ASSERT_TRUE( layout->handle_input( press( drv::Key::SPACE ) ) );
+    ASSERT_EQ( activated.value(), 6u );
+
+    // Appended widgets are shown as they are, without a factory
+    layout->update_view();
+    ASSERT_EQ( layout->bound_items().size(), 7u );
+    ASSERT_EQ( layout->stats().cells_created, 0u );
+}
@@ -0,0 +1,126 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_LayoutPrimitives.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Layout Primitives Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/layout/LayoutPrimitives.hpp>
+
+using namespace tmns;
+
+namespace {
+
+gui::FlexItem item( int                   minimum,
+                    int                   preferred,
+                    gui::StretchPolicy    stretch = gui::StretchPolicy::GROW,
+                    std::optional<double> ratio   = {} )
+{
+    gui::FlexItem flex;
+    flex.minimum   = minimum;
+    flex.preferred = preferred;
+    flex.stretch   = stretch;
+    flex.ratio     = ratio;
+    return flex;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Spare room goes to the GROW items only, and FIXED items keep their preferred length
+ */
+TEST( gui_LayoutPrimitives, flex_grow_and_fixed )
+{
+    auto lengths = gui::flex_distribute( { item( 10, 20, gui::StretchPolicy::FIXED ),
+                                           item( 10, 20 ),
+                                           item( 10, 30 ) },
+                                         101 );
+    ASSERT_EQ( lengths.size(), 3u );
+    ASSERT_EQ( lengths[0], 20 );
+    ASSERT_EQ( lengths[1], 36 );
+    ASSERT_EQ( lengths[2], 45 );
+
+    // Without GROW items the room is left over
+    lengths = gui::flex_distribute( { item( 10, 20, gui::StretchPolicy::FIXED ) }, 100 );
+    ASSERT_EQ( lengths[0], 20 );
+}
+
+/**
+ * Items shrink towards their minimum, then get clipped in order
+ */
+TEST( gui_LayoutPrimitives, flex_shrink_and_clip )
+{
+    // 20 of the 40 pixels of slack are available, so each item keeps half of its slack
+    auto lengths = gui::flex_distribute( { item( 10, 30 ), item( 20, 40 ) }, 50 );
+    ASSERT_EQ( lengths[0], 20 );
+    ASSERT_EQ( lengths[1], 30 );
+
+    // Minimums do not fit
+    lengths = gui::flex_distribute( { item( 30, 40 ), item( 30, 40 ), item( 30, 40 ) }, 50 );
+    ASSERT_EQ( lengths[0], 30 );
+    ASSERT_EQ( lengths[1], 20 );
+    ASSERT_EQ( lengths[2], 0 );
+}
+
+/**
+ * Ratios are a share of the whole axis, and the rest is measured
+ */
+TEST( gui_LayoutPrimitives, flex_ratios )
+{
+    auto lengths = gui::flex_distribute( { item( 0, 0, gui::StretchPolicy::GROW, 0.5 ),
+                                           item( 10, 20, gui::StretchPolicy::FIXED ),
+                                           item( 10, 20 ) },
+                                         200 );
+    ASSERT_EQ( lengths[0], 100 );
+    ASSERT_EQ( lengths[1], 20 );
+    ASSERT_EQ( lengths[2], 80 );
+
+    // Ratios over one are scaled down and leave nothing
+    lengths = gui::flex_distribute( { item( 0, 0, gui::StretchPolicy::GROW, 1.0 ),
+                                      item( 0, 0, gui::StretchPolicy::GROW, 3.0 ),
+                                      item( 10, 20 ) },
+                                    100 );
+    ASSERT_EQ( lengths[0], 25 );
+    ASSERT_EQ( lengths[1], 75 );
+    ASSERT_EQ( lengths[2], 0 );
+}
+
+/**
+ * GROW items stop at their maximum and the rest of the room goes to the others
+ */
+TEST( gui_LayoutPrimitives, flex_grow_capped )
+{
+    auto capped = item( 10, 20 );
+    capped.maximum = 30;
+
+    auto lengths = gui::flex_distribute( { capped, item( 10, 20 ) }, 100 );
+    ASSERT_EQ( lengths[0], 30 );
+    ASSERT_EQ( lengths[1], 70 );
+
+    // Caps reached in a later round still pass their remainder on
+    auto small = item( 0, 0 );
+    small.maximum = 5;
+    auto medium = item( 0, 0 );
+    medium.maximum = 40;
+    lengths = gui::flex_distribute( { small, medium, item( 0, 0 ) }, 100 );
+    ASSERT_EQ( lengths[0], 5 );
+    ASSERT_EQ( lengths[1], 40 );
+    ASSERT_EQ( lengths[2], 55 );
+
+    // When every item is capped the rest is left unused
+    lengths = gui::flex_distribute( { capped, small }, 100 );
+    ASSERT_EQ( lengths[0], 30 );
+    ASSERT_EQ( lengths[1], 5 );
+}
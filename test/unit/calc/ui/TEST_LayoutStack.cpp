@@ -0,0 +1,106 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_LayoutStack.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details LayoutStack Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/layout/LayoutStack.hpp>
+#include <terminus/gui/widget/Tile.hpp>
+#include <terminus/image/Pixels.hpp>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// Page image filled with one color
+img::Frame page_image( const math::Vector4u& color )
+{
+    img::Frame frame( img::Dimensions( 10, 4, 4 ) );
+    frame.set_all_pixels( color );
+    frame.set_premultiplied( true );
+    return frame;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Slides move both pages together, and crossfades blend them
+ */
+TEST( gui_LayoutStack, transition_steps )
+{
+    const auto from = page_image( img::PIXEL_RED() );
+    const auto to   = page_image( img::PIXEL_BLUE() );
+    img::Frame output( img::Dimensions( 10, 4, 4 ) );
+    img::Frame_View view( output );
+
+    // Halfway forward, the new page has come in from the right
+    gui::render_page_transition( gui::PageTransition::SLIDE, 0.5, true, from, to, view );
+    ASSERT_EQ( output.get_pixel( 4, 2 )[0], 255 );
+    ASSERT_EQ( output.get_pixel( 5, 2 )[2], 255 );
+
+    // Going back, it comes in from the left
+    gui::render_page_transition( gui::PageTransition::SLIDE, 0.5, false, from, to, view );
+    ASSERT_EQ( output.get_pixel( 4, 2 )[2], 255 );
+    ASSERT_EQ( output.get_pixel( 5, 2 )[0], 255 );
+
+    // The ends are the two pages
+    gui::render_page_transition( gui::PageTransition::SLIDE, 0, true, from, to, view );
+    ASSERT_EQ( output.get_pixel( 9, 3 )[0], 255 );
+    gui::render_page_transition( gui::PageTransition::SLIDE, 1, true, from, to, view );
+    ASSERT_EQ( output.get_pixel( 0, 0 )[2], 255 );
+
+    // Crossfades mix the pages evenly halfway
+    gui::render_page_transition( gui::PageTransition::CROSSFADE, 0.5, true, from, to, view );
+    for( size_t col = 0; col < 10; col++ ){
+        const auto pixel = output.get_pixel( col, 1 );
+        ASSERT_NEAR( pixel[0], 128, 1 );
+        ASSERT_NEAR( pixel[2], 128, 1 );
+        ASSERT_EQ( pixel[3], 255 );
+    }
+
+    gui::render_page_transition( gui::PageTransition::NONE, 0.5, true, from, to, view );
+    ASSERT_EQ( output.get_pixel( 3, 3 )[2], 255 );
+}
+
+/**
+ * Pages are switched by index, and settings take effect without rendering
+ */
+TEST( gui_LayoutStack, switching )
+{
+    gui::LayoutStack stack;
+    ASSERT_FALSE( stack.current().has_value() );
+    for( size_t i = 0; i < 3; i++ ){
+        stack.append( gui::Tile::create( math::Size2i( { 20, 20 } ) ) );
+    }
+    ASSERT_EQ( stack.current().value(), 2u );
+
+    stack.set_page_cache( 2 );
+    stack.set_transition( gui::PageTransition::SLIDE, 200ms );
+    ASSERT_EQ( stack.page_cache_capacity(), 2u );
+
+    // Nothing was rendered, so there is no image to animate from
+    stack.set_current( 0 );
+    ASSERT_EQ( stack.current().value(), 0u );
+    ASSERT_FALSE( stack.in_transition() );
+    ASSERT_FALSE( stack.is_page_cached( 2 ) );
+    ASSERT_THROW( stack.set_current( 3 ), std::runtime_error );
+    ASSERT_EQ( stack.stats().renders, 0u );
+
+    ASSERT_EQ( gui::page_transition_from_string( "crossfade" ), gui::PageTransition::CROSSFADE );
+    ASSERT_EQ( gui::to_string( gui::PageTransition::SLIDE ), "SLIDE" );
+    ASSERT_THROW( gui::page_transition_from_string( "wipe" ), std::runtime_error );
+}
@@ -18,7 +18,9 @@
 
 // Project Libraries
 #include <terminus/gui/layout/LayoutVertical.hpp>
+#include <terminus/gui/layout/LayoutHorizontal.hpp>
 #include <terminus/gui/widget/Label.hpp>
+#include <terminus/gui/widget/WidgetLayout.hpp>
 #include <terminus/log.hpp>
 
 using namespace tmns;
@@ -102,4 +104,67 @@ TEST_F( gui_LayoutVertical, allocate_bbox_test1 )
     // Verify item 3 has no space allocated
     ASSERT_NEAR( bboxes[2].area(), 0, 0.0001 );
 
-}
\ No newline at end of file
+}
+
+/**
+ * Nested layouts measure bottom-up, arrange top-down, and only redo the work when invalidated
+ */
+TEST_F( gui_LayoutVertical, measure_arrange_cache )
+{
+    // A row with a fixed height which takes any width
+    auto row = std::make_shared<gui::LayoutHorizontal>();
+    row->set_layout_size( math::Size2i( { 0, 50 } ) );
+    row->set_horizontal_stretch_policy( gui::StretchPolicy::GROW );
+    row->append( gui::Label::from_frame( std::make_shared<img::Frame>( img::Dimensions( 40, 30, 4 ) ) ) );
+    row->append( gui::Label::from_frame( std::make_shared<img::Frame>( img::Dimensions( 60, 20, 4 ) ) ) );
+
+    auto hint = row->measure();
+    ASSERT_EQ( hint.minimum.width(),   100 );
+    ASSERT_EQ( hint.preferred.height(), 50 );
+    ASSERT_EQ( hint.maximum.height(),   50 );
+    ASSERT_EQ( hint.maximum.width(),    gui::SizeHint::UNBOUNDED );
+
+    // A column holding the row and a page which takes the rest
+    auto page = std::make_shared<gui::LayoutVertical>();
+    page->set_horizontal_stretch_policy( gui::StretchPolicy::GROW );
+    page->set_vertical_stretch_policy( gui::StretchPolicy::GROW );
+    page->append( gui::Label::from_frame( test_frames[0] ) );
+
+    auto column = std::make_shared<gui::LayoutVertical>();
+    column->set_padding( 10, 10, 10, 10 );
+    auto row_idx = column->append( gui::WidgetLayout::from_layout( row ) );
+    column->append( gui::WidgetLayout::from_layout( page ) );
+    column->set_item_stretch( row_idx, gui::StretchPolicy::FIXED );
+    ASSERT_THROW( column->set_item_stretch( 5, gui::StretchPolicy::FIXED ), std::runtime_error );
+
+    column->arrange( math::Size2i( { 400, 600 } ) );
+    const auto placed = column->arrangement();
+    ASSERT_EQ( placed.size(), 2u );
+    ASSERT_EQ( placed[0].min().y(), 10 );
+    ASSERT_EQ( placed[0].width(),  380 );
+    ASSERT_EQ( placed[0].height(), 50 );
+    ASSERT_EQ( placed[1].min().y(), 60 );
+    ASSERT_EQ( placed[1].height(), 530 );
+
+    // The children were given their share
+    ASSERT_EQ( row->layout_size().width(),   380 );
+    ASSERT_EQ( page->layout_size().height(), 530 );
+
+    // Nothing changed, so nothing is redone
+    auto arranged = column->arrange_count();
+    column->arrange( math::Size2i( { 400, 600 } ) );
+    column->arrangement();
+    ASSERT_EQ( column->arrange_count(), arranged );
+
+    // Changing a nested layout invalidates everything above it
+    row->set_layout_size( math::Size2i( { 380, 80 } ) );
+    column->arrangement();
+    ASSERT_EQ( column->arrange_count(), arranged + 1 );
+    ASSERT_EQ( column->arrangement()[0].height(), 80 );
+    ASSERT_EQ( column->arrangement()[1].height(), 500 );
+
+    // A new size reflows the page
+    column->arrange( math::Size2i( { 200, 300 } ) );
+    ASSERT_EQ( page->layout_size().width(),  180 );
+    ASSERT_EQ( page->layout_size().height(), 200 );
+}
@@ -0,0 +1,143 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_ListView.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details ListView Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/widget/ListView.hpp>
+#include <terminus/gui/widget/Tile.hpp>
+
+using namespace tmns;
+
+namespace {
+
+/// Builder for rows of the given height, counting its calls
+gui::ListView::Row_Builder row_builder( size_t& calls,
+                                        std::function<int( size_t )> height )
+{
+    return [&calls, height]( size_t index, gui::WidgetBase::ptr_t recycled ) -> gui::WidgetBase::ptr_t {
+        calls++;
+        if( recycled && recycled->size_pixels().height() == height( index ) ){
+            return recycled;
+        }
+        return gui::Tile::create( math::Size2i( { 200, height( index ) } ) );
+    };
+}
+
+} // End of anonymous namespace
+
+/**
+ * A huge list only builds the rows in view, and jumping to its end rebinds them
+ */
+TEST( gui_ListView, opens_lazily )
+{
+    auto list = gui::ListView::create( math::Size2i( { 200, 100 } ), 20 );
+
+    size_t calls = 0;
+    list->set_data_source( 100'000, row_builder( calls, []( size_t ){ return 20; } ) );
+    ASSERT_EQ( list->item_count(), 100'000u );
+    ASSERT_EQ( list->visible_rows().size(), 5u );
+    ASSERT_EQ( list->stats().rows_built, 5u );
+    ASSERT_EQ( calls, 5u );
+    ASSERT_EQ( list->content_height(), 2'000'000u );
+
+    // Scrolling part way into a row brings in one more
+    ASSERT_TRUE( list->scroll_by( 30 ) );
+    ASSERT_EQ( list->first_visible_row(), 1u );
+    ASSERT_EQ( list->first_row_offset(), 10 );
+    ASSERT_EQ( list->visible_rows().front(), 1u );
+    ASSERT_EQ( list->visible_rows().back(), 6u );
+    ASSERT_EQ( list->stats().rows_built, 6u );
+    ASSERT_EQ( list->stats().rows_recycled, 1u );
+
+    // The end of the list stops at the bottom of the view
+    list->scroll_to( 99'999 );
+    ASSERT_EQ( list->first_visible_row(), 99'995u );
+    ASSERT_EQ( list->first_row_offset(), 0 );
+    ASSERT_EQ( list->visible_rows().size(), 5u );
+    ASSERT_EQ( list->stats().rows_built, 6u );
+    ASSERT_FALSE( list->scroll_by( 100 ) );
+    ASSERT_EQ( list->first_visible_row(), 99'995u );
+
+    ASSERT_TRUE( list->scroll_by( -30 ) );
+    ASSERT_EQ( list->first_visible_row(), 99'993u );
+    ASSERT_EQ( list->first_row_offset(), 10 );
+    ASSERT_EQ( list->visible_rows().size(), 6u );
+}
+
+/**
+ * Rows are measured as they are built, and the rest use the estimate
+ */
+TEST( gui_ListView, variable_heights )
+{
+    auto list = gui::ListView::create( math::Size2i( { 200, 100 } ), 20 );
+
+    // Rows of 10, 20 and 30 pixels
+    size_t calls = 0;
+    list->set_data_source( 30, row_builder( calls, []( size_t index ){ return 10 + static_cast<int>( index % 3 ) * 10; } ) );
+
+    // 10 + 20 + 30 + 10 + 20 + 30 fills 100 pixels with six rows
+    ASSERT_EQ( list->visible_rows().size(), 6u );
+    ASSERT_EQ( list->content_height(), 120u + 24u * 20u );
+
+    // Scroll past the first two rows and 5 pixels into the third
+    list->scroll_by( 35 );
+    ASSERT_EQ( list->first_visible_row(), 2u );
+    ASSERT_EQ( list->first_row_offset(), 5 );
+
+    // Back up past the top stops at the top
+    ASSERT_TRUE( list->scroll_by( -500 ) );
+    ASSERT_EQ( list->first_visible_row(), 0u );
+    ASSERT_EQ( list->first_row_offset(), 0 );
+
+    // Every row measured gives the exact height
+    list->scroll_to( 29 );
+    list->scroll_by( -1000 );
+    ASSERT_EQ( list->content_height(), 600u );
+}
+
+/**
+ * Keys scroll by a row or a page, and jump to either end
+ */
+TEST( gui_ListView, keyboard_scrolling )
+{
+    auto list = gui::ListView::create( math::Size2i( { 200, 100 } ), 20 );
+
+    size_t calls = 0;
+    list->set_data_source( 50, row_builder( calls, []( size_t ){ return 20; } ) );
+
+    drv::Input_Event event;
+    event.key = drv::Key::DOWN;
+    ASSERT_TRUE( list->handle_input( event ) );
+    ASSERT_EQ( list->first_visible_row(), 1u );
+
+    event.key = drv::Key::PAGE_DOWN;
+    list->handle_input( event );
+    ASSERT_EQ( list->first_visible_row(), 6u );
+
+    event.key = drv::Key::END;
+    list->handle_input( event );
+    ASSERT_EQ( list->first_visible_row(), 45u );
+
+    event.key = drv::Key::HOME;
+    list->handle_input( event );
+    ASSERT_EQ( list->first_visible_row(), 0u );
+
+    event.key    = drv::Key::DOWN;
+    event.action = drv::Input_Action::RELEASE;
+    ASSERT_FALSE( list->handle_input( event ) );
+    ASSERT_EQ( list->first_visible_row(), 0u );
+}
@@ -0,0 +1,111 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Presenter.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Presenter Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/gui/core/Presenter.hpp>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+/**
+ * Queued frames are all presented, in order
+ */
+TEST( gui_Presenter, queue_presents_every_frame )
+{
+    std::vector<uint8_t> seen;
+    gui::Presenter presenter( [&seen]( img::Frame& frame ){
+                                  std::this_thread::sleep_for( 1ms );
+                                  seen.push_back( frame.pixels()[0] );
+                              },
+                              img::Dimensions( 8, 4, 4 ),
+                              3,
+                              gui::PresentPolicy::QUEUE );
+
+    for( uint8_t i = 1; i <= 20; i++ ){
+        presenter.back_buffer().data()[0] = i;
+        presenter.submit();
+    }
+    presenter.flush();
+
+    auto stats = presenter.stats();
+    ASSERT_EQ( stats.submitted, 20u );
+    ASSERT_EQ( stats.presented, 20u );
+    ASSERT_EQ( stats.dropped, 0u );
+    ASSERT_EQ( seen.size(), 20u );
+    for( size_t i = 0; i < seen.size(); i++ ){
+        ASSERT_EQ( seen[i], i + 1 );
+    }
+}
+
+/**
+ * A stalled presenter never blocks rendering when dropping, and the newest frame wins
+ */
+TEST( gui_Presenter, drop_keeps_latest )
+{
+    std::atomic<bool>    release { false };
+    std::vector<uint8_t> seen;
+    gui::Presenter presenter( [&]( img::Frame& frame ){
+                                  while( !release.load() ){
+                                      std::this_thread::sleep_for( 1ms );
+                                  }
+                                  seen.push_back( frame.pixels()[0] );
+                              },
+                              img::Dimensions( 8, 4, 4 ),
+                              2,
+                              gui::PresentPolicy::DROP );
+
+    for( uint8_t i = 1; i <= 10; i++ ){
+        presenter.back_buffer().data()[0] = i;
+        presenter.submit();
+    }
+    release.store( true );
+    presenter.flush();
+    presenter.stop();
+
+    auto stats = presenter.stats();
+    ASSERT_EQ( stats.submitted, 10u );
+    ASSERT_EQ( stats.presented + stats.dropped, 10u );
+    ASSERT_GT( stats.dropped, 0u );
+    ASSERT_EQ( stats.render_waits, 0u );
+    ASSERT_FALSE( seen.empty() );
+    ASSERT_EQ( seen.back(), 10 );
+}
+
+/**
+ * A new back buffer starts with the last frame submitted
+ */
+TEST( gui_Presenter, carries_last_frame )
+{
+    gui::Presenter presenter( []( img::Frame& ){},
+                              img::Dimensions( 8, 4, 4 ),
+                              3,
+                              gui::PresentPolicy::QUEUE );
+
+    presenter.back_buffer().data()[5] = 42;
+    presenter.submit();
+    ASSERT_EQ( presenter.back_buffer().pixels()[5], 42 );
+    ASSERT_EQ( presenter.back_buffer().pixels()[6], 255 );
+
+    ASSERT_EQ( gui::present_policy_from_string( "queue" ), gui::PresentPolicy::QUEUE );
+    ASSERT_THROW( gui::present_policy_from_string( "sometimes" ), std::runtime_error );
+}
@@ -0,0 +1,122 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Resource_Manager.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Resource_Manager Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <atomic>
+#include <fstream>
+
+// Project Libraries
+#include <terminus/gui/core/Resource_Manager.hpp>
+#include <terminus/gui/widget/Label.hpp>
+#include <terminus/image/Frame_File.hpp>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// Driver which only decodes frame files, and counts how often it does
+class Test_Driver : public drv::Driver_Base {
+
+    public:
+
+        bool initialize( core::Options& ) override { return true; }
+        int finalize() override { return 0; }
+        bool okay_to_run() override { return true; }
+        bool input_pending() override { return false; }
+        void show( img::Frame& ) override {}
+        img::Dimensions get_screen_dimensions() const override { return img::Dimensions( 320, 240, 4 ); }
+        img::Frame::ptr_t rasterize_text( const std::string& ) override { return nullptr; }
+        std::string to_log_string( size_t ) const override { return " - Test_Driver\n"; }
+
+        img::Frame::ptr_t load_image( const std::filesystem::path& path ) override
+        {
+            loads++;
+            return img::read_frame_file( path );
+        }
+
+        /// Number of images decoded
+        std::atomic<size_t> loads { 0 };
+
+}; // End of Test_Driver Class
+
+/// Write a square icon into the loose resource folder
+void write_icon( const std::filesystem::path& folder, int side )
+{
+    img::Frame frame( img::Dimensions( static_cast<size_t>( side ), static_cast<size_t>( side ), 4 ) );
+    frame.set_all_pixels( math::Vector4u( { 200, 100, 50, 128 } ) );
+    img::write_frame_file( frame,
+                           folder / ( "icon_" + std::to_string( side ) + ".tfrm" ),
+                           img::FrameCompression::NONE );
+}
+
+} // End of anonymous namespace
+
+/**
+ * Icons are picked by their headers and loaded off the UI thread
+ */
+TEST( gui_Resource_Manager, find_and_load_async )
+{
+    const auto root = std::filesystem::temp_directory_path() / "tmns_resource_manager_test";
+    std::filesystem::remove_all( root );
+    std::filesystem::create_directories( root / "images" / "icon" );
+    for( int side : { 24, 48, 96 } ){
+        write_icon( root / "images" / "icon", side );
+    }
+
+    // A PNG is sized from its IHDR chunk alone, so the rest of the file is never read
+    {
+        const uint8_t png[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n',
+                                0, 0, 0, 13, 'I', 'H', 'D', 'R',
+                                0, 0, 0, 64, 0, 0, 0, 64 };
+        std::ofstream fout( root / "images" / "icon" / "icon_64.png", std::ios::binary );
+        fout.write( reinterpret_cast<const char*>( png ), sizeof( png ) );
+    }
+
+    Test_Driver driver;
+    auto resources = gui::Resource_Manager::create( root, nullptr, driver );
+
+    // Nothing is decoded just to choose
+    ASSERT_EQ( resources->find_image_name( "icon", math::Size2i( { 50, 50 } ) ).value(), "images/icon/icon_48.tfrm" );
+    ASSERT_EQ( resources->find_image_name( "icon", math::Size2i( { 70, 70 } ) ).value(), "images/icon/icon_64.png" );
+    ASSERT_FALSE( resources->find_image_name( "icon", math::Size2i( { 10, 10 } ) ).has_value() );
+    ASSERT_EQ( driver.loads.load(), 0u );
+
+    auto result = resources->load_image_async( "images/icon/icon_96.tfrm" );
+    ASSERT_EQ( result.get()->cols(), 96u );
+    ASSERT_EQ( driver.loads.load(), 1u );
+    ASSERT_THROW( resources->load_image_async( "images/icon/missing.tfrm" ).get(), std::runtime_error );
+
+    // Cached images are ready at once
+    auto cached = resources->load_image( "images/icon/icon_24.tfrm" ).value();
+    auto ready  = resources->load_image_async( "images/icon/icon_24.tfrm" );
+    ASSERT_EQ( ready.wait_for( 0s ), std::future_status::ready );
+    ASSERT_EQ( ready.get(), cached );
+
+    // The label keeps its placeholder size until it renders, even once the image is in
+    auto label = gui::Label::from_resource_async( "images/icon/icon_48.tfrm", *resources, math::Size2i( { 96, 96 } ) );
+    for( int i = 0; i < 500 && driver.loads.load() < 2; i++ ){
+        std::this_thread::sleep_for( 1ms );
+    }
+    ASSERT_TRUE( label->is_loading() );
+    ASSERT_EQ( label->size_pixels().width(), 96 );
+
+    resources->finalize();
+    driver.stop_image_loader();
+    std::filesystem::remove_all( root );
+}
@@ -0,0 +1,86 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_LZ_Codec.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details LZ Codec Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <stdexcept>
+#include <vector>
+
+// Project Libraries
+#include <terminus/core/LZ_Codec.hpp>
+
+using namespace tmns;
+
+/**
+ * Buffers survive a round trip, and repetitive ones shrink
+ */
+TEST( core_LZ_Codec, round_trip )
+{
+    // Empty, short, long runs, repeated patterns, and noise
+    std::vector<std::vector<uint8_t>> inputs;
+    inputs.push_back( {} );
+    inputs.push_back( { 1, 2, 3 } );
+    inputs.push_back( std::vector<uint8_t>( 100000, 0 ) );
+
+    std::vector<uint8_t> pattern;
+    for( size_t i = 0; i < 5000; i++ ){
+        pattern.push_back( static_cast<uint8_t>( ( i % 37 ) * 3 ) );
+    }
+    inputs.push_back( pattern );
+
+    std::vector<uint8_t> noise;
+    uint32_t state = 12345;
+    for( size_t i = 0; i < 4000; i++ ){
+        state = state * 1103515245u + 12345u;
+        noise.push_back( static_cast<uint8_t>( state >> 24 ) );
+    }
+    inputs.push_back( noise );
+
+    for( const auto& input : inputs ){
+        std::vector<uint8_t> compressed;
+        core::lz_compress( input, compressed );
+
+        std::vector<uint8_t> output( input.size() );
+        core::lz_decompress( compressed, output );
+        ASSERT_EQ( output, input );
+    }
+
+    std::vector<uint8_t> compressed;
+    core::lz_compress( inputs[2], compressed );
+    ASSERT_LT( compressed.size(), 500u );
+}
+
+/**
+ * Corrupt or mis-sized streams are rejected
+ */
+TEST( core_LZ_Codec, reject_corrupt )
+{
+    std::vector<uint8_t> input( 1000, 7 );
+    std::vector<uint8_t> compressed;
+    core::lz_compress( input, compressed );
+
+    std::vector<uint8_t> too_small( input.size() - 1 );
+    ASSERT_THROW( core::lz_decompress( compressed, too_small ), std::runtime_error );
+
+    std::vector<uint8_t> too_large( input.size() + 1 );
+    ASSERT_THROW( core::lz_decompress( compressed, too_large ), std::runtime_error );
+
+    // A match reaching back before the start of the output
+    std::vector<uint8_t> bad_offset { 0x10, 0xAA, 0x05, 0x00 };
+    std::vector<uint8_t> output( 5 );
+    ASSERT_THROW( core::lz_decompress( bad_offset, output ), std::runtime_error );
+}
@@ -0,0 +1,99 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Resource_Bundle.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Resource Bundle API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <filesystem>
+#include <fstream>
+
+// Project Libraries
+#include <terminus/core/Resource_Bundle.hpp>
+#include <terminus/image/Frame_File.hpp>
+
+using namespace tmns;
+
+/**
+ * Every packed entry can be found by name and nothing else can
+ */
+TEST( core_Resource_Bundle, pack_and_find )
+{
+    std::map<std::string,std::vector<uint8_t>> entries;
+    for( int i = 0; i < 500; i++ ){
+        entries["images/test/entry_" + std::to_string( i ) + ".png"] = std::vector<uint8_t>( static_cast<size_t>( i % 7 ),
+                                                                                           static_cast<uint8_t>( i ) );
+    }
+
+    auto buffer = core::Resource_Bundle::pack( entries );
+    auto bundle = core::Resource_Bundle::from_buffer( buffer, nullptr );
+    ASSERT_EQ( bundle->size(), entries.size() );
+
+    for( const auto& [name, data] : entries ){
+        auto blob = bundle->find( name );
+        ASSERT_TRUE( blob.has_value() ) << name;
+        ASSERT_EQ( std::vector<uint8_t>( blob->begin(), blob->end() ), data );
+        ASSERT_EQ( reinterpret_cast<uintptr_t>( blob->data() ) % core::Resource_Bundle::DATA_ALIGNMENT,
+                   reinterpret_cast<uintptr_t>( buffer.data() ) % core::Resource_Bundle::DATA_ALIGNMENT );
+    }
+    ASSERT_FALSE( bundle->contains( "images/test/entry_500.png" ) );
+    ASSERT_FALSE( bundle->contains( "" ) );
+}
+
+/**
+ * Frames inside a memory-mapped bundle are zero-copy
+ */
+TEST( core_Resource_Bundle, mapped_frames )
+{
+    img::Frame frame( img::Dimensions( 4, 3, 4 ) );
+    frame.set_pixel( 1, 2, math::Vector4u( { 1, 2, 3, 4 } ) );
+
+    std::map<std::string,std::vector<uint8_t>> entries;
+    entries["images/logo/test.png"] = img::encode_frame_file( frame, img::FrameCompression::NONE );
+    auto buffer = core::Resource_Bundle::pack( entries );
+
+    auto path = std::filesystem::temp_directory_path() / "TEST_Resource_Bundle.tbdl";
+    {
+        std::ofstream fout( path, std::ios::binary );
+        fout.write( reinterpret_cast<const char*>( buffer.data() ), static_cast<std::streamsize>( buffer.size() ) );
+    }
+
+    img::Frame::ptr_t loaded;
+    {
+        auto bundle = core::Resource_Bundle::open( path );
+        loaded = img::frame_from_buffer( bundle->find( "images/logo/test.png" ).value(), bundle );
+    }
+
+    // The frame keeps the mapping alive after the bundle goes out of scope
+    ASSERT_TRUE( loaded->is_external() );
+    ASSERT_EQ( loaded->get_pixel( 1, 2, 0 ), 1 );
+    ASSERT_EQ( loaded->get_pixel( 1, 2, 3 ), 4 );
+
+    std::filesystem::remove( path );
+}
+
+/**
+ * Truncated bundles are rejected
+ */
+TEST( core_Resource_Bundle, reject_invalid )
+{
+    std::map<std::string,std::vector<uint8_t>> entries;
+    entries["a"] = std::vector<uint8_t>( 100, 1 );
+    auto buffer = core::Resource_Bundle::pack( entries );
+    buffer.resize( buffer.size() - 64 );
+
+    ASSERT_THROW( core::Resource_Bundle::from_buffer( buffer, nullptr ), std::runtime_error );
+    ASSERT_THROW( core::Resource_Bundle::from_buffer( std::vector<uint8_t>( 8, 0 ), nullptr ), std::runtime_error );
+}
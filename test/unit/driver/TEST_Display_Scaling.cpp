@@ -0,0 +1,67 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Display_Scaling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Display Scaling Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/driver/Display_Scaling.hpp>
+
+using namespace tmns;
+
+/**
+ * Integer scaling uses the largest whole multiple and centers the result
+ */
+TEST( drv_Display_Scaling, integer_letterbox )
+{
+    // 320x320 in a 1280x700 window fits twice, with bars on the sides
+    auto viewport = drv::present_viewport( math::Size2i( { 320, 320 } ),
+                                           math::Size2i( { 1280, 700 } ),
+                                           drv::Scale_Mode::INTEGER );
+    ASSERT_EQ( viewport.width(), 640 );
+    ASSERT_EQ( viewport.height(), 640 );
+    ASSERT_EQ( viewport.bl().x(), 320 );
+    ASSERT_EQ( viewport.bl().y(), 30 );
+
+    // Too small for a whole multiple, so it fits instead
+    viewport = drv::present_viewport( math::Size2i( { 320, 320 } ),
+                                      math::Size2i( { 200, 100 } ),
+                                      drv::Scale_Mode::INTEGER );
+    ASSERT_EQ( viewport.width(), 100 );
+    ASSERT_EQ( viewport.height(), 100 );
+    ASSERT_EQ( viewport.bl().x(), 50 );
+}
+
+/**
+ * Fitting keeps the aspect ratio, and stretching fills the window
+ */
+TEST( drv_Display_Scaling, fit_and_stretch )
+{
+    auto viewport = drv::present_viewport( math::Size2i( { 320, 240 } ),
+                                           math::Size2i( { 1000, 1000 } ),
+                                           drv::Scale_Mode::FIT );
+    ASSERT_EQ( viewport.width(), 1000 );
+    ASSERT_EQ( viewport.height(), 750 );
+    ASSERT_EQ( viewport.bl().y(), 125 );
+
+    viewport = drv::present_viewport( math::Size2i( { 320, 240 } ),
+                                      math::Size2i( { 1000, 1000 } ),
+                                      drv::Scale_Mode::STRETCH );
+    ASSERT_EQ( viewport.width(), 1000 );
+    ASSERT_EQ( viewport.height(), 1000 );
+
+    ASSERT_EQ( drv::scale_mode_from_string( "Fit" ), drv::Scale_Mode::FIT );
+    ASSERT_THROW( drv::scale_mode_from_string( "zoom" ), std::runtime_error );
+}
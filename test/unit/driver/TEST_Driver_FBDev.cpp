@@ -0,0 +1,113 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Driver_FBDev.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Framebuffer Driver Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/driver/DriverFBDev.hpp>
+
+// C++ Standard Libraries
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace tmns;
+
+namespace {
+
+/**
+ * Read back everything written to the stand-in framebuffer
+ */
+std::vector<uint8_t> read_file( const std::filesystem::path& path )
+{
+    std::ifstream fin( path, std::ios::binary );
+    return std::vector<uint8_t>( std::istreambuf_iterator<char>( fin ), std::istreambuf_iterator<char>() );
+}
+
+} // End of anonymous namespace
+
+/**
+ * Only changed rows reach a regular file standing in for /dev/fb0
+ */
+TEST( drv_Driver_FBDev, damaged_rows_only )
+{
+    auto dir         = std::filesystem::temp_directory_path();
+    auto device_path = dir / "TEST_Driver_FBDev.fb";
+    auto config_path = dir / "TEST_Driver_FBDev.cfg";
+    std::filesystem::remove( device_path );
+    std::ofstream( device_path ).close();
+    {
+        std::ofstream fout( config_path );
+        fout << "[display]" << std::endl;
+        fout << "screen_width=16" << std::endl;
+        fout << "screen_height=8" << std::endl;
+        fout << "[fbdev]" << std::endl;
+        fout << "device=" << device_path.native() << std::endl;
+        fout << "format=rgb565" << std::endl;
+    }
+
+    std::string arg0( "TEST_Driver_FBDev" ), arg1( "-c" ), arg2( config_path.native() );
+    char* argv[] = { arg0.data(), arg1.data(), arg2.data() };
+    auto config  = core::Options::parse( 3, argv );
+
+    auto driver = drv::Driver_FBDev::create( config );
+    ASSERT_EQ( driver->pixel_format(), img::PixelFormat::RGB565 );
+    ASSERT_EQ( driver->stride(), 32u );
+    ASSERT_EQ( driver->get_screen_dimensions().cols(), 16u );
+    ASSERT_EQ( std::filesystem::file_size( device_path ), 256u );
+
+    auto caps = driver->capabilities();
+    ASSERT_EQ( caps.native_formats, std::vector<img::PixelFormat>( { img::PixelFormat::RGB565 } ) );
+    ASSERT_FALSE( caps.is_native( img::PixelFormat::RGBA ) );
+    ASSERT_TRUE( caps.partial_updates );
+    ASSERT_TRUE( caps.threaded_show );
+    ASSERT_EQ( caps.row_alignment, 32u );
+    ASSERT_FALSE( caps.fits( math::Size2i( { 17, 8 } ) ) );
+
+    // The first frame is written in full
+    img::Frame frame;
+    frame.resize( driver->get_screen_dimensions(), 255 );
+    driver->show( frame );
+    ASSERT_EQ( driver->rows_written(), 8u );
+    for( auto value : read_file( device_path ) ){
+        ASSERT_EQ( value, 0xFF );
+    }
+
+    // One red pixel only rewrites its row
+    uint8_t* pixel = frame.data() + ( 3 * 16 + 2 ) * 4;
+    pixel[1] = 0;
+    pixel[2] = 0;
+    driver->show( frame );
+    ASSERT_EQ( driver->rows_written(), 1u );
+
+    auto contents = read_file( device_path );
+    ASSERT_EQ( contents[3 * 32 + 4], 0x00 );
+    ASSERT_EQ( contents[3 * 32 + 5], 0xF8 );
+    ASSERT_EQ( contents[3 * 32 + 6], 0xFF );
+
+    // Nothing changed, nothing written
+    driver->show( frame );
+    ASSERT_EQ( driver->rows_written(), 0u );
+
+    auto text = driver->rasterize_text( "Terminus" );
+    ASSERT_EQ( text->channels(), 4u );
+    ASSERT_GT( text->cols(), 0u );
+
+    ASSERT_EQ( driver->finalize(), 0 );
+    std::filesystem::remove( device_path );
+    std::filesystem::remove( config_path );
+}
@@ -0,0 +1,190 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Driver_Remote.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Remote Display Driver Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/driver/DriverRemote.hpp>
+#include <terminus/driver/Remote_Client.hpp>
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+
+// POSIX Libraries
+#include <sys/socket.h>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * Let the server and the viewer trade messages until a condition holds
+ */
+bool exchange_until( drv::Driver_Remote&          server,
+                     drv::Remote_Client&          client,
+                     const std::function<bool()>& done )
+{
+    for( int attempt = 0; attempt < 200; attempt++ ){
+        server.okay_to_run();
+        client.poll( 5ms );
+        if( done() ){
+            return true;
+        }
+    }
+    return false;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Addresses parse in both forms, and anything else is refused
+ */
+TEST( drv_Remote_Protocol, parse_endpoint )
+{
+    auto endpoint = drv::Remote_Endpoint::parse( "tcp:0.0.0.0:5900" );
+    ASSERT_EQ( endpoint.kind, drv::Remote_Endpoint::Kind::TCP );
+    ASSERT_EQ( endpoint.address, "0.0.0.0" );
+    ASSERT_EQ( endpoint.port, 5900 );
+
+    endpoint = drv::Remote_Endpoint::parse( "unix:/tmp/terminus.sock" );
+    ASSERT_EQ( endpoint.kind, drv::Remote_Endpoint::Kind::UNIX );
+    ASSERT_EQ( endpoint.to_string(), "unix:/tmp/terminus.sock" );
+
+    ASSERT_THROW( drv::Remote_Endpoint::parse( "udp:host:1" ), std::runtime_error );
+    ASSERT_THROW( drv::Remote_Endpoint::parse( "tcp:host:70000" ), std::runtime_error );
+}
+
+/**
+ * Messages come out whole and in order, however the bytes arrive
+ */
+TEST( drv_Remote_Protocol, split_messages )
+{
+    int fds[2];
+    ASSERT_EQ( ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds ), 0 );
+    drv::Remote_Connection sender( fds[0] );
+    drv::Remote_Connection receiver( fds[1] );
+
+    // Many messages in one read
+    for( uint8_t i = 0; i < 100; i++ ){
+        const uint8_t payload[drv::Remote_Protocol::INPUT_BYTES] { i, 0, 0 };
+        sender.send( drv::Remote_Message::INPUT, payload );
+    }
+    ASSERT_TRUE( sender.flush() );
+    ASSERT_TRUE( receiver.receive() );
+
+    drv::Remote_Message  type;
+    std::vector<uint8_t> payload;
+    for( uint8_t i = 0; i < 100; i++ ){
+        ASSERT_TRUE( receiver.next_message( type, payload ) );
+        ASSERT_EQ( type, drv::Remote_Message::INPUT );
+        ASSERT_EQ( payload[0], i );
+    }
+    ASSERT_FALSE( receiver.next_message( type, payload ) );
+
+    // One message split part way through its header
+    const uint8_t message[] { static_cast<uint8_t>( drv::Remote_Message::INPUT ), 3, 0, 0, 0, 7, 8, 9 };
+    ASSERT_EQ( ::send( fds[0], message, 2, 0 ), 2 );
+    ASSERT_TRUE( receiver.receive() );
+    ASSERT_FALSE( receiver.next_message( type, payload ) );
+
+    ASSERT_EQ( ::send( fds[0], message + 2, sizeof( message ) - 2, 0 ), static_cast<ssize_t>( sizeof( message ) - 2 ) );
+    ASSERT_TRUE( receiver.receive() );
+    ASSERT_TRUE( receiver.next_message( type, payload ) );
+    ASSERT_EQ( payload, std::vector<uint8_t>( { 7, 8, 9 } ) );
+}
+
+/**
+ * A server refuses oversized messages from their header, without waiting for the body
+ */
+TEST( drv_Remote_Protocol, viewer_payload_limit )
+{
+    int fds[2];
+    ASSERT_EQ( ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds ), 0 );
+    drv::Remote_Connection viewer( fds[0] );
+    drv::Remote_Connection server( fds[1], drv::Remote_Protocol::MAX_VIEWER_PAYLOAD_BYTES );
+
+    const uint8_t input[drv::Remote_Protocol::INPUT_BYTES] { 1, 2, 0 };
+    viewer.send( drv::Remote_Message::INPUT, input );
+    viewer.send( drv::Remote_Message::KEYFRAME, {} );
+    ASSERT_TRUE( viewer.flush() );
+
+    drv::Remote_Message  type;
+    std::vector<uint8_t> payload;
+    ASSERT_TRUE( server.receive() );
+    ASSERT_TRUE( server.next_message( type, payload ) );
+    ASSERT_TRUE( server.next_message( type, payload ) );
+    ASSERT_EQ( type, drv::Remote_Message::KEYFRAME );
+
+    // Only the header of a 1 MB message has been sent
+    const uint8_t header[] { static_cast<uint8_t>( drv::Remote_Message::INPUT ), 0, 0, 0x10, 0 };
+    ASSERT_EQ( ::send( fds[0], header, sizeof( header ), 0 ), static_cast<ssize_t>( sizeof( header ) ) );
+    ASSERT_TRUE( server.receive() );
+    ASSERT_THROW( server.next_message( type, payload ), std::runtime_error );
+}
+
+/**
+ * A viewer gets a keyframe, then only changes, and its keys reach the application
+ */
+TEST( drv_Driver_Remote, serve_frames_and_input )
+{
+    auto endpoint = drv::Remote_Endpoint::parse( "unix:" + ( std::filesystem::temp_directory_path() /
+                                                             "TEST_Driver_Remote.sock" ).native() );
+    drv::Driver_Remote server( nullptr, img::Dimensions( 32, 16, 4 ), endpoint, drv::Driver_Remote::Limits() );
+    ASSERT_FALSE( server.capabilities().threaded_show );
+
+    auto client = drv::Remote_Client::connect( endpoint );
+    ASSERT_TRUE( exchange_until( server, *client, [&]{ return server.client_count() == 1; } ) );
+
+    // The first frame arrives whole
+    img::Frame frame;
+    frame.resize( server.get_screen_dimensions(), 255 );
+    server.show( frame );
+    ASSERT_TRUE( exchange_until( server, *client, [&]{ return client->has_frame(); } ) );
+    ASSERT_TRUE( std::ranges::equal( client->frame().pixels(), frame.pixels() ) );
+    const size_t keyframe_bytes = client->bytes_received();
+
+    // A single pixel change sends far less
+    frame.data()[( 5 * 32 + 7 ) * 4] = 0;
+    server.show( frame );
+    ASSERT_TRUE( exchange_until( server, *client, [&]{ return client->frames_received() == 2; } ) );
+    ASSERT_TRUE( std::ranges::equal( client->frame().pixels(), frame.pixels() ) );
+    ASSERT_LT( client->bytes_received() - keyframe_bytes, keyframe_bytes );
+
+    // An unchanged frame sends nothing
+    server.show( frame );
+    ASSERT_EQ( server.stats().frames_sent, 2u );
+
+    // Keys come back to the application
+    client->send_key( drv::Input_Action::PRESS, drv::Key::UP );
+    ASSERT_TRUE( exchange_until( server, *client, [&]{ return server.input_pending(); } ) );
+    auto events = server.take_input_events();
+    ASSERT_EQ( events.size(), 1u );
+    ASSERT_EQ( events[0].key, drv::Key::UP );
+    ASSERT_EQ( events[0].action, drv::Input_Action::PRESS );
+    ASSERT_FALSE( server.input_pending() );
+
+    // Viewers can leave at any time
+    client.reset();
+    for( int attempt = 0; attempt < 200 && server.client_count() > 0; attempt++ ){
+        server.okay_to_run();
+    }
+    ASSERT_EQ( server.client_count(), 0u );
+    ASSERT_EQ( server.finalize(), 0 );
+    ASSERT_FALSE( std::filesystem::exists( endpoint.address ) );
+}
@@ -0,0 +1,133 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Driver_Replay.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Input Recording and Replay Driver Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/driver/DriverReplay.hpp>
+
+// C++ Standard Libraries
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+/**
+ * Events come back in order with their frames, and a recording cut short still reads
+ */
+TEST( drv_Input_Recording, round_trip )
+{
+    auto path = std::filesystem::temp_directory_path() / "TEST_Input_Recording.tinp";
+    {
+        auto writer = drv::Input_Recording_Writer::create( path, "[display]\nscreen_width=16\n" );
+        writer->write( { 3, 1500us, drv::Input_Action::PRESS,   drv::Key::DOWN } );
+        writer->write( { 3, 1600us, drv::Input_Action::PRESS,   drv::Key( 'A' ) } );
+        writer->write( { 7, 9000us, drv::Input_Action::RELEASE, drv::Key::DOWN } );
+    }
+
+    // No closing record yet
+    auto reader = drv::Input_Recording_Reader::open( path );
+    ASSERT_EQ( reader->config_text(), "[display]\nscreen_width=16\n" );
+    ASSERT_EQ( reader->records().size(), 3u );
+    ASSERT_FALSE( reader->frame_count().has_value() );
+    ASSERT_EQ( reader->records()[1].frame, 3u );
+    ASSERT_EQ( reader->records()[1].timestamp, 1600us );
+    ASSERT_EQ( reader->records()[1].key, drv::Key( 'A' ) );
+    ASSERT_EQ( reader->records()[2].action, drv::Input_Action::RELEASE );
+
+    {
+        auto writer = drv::Input_Recording_Writer::create( path, "" );
+        writer->write( { 1, 0us, drv::Input_Action::REPEAT, drv::Key::ENTER } );
+        writer->finish( 12 );
+    }
+    reader = drv::Input_Recording_Reader::open( path );
+    ASSERT_EQ( reader->records().size(), 1u );
+    ASSERT_EQ( reader->frame_count().value(), 12u );
+
+    // Anything else is refused
+    std::ofstream( path ) << "not a recording";
+    ASSERT_THROW( drv::Input_Recording_Reader::open( path ), std::runtime_error );
+    std::filesystem::remove( path );
+}
+
+/**
+ * A headless replay delivers each event on its recorded frame, then stops
+ */
+TEST( drv_Driver_Replay, headless_replay )
+{
+    auto dir         = std::filesystem::temp_directory_path();
+    auto input_path  = dir / "TEST_Driver_Replay.tinp";
+    auto report_path = dir / "TEST_Driver_Replay.csv";
+    auto config_path = dir / "TEST_Driver_Replay.cfg";
+    {
+        auto writer = drv::Input_Recording_Writer::create( input_path, "[display]\nscreen_width=32\n" );
+        writer->write( { 2, 0us, drv::Input_Action::PRESS,   drv::Key::LEFT } );
+        writer->write( { 4, 0us, drv::Input_Action::RELEASE, drv::Key::LEFT } );
+        writer->finish( 5 );
+    }
+    {
+        std::ofstream fout( config_path );
+        fout << "[display]" << std::endl;
+        fout << "screen_width=16" << std::endl;
+        fout << "screen_height=8" << std::endl;
+        fout << "[input]" << std::endl;
+        fout << "replay_report=" << report_path.native() << std::endl;
+        fout << "frame_budget_us=10000000" << std::endl;
+    }
+
+    std::string arg0( "TEST_Driver_Replay" ), arg1( "-c" ), arg2( config_path.native() );
+    std::string arg3( "--replay-input" ), arg4( input_path.native() );
+    char* argv[] = { arg0.data(), arg1.data(), arg2.data(), arg3.data(), arg4.data() };
+    auto config  = core::Options::parse( 5, argv );
+
+    auto driver = drv::Driver_Replay::create( config, nullptr );
+    ASSERT_EQ( driver->mode(), drv::Replay_Mode::REPLAY );
+    ASSERT_EQ( driver->get_screen_dimensions().cols(), 16u );
+    ASSERT_FALSE( driver->capabilities().threaded_show );
+    ASSERT_EQ( driver->rasterize_text( "abc" )->cols(), 3 * drv::Driver_Replay::HEADLESS_GLYPH_COLS );
+
+    img::Frame frame;
+    frame.resize( driver->get_screen_dimensions(), 255 );
+
+    std::vector<size_t> events_per_frame;
+    while( driver->okay_to_run() ){
+        auto events = driver->take_input_events();
+        events_per_frame.push_back( events.size() );
+        if( driver->frame() == 2 ){
+            ASSERT_EQ( events[0].key, drv::Key::LEFT );
+            ASSERT_EQ( events[0].action, drv::Input_Action::PRESS );
+        }
+        ASSERT_TRUE( driver->wait_for_input( std::chrono::steady_clock::now() + 1h, 1ms ) );
+        driver->show( frame );
+    }
+    ASSERT_EQ( events_per_frame, std::vector<size_t>( { 0, 1, 0, 1, 0 } ) );
+    ASSERT_EQ( driver->frame_times().size(), 5u );
+    ASSERT_EQ( driver->finalize(), 0 );
+
+    // Header plus one row per frame
+    std::ifstream fin( report_path );
+    size_t lines = 0;
+    for( std::string line; std::getline( fin, line ); ){
+        lines++;
+    }
+    ASSERT_EQ( lines, 6u );
+
+    std::filesystem::remove( input_path );
+    std::filesystem::remove( report_path );
+    std::filesystem::remove( config_path );
+}
@@ -0,0 +1,143 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Driver_SPI_Sim.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details SPI Panel Simulator Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/driver/DriverSPISim.hpp>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * A bus where every byte takes one microsecond and nothing else costs anything
+ */
+drv::SPI_Bus_Config simple_bus( drv::SPI_Update_Mode mode )
+{
+    drv::SPI_Bus_Config bus;
+    bus.clock_hz         = 8'000'000;
+    bus.command_overhead = 0ns;
+    bus.dma_setup        = 0ns;
+    bus.update_mode      = mode;
+    return bus;
+}
+
+/**
+ * Set one RGBA pixel
+ */
+void set_pixel( img::Frame& frame, size_t col, size_t row, uint8_t r, uint8_t g, uint8_t b )
+{
+    uint8_t* pixel = frame.data() + ( row * frame.cols() + col ) * 4;
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Only the changed bands are sent, trimmed to the changed columns
+ */
+TEST( drv_Driver_SPI_Sim, damage_rects )
+{
+    drv::Driver_SPI_Sim driver( nullptr, img::Dimensions( 32, 16, 4 ), simple_bus( drv::SPI_Update_Mode::RECTS ) );
+
+    img::Frame frame;
+    frame.resize( driver.get_screen_dimensions(), 255 );
+
+    // Nothing to compare against, so everything goes
+    driver.show( frame );
+    ASSERT_EQ( driver.last_transfer().rects, 1u );
+    ASSERT_EQ( driver.last_transfer().pixel_bytes, 32u * 16u * 2u );
+    ASSERT_EQ( driver.last_transfer().duration, std::chrono::microseconds( 11 + 32 * 16 * 2 ) );
+
+    // Two neighbouring rows make one band covering both changed columns
+    set_pixel( frame, 5, 3, 0, 0, 0 );
+    set_pixel( frame, 9, 4, 0, 0, 0 );
+    driver.show( frame );
+    ASSERT_EQ( driver.last_rects().size(), 1u );
+    ASSERT_EQ( driver.last_rects()[0].col, 5u );
+    ASSERT_EQ( driver.last_rects()[0].row, 3u );
+    ASSERT_EQ( driver.last_rects()[0].cols, 5u );
+    ASSERT_EQ( driver.last_rects()[0].rows, 2u );
+    ASSERT_EQ( driver.last_transfer().pixel_bytes, 20u );
+    ASSERT_EQ( driver.last_transfer().commands, 3u );
+
+    // Separated rows make separate windows
+    set_pixel( frame, 0, 1, 1, 2, 3 );
+    set_pixel( frame, 31, 10, 1, 2, 3 );
+    driver.show( frame );
+    ASSERT_EQ( driver.last_transfer().rects, 2u );
+    ASSERT_EQ( driver.last_transfer().pixel_bytes, 4u );
+
+    // An unchanged frame costs nothing
+    driver.show( frame );
+    ASSERT_EQ( driver.last_transfer().rects, 0u );
+    ASSERT_EQ( driver.last_transfer().duration, 0ns );
+    ASSERT_EQ( driver.stats().shows, 4u );
+}
+
+/**
+ * Row bands span the full width, and a full update always sends everything
+ */
+TEST( drv_Driver_SPI_Sim, rows_and_full )
+{
+    drv::Driver_SPI_Sim rows( nullptr, img::Dimensions( 32, 16, 4 ), simple_bus( drv::SPI_Update_Mode::ROWS ) );
+    drv::Driver_SPI_Sim full( nullptr, img::Dimensions( 32, 16, 4 ), simple_bus( drv::SPI_Update_Mode::FULL ) );
+
+    img::Frame frame;
+    frame.resize( rows.get_screen_dimensions(), 255 );
+    rows.show( frame );
+    full.show( frame );
+
+    set_pixel( frame, 5, 3, 0, 0, 0 );
+    rows.show( frame );
+    full.show( frame );
+    ASSERT_EQ( rows.last_transfer().pixel_bytes, 64u );
+    ASSERT_EQ( full.last_transfer().pixel_bytes, 1024u );
+
+    full.show( frame );
+    ASSERT_EQ( full.last_transfer().pixel_bytes, 1024u );
+
+    // Only the banded modes report partial updates.  Headless, any thread may present.
+    ASSERT_TRUE( rows.capabilities().partial_updates );
+    ASSERT_FALSE( full.capabilities().partial_updates );
+    ASSERT_TRUE( full.capabilities().threaded_show );
+    ASSERT_EQ( full.capabilities().native_formats, std::vector<img::PixelFormat>( { img::PixelFormat::RGB565 } ) );
+}
+
+/**
+ * The panel shows the frame after the round trip through the wire format
+ */
+TEST( drv_Driver_SPI_Sim, panel_quantization )
+{
+    drv::Driver_SPI_Sim driver( nullptr, img::Dimensions( 4, 4, 4 ), simple_bus( drv::SPI_Update_Mode::RECTS ) );
+
+    img::Frame frame;
+    frame.resize( driver.get_screen_dimensions(), 255 );
+    set_pixel( frame, 2, 1, 13, 200, 77 );
+    driver.show( frame );
+
+    const uint8_t* pixel = driver.panel().pixels().data() + ( 1 * 4 + 2 ) * 4;
+    ASSERT_EQ( pixel[0], 8 );
+    ASSERT_EQ( pixel[1], 203 );
+    ASSERT_EQ( pixel[2], 74 );
+
+    ASSERT_EQ( drv::spi_update_mode_from_string( "rows" ), drv::SPI_Update_Mode::ROWS );
+    ASSERT_THROW( drv::spi_update_mode_from_string( "some" ), std::runtime_error );
+}
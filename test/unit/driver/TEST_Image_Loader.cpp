@@ -0,0 +1,97 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Image_Loader.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Image_Loader Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/driver/Image_Loader.hpp>
+
+// C++ Standard Libraries
+#include <atomic>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+/**
+ * Requests for the same path share one load, and each path gets its own frame
+ */
+TEST( drv_Image_Loader, deduplicates_in_flight )
+{
+    std::atomic<bool>   release { false };
+    std::atomic<size_t> loads { 0 };
+    drv::Image_Loader loader( [&]( const std::filesystem::path& path ){
+                                  while( !release.load() ){
+                                      std::this_thread::sleep_for( 1ms );
+                                  }
+                                  loads++;
+                                  auto frame = std::make_shared<img::Frame>();
+                                  frame->resize( img::Dimensions( path.string().size(), 1, 4 ), 0 );
+                                  return frame;
+                              },
+                              2 );
+
+    auto a1 = loader.load( "a.png" );
+    auto a2 = loader.load( "a.png" );
+    auto bb = loader.load( "bb.png" );
+    ASSERT_EQ( loader.in_flight(), 2u );
+    ASSERT_NE( a1.wait_for( 0s ), std::future_status::ready );
+
+    release.store( true );
+    ASSERT_EQ( a1.get(), a2.get() );
+    ASSERT_EQ( a1.get()->cols(), 5u );
+    ASSERT_EQ( bb.get()->cols(), 6u );
+    loader.stop();
+
+    auto stats = loader.stats();
+    ASSERT_EQ( loads.load(), 2u );
+    ASSERT_EQ( stats.requested, 3u );
+    ASSERT_EQ( stats.deduplicated, 1u );
+    ASSERT_EQ( stats.loaded, 2u );
+    ASSERT_EQ( loader.in_flight(), 0u );
+}
+
+/**
+ * Load errors reach the caller, and stopping fails whatever is still queued
+ */
+TEST( drv_Image_Loader, failures_and_stop )
+{
+    std::atomic<bool> started { false };
+    std::atomic<bool> release { false };
+    drv::Image_Loader loader( [&]( const std::filesystem::path& path ) -> img::Frame::ptr_t {
+                                  started.store( true );
+                                  while( !release.load() ){
+                                      std::this_thread::sleep_for( 1ms );
+                                  }
+                                  throw std::runtime_error( "Unable to load image: " + path.string() );
+                              },
+                              1 );
+
+    auto first  = loader.load( "missing.png" );
+    auto queued = loader.load( "queued.png" );
+
+    // Stop while the first load is running and the second is queued
+    while( !started.load() ){
+        std::this_thread::sleep_for( 1ms );
+    }
+    release.store( true );
+    loader.stop();
+
+    ASSERT_THROW( first.get(), std::runtime_error );
+    ASSERT_THROW( queued.get(), std::runtime_error );
+    ASSERT_THROW( loader.load( "late.png" ).get(), std::runtime_error );
+    ASSERT_EQ( loader.stats().failed, 3u );
+    ASSERT_EQ( loader.stats().loaded, 0u );
+}
@@ -0,0 +1,114 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Composite.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Compositing API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <array>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Composite.hpp>
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_View.hpp>
+
+using namespace tmns;
+
+namespace {
+
+/// Deterministic pixel noise covering every byte value
+std::vector<uint8_t> make_pixels( size_t bytes )
+{
+    std::vector<uint8_t> pixels( bytes );
+    uint32_t state = 12345;
+    for( auto& value : pixels ){
+        state = state * 1103515245u + 12345u;
+        value = static_cast<uint8_t>( state >> 16 );
+    }
+    return pixels;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Vector kernels match the per-pixel formula, with and without opacity
+ */
+TEST( img_Composite, matches_reference )
+{
+    for( size_t count = 0; count < 40; count++ ){
+        auto src = make_pixels( count * 4 );
+        img::premultiply_alpha( src.data(), count );
+        for( unsigned opacity : { 255u, 200u, 0u } ){
+            auto dst = make_pixels( count * 4 + 7 );
+            dst.resize( count * 4 );
+            auto expected = dst;
+
+            img::composite_row( dst.data(), src.data(), count, static_cast<uint8_t>( opacity ) );
+            for( size_t i = 0; i < count * 4; i += 4 ){
+                const unsigned alpha = img::multiply_255( src[i+3], opacity );
+                for( size_t c = 0; c < 4; c++ ){
+                    const unsigned value = static_cast<unsigned>( img::multiply_255( src[i+c], opacity ) ) +
+                                           img::multiply_255( expected[i+c], 255u - alpha );
+                    ASSERT_EQ( dst[i+c], std::min( 255u, value ) ) << "pixel " << i / 4 << " opacity " << opacity;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Straight and premultiplied sources blend to the same result, and views fade them
+ */
+TEST( img_Composite, blend_views )
+{
+    img::Frame straight( img::Dimensions( 3, 1, 4 ) );
+    straight.set_pixel( 0, 0, math::Vector4u( { 255, 0, 0, 255 } ) );
+    straight.set_pixel( 1, 0, math::Vector4u( { 255, 0, 0, 128 } ) );
+    straight.set_pixel( 2, 0, math::Vector4u( { 255, 0, 0, 0 } ) );
+
+    img::Frame premultiplied( straight );
+    img::premultiply_alpha( premultiplied.data(), 3 );
+    premultiplied.set_premultiplied( true );
+
+    for( const img::Frame* source : { &straight, &premultiplied } ){
+        img::Frame target( img::Dimensions( 3, 1, 4 ) );
+        target.set_all_pixels( math::Vector4u( { 0, 0, 255, 255 } ) );
+        img::Frame_View( target ).copy( *source, img::CopyPolicy::BLEND );
+
+        const std::array<std::array<int,4>,3> expected {{ { 255, 0, 0, 255 },
+                                                          { 128, 0, 127, 255 },
+                                                          { 0, 0, 255, 255 } }};
+        for( size_t x = 0; x < 3; x++ ){
+            for( size_t c = 0; c < 4; c++ ){
+                ASSERT_EQ( target.get_pixel( x, 0, c ), expected[x][c] ) << "pixel " << x << " channel " << c;
+            }
+        }
+    }
+
+    // Opacity is inherited by subviews
+    img::Frame target( img::Dimensions( 3, 1, 4 ) );
+    img::Frame_View view( target );
+    view.set_opacity( 0 );
+    view.subview( math::Rect2i( 0, 0, 3, 1 ) ).copy( premultiplied, img::CopyPolicy::BLEND );
+    ASSERT_EQ( target.get_pixel( 0, 0, 3 ), 0 );
+
+    view.set_opacity( 128 );
+    auto half = view.subview( math::Rect2i( 0, 0, 3, 1 ) );
+    ASSERT_EQ( half.opacity(), 128 );
+    half.copy( premultiplied, img::CopyPolicy::BLEND );
+    ASSERT_EQ( target.get_pixel( 0, 0, 0 ), 128 );
+    ASSERT_EQ( target.get_pixel( 0, 0, 3 ), 128 );
+}
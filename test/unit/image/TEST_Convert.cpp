@@ -0,0 +1,190 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Convert.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Pixel Conversion API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Convert.hpp>
+
+using namespace tmns;
+
+namespace {
+
+/// Deterministic pixel noise covering every byte value
+std::vector<uint8_t> make_pixels( size_t bytes )
+{
+    std::vector<uint8_t> pixels( bytes );
+    uint32_t state = 12345;
+    for( auto& value : pixels ){
+        state = state * 1103515245u + 12345u;
+        value = static_cast<uint8_t>( state >> 16 );
+    }
+    return pixels;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Vector kernels match a per-pixel reference for lengths around every block size
+ */
+TEST( img_Convert, to_rgba_matches_reference )
+{
+    for( size_t count = 0; count < 70; count++ ){
+        // BGR
+        auto bgr = make_pixels( count * 3 );
+        std::vector<uint8_t> rgba( count * 4 );
+        img::convert_row( bgr.data(), img::PixelFormat::BGR, rgba.data(), img::PixelFormat::RGBA, count );
+        for( size_t i = 0; i < count; i++ ){
+            ASSERT_EQ( rgba[4*i+0], bgr[3*i+2] );
+            ASSERT_EQ( rgba[4*i+1], bgr[3*i+1] );
+            ASSERT_EQ( rgba[4*i+2], bgr[3*i+0] );
+            ASSERT_EQ( rgba[4*i+3], 255 );
+        }
+
+        // Gray
+        auto gray = make_pixels( count );
+        img::convert_row( gray.data(), img::PixelFormat::GRAY, rgba.data(), img::PixelFormat::RGBA, count );
+        for( size_t i = 0; i < count; i++ ){
+            ASSERT_EQ( rgba[4*i+0], gray[i] );
+            ASSERT_EQ( rgba[4*i+2], gray[i] );
+            ASSERT_EQ( rgba[4*i+3], 255 );
+        }
+
+        // Gray + Alpha
+        auto gray_alpha = make_pixels( count * 2 );
+        img::convert_row( gray_alpha.data(), img::PixelFormat::GRAY_ALPHA, rgba.data(), img::PixelFormat::RGBA, count );
+        for( size_t i = 0; i < count; i++ ){
+            ASSERT_EQ( rgba[4*i+1], gray_alpha[2*i] );
+            ASSERT_EQ( rgba[4*i+3], gray_alpha[2*i+1] );
+        }
+
+        // BGRA
+        auto bgra = make_pixels( count * 4 );
+        img::convert_row( bgra.data(), img::PixelFormat::BGRA, rgba.data(), img::PixelFormat::RGBA, count );
+        for( size_t i = 0; i < count; i++ ){
+            ASSERT_EQ( rgba[4*i+0], bgra[4*i+2] );
+            ASSERT_EQ( rgba[4*i+2], bgra[4*i+0] );
+            ASSERT_EQ( rgba[4*i+3], bgra[4*i+3] );
+        }
+    }
+}
+
+/**
+ * RGB565 packs the high bits and expands by replicating them
+ */
+TEST( img_Convert, rgb565 )
+{
+    const size_t count = 37;
+    auto rgba = make_pixels( count * 4 );
+    std::vector<uint8_t> packed( count * 2 );
+    img::convert_row( rgba.data(), img::PixelFormat::RGBA, packed.data(), img::PixelFormat::RGB565, count );
+
+    std::vector<uint8_t> expanded( count * 4 );
+    img::convert_row( packed.data(), img::PixelFormat::RGB565, expanded.data(), img::PixelFormat::RGBA, count );
+
+    for( size_t i = 0; i < count; i++ ){
+        const unsigned value = static_cast<unsigned>( packed[2*i] ) | ( static_cast<unsigned>( packed[2*i+1] ) << 8 );
+        ASSERT_EQ( value, ( ( rgba[4*i] & 0xf8u ) << 8 ) | ( ( rgba[4*i+1] & 0xfcu ) << 3 ) | ( rgba[4*i+2] >> 3u ) );
+
+        ASSERT_EQ( expanded[4*i+0] & 0xf8, rgba[4*i+0] & 0xf8 );
+        ASSERT_EQ( expanded[4*i+1] & 0xfc, rgba[4*i+1] & 0xfc );
+        ASSERT_EQ( expanded[4*i+2] & 0xf8, rgba[4*i+2] & 0xf8 );
+        ASSERT_EQ( expanded[4*i+3], 255 );
+    }
+
+    // White stays white
+    const uint8_t white[] = { 0xff, 0xff };
+    uint8_t output[4];
+    img::convert_row( white, img::PixelFormat::RGB565, output, img::PixelFormat::RGBA, 1 );
+    ASSERT_EQ( output[0], 255 );
+    ASSERT_EQ( output[1], 255 );
+    ASSERT_EQ( output[2], 255 );
+}
+
+/**
+ * Expanding and shrinking in place gives the same answer as separate buffers
+ */
+TEST( img_Convert, in_place )
+{
+    const size_t count = 53;
+    auto gray = make_pixels( count );
+
+    std::vector<uint8_t> expected( count * 4 );
+    img::convert_row( gray.data(), img::PixelFormat::GRAY, expected.data(), img::PixelFormat::RGBA, count );
+
+    std::vector<uint8_t> buffer( count * 4 );
+    std::copy( gray.begin(), gray.end(), buffer.begin() );
+    img::convert_row( buffer.data(), img::PixelFormat::GRAY, buffer.data(), img::PixelFormat::RGBA, count );
+    ASSERT_EQ( buffer, expected );
+
+    // And back again, through a format pair with no direct kernel
+    img::convert_row( buffer.data(), img::PixelFormat::RGBA, buffer.data(), img::PixelFormat::BGR, count );
+    img::convert_row( buffer.data(), img::PixelFormat::BGR, buffer.data(), img::PixelFormat::GRAY, count );
+    for( size_t i = 0; i < count; i++ ){
+        ASSERT_EQ( buffer[i], gray[i] );
+    }
+}
+
+/**
+ * Strided images convert into a tightly packed frame
+ */
+TEST( img_Convert, strided_frame )
+{
+    const size_t cols = 5, rows = 3, stride = 20;
+    auto pixels = make_pixels( stride * rows );
+
+    auto frame = img::convert( pixels, cols, rows, stride, img::PixelFormat::BGR, img::PixelFormat::RGBA );
+    ASSERT_EQ( frame->cols(), cols );
+    ASSERT_EQ( frame->rows(), rows );
+    ASSERT_EQ( frame->channels(), 4u );
+    ASSERT_EQ( frame->get_pixel( 4, 2, 0 ), pixels[2 * stride + 4 * 3 + 2] );
+    ASSERT_EQ( frame->get_pixel( 4, 2, 2 ), pixels[2 * stride + 4 * 3 + 0] );
+
+    ASSERT_THROW( img::convert( std::span<const uint8_t>( pixels.data(), 50 ), cols, rows, stride,
+                                img::PixelFormat::BGR, img::PixelFormat::RGBA ),
+                  std::runtime_error );
+}
+
+/**
+ * Premultiplication rounds exactly and unpremultiplication undoes it for opaque-ish pixels
+ */
+TEST( img_Convert, premultiply )
+{
+    const size_t count = 41;
+    auto rgba = make_pixels( count * 4 );
+    auto result = rgba;
+    img::premultiply_alpha( result.data(), count );
+
+    for( size_t i = 0; i < count; i++ ){
+        for( size_t c = 0; c < 3; c++ ){
+            const unsigned expected = ( rgba[4*i+c] * rgba[4*i+3] + 127u ) / 255u;
+            ASSERT_EQ( result[4*i+c], expected ) << "pixel " << i << " channel " << c;
+        }
+        ASSERT_EQ( result[4*i+3], rgba[4*i+3] );
+    }
+
+    uint8_t px[] = { 200, 100, 50, 255,   10, 20, 30, 0 };
+    img::premultiply_alpha( px, 2 );
+    img::unpremultiply_alpha( px, 2 );
+    ASSERT_EQ( px[0], 200 );
+    ASSERT_EQ( px[1], 100 );
+    ASSERT_EQ( px[2], 50 );
+    ASSERT_EQ( px[4], 0 );
+    ASSERT_EQ( px[7], 0 );
+}
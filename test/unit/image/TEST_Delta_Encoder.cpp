@@ -0,0 +1,137 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Delta_Encoder.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Delta Encoder and Frame Recording Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Delta_Encoder.hpp>
+#include <terminus/image/Frame_Recording.hpp>
+
+using namespace tmns;
+
+namespace {
+
+/**
+ * Draw a small moving square on a white screen
+ */
+void draw_frame( img::Frame& frame, size_t step )
+{
+    frame.set_all_pixels( math::Vector4u( { 255, 255, 255, 255 } ) );
+    for( size_t row = 10; row < 20; row++ ){
+        for( size_t col = 0; col < 10; col++ ){
+            frame.set_pixel( ( col + step * 3 ) % frame.cols(), row, math::Vector4u( { 0, 0, static_cast<uint8_t>( step ), 255 } ) );
+        }
+    }
+}
+
+} // End of anonymous namespace
+
+/**
+ * Small changes produce small packets and decode back to the same frames
+ */
+TEST( img_Delta_Encoder, encode_and_decode )
+{
+    img::Frame frame( img::Dimensions( 320, 240, 4 ) );
+    img::Delta_Encoder encoder( 4 );
+    img::Delta_Decoder decoder;
+    std::vector<uint8_t> packet;
+
+    // A delta before any keyframe is an error
+    ASSERT_THROW( decoder.decode( std::vector<uint8_t>{ 1, 0, 0, 0, 0, 0 } ), std::runtime_error );
+
+    for( size_t step = 0; step < 10; step++ ){
+        draw_frame( frame, step );
+        ASSERT_TRUE( encoder.encode( frame, packet ) );
+        decoder.decode( packet );
+
+        ASSERT_EQ( decoder.frame().dims().size_bytes(), frame.dims().size_bytes() );
+        ASSERT_EQ( decoder.frame().image(), frame.image() ) << "step " << step;
+
+        // Keyframes first and then every 4 packets, deltas touch only 10 rows
+        if( step % 5 == 0 ){
+            ASSERT_EQ( decoder.last_packet(), img::DeltaPacket::KEY );
+        }
+        else {
+            ASSERT_EQ( decoder.last_packet(), img::DeltaPacket::DELTA );
+            ASSERT_LT( packet.size(), 400u );
+        }
+    }
+
+    // Unchanged frames produce no packet
+    ASSERT_FALSE( encoder.encode( frame, packet ) );
+
+    auto stats = encoder.stats();
+    ASSERT_EQ( stats.frames, 11u );
+    ASSERT_EQ( stats.keyframes, 2u );
+    ASSERT_EQ( stats.unchanged, 1u );
+    ASSERT_EQ( stats.changed_rows, 90u );
+    ASSERT_LT( stats.encoded_bytes * 50, stats.raw_bytes );
+
+    // A new size forces a keyframe
+    img::Frame smaller( img::Dimensions( 64, 32, 4 ) );
+    draw_frame( smaller, 1 );
+    ASSERT_TRUE( encoder.encode( smaller, packet ) );
+    decoder.decode( packet );
+    ASSERT_EQ( decoder.last_packet(), img::DeltaPacket::KEY );
+    ASSERT_EQ( decoder.frame().image(), smaller.image() );
+}
+
+/**
+ * Recordings replay every changed frame with its timestamp, and survive being cut short
+ */
+TEST( img_Frame_Recording, write_and_read )
+{
+    auto path = std::filesystem::temp_directory_path() / "TEST_Frame_Recording.trec";
+
+    img::Frame frame( img::Dimensions( 64, 48, 4 ) );
+    std::vector<std::vector<uint8_t>> expected;
+    {
+        auto writer = img::Recording_Writer::create( path, 3 );
+        for( size_t step = 0; step < 6; step++ ){
+            draw_frame( frame, step );
+            writer->write( frame, std::chrono::microseconds( 1000 * step ) );
+            expected.push_back( frame.image() );
+
+            // Repeats are dropped
+            writer->write( frame, std::chrono::microseconds( 1000 * step + 500 ) );
+        }
+    }
+
+    auto reader = img::Recording_Reader::open( path );
+    for( size_t step = 0; step < 6; step++ ){
+        ASSERT_TRUE( reader->next() );
+        ASSERT_EQ( reader->timestamp().count(), static_cast<long>( 1000 * step ) );
+        ASSERT_EQ( reader->frame().image(), expected[step] );
+    }
+    ASSERT_FALSE( reader->next() );
+
+    // Chop the last record in half
+    std::filesystem::resize_file( path, std::filesystem::file_size( path ) - 4 );
+    reader = img::Recording_Reader::open( path );
+    size_t count = 0;
+    while( reader->next() ){
+        count++;
+    }
+    ASSERT_EQ( count, 5u );
+
+    std::filesystem::remove( path );
+}
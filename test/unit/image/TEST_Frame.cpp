@@ -0,0 +1,116 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Frame.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Frame Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <memory>
+#include <utility>
+
+// Project Libraries
+#include <terminus/image/Frame.hpp>
+#include <terminus/image/Frame_View.hpp>
+
+using namespace tmns;
+
+/**
+ * Verify pixels are stored row-major with interleaved channels
+ */
+TEST( img_Frame, pixel_indexing )
+{
+    img::Frame frame( img::Dimensions( 3, 2, 4 ) );
+    frame.set_pixel( 2, 1, 1, 99 );
+
+    ASSERT_EQ( frame.get_pixel( 2, 1, 1 ), 99 );
+    ASSERT_EQ( frame.image()[ ( 1 * 3 + 2 ) * 4 + 1 ], 99 );
+}
+
+/**
+ * Copies share pixels until one of them is written
+ */
+TEST( img_Frame, copy_on_write )
+{
+    auto icon = std::make_shared<img::Frame>( img::Dimensions( 4, 4, 4 ) );
+    icon->set_pixel( 1, 1, 0, 50 );
+
+    img::Frame tinted( *icon );
+    ASSERT_TRUE( icon->is_shared() );
+    ASSERT_EQ( std::as_const( tinted ).data(), std::as_const( *icon ).data() );
+
+    // Writing through a view gives the writer its own buffer
+    img::Frame_View view( tinted );
+    view.set_pixel( 1, 1, math::Vector4u( { 200, 0, 0, 255 } ) );
+    ASSERT_FALSE( icon->is_shared() );
+    ASSERT_NE( std::as_const( tinted ).data(), std::as_const( *icon ).data() );
+    ASSERT_EQ( icon->get_pixel( 1, 1, 0 ), 50 );
+    ASSERT_EQ( tinted.get_pixel( 1, 1, 0 ), 200 );
+
+    // Assignment shares too, and a sole owner writes in place
+    img::Frame other;
+    other = tinted;
+    ASSERT_EQ( other.pixels().data(), tinted.pixels().data() );
+    other.set_pixel( 0, 0, 0, 1 );
+    ASSERT_EQ( tinted.get_pixel( 0, 0, 0 ), 0 );
+    const uint8_t* owned = other.pixels().data();
+    other.set_pixel( 0, 0, 0, 2 );
+    ASSERT_EQ( other.pixels().data(), owned );
+}
+
+/**
+ * A pointer from data() is stale once the frame is copied, and asking again gives a private one
+ */
+TEST( img_Frame, data_pointer_after_copy )
+{
+    img::Frame frame( img::Dimensions( 4, 4, 4 ) );
+    uint8_t* held = frame.data();
+    held[0] = 10;
+
+    // The copy shares the buffer the held pointer writes to
+    const img::Frame copy( frame );
+    ASSERT_EQ( held, copy.pixels().data() );
+
+    // Asking again unshares, so writes no longer reach the copy
+    uint8_t* fresh = frame.data();
+    ASSERT_NE( fresh, held );
+    fresh[0] = 20;
+    ASSERT_EQ( copy.get_pixel( 0, 0, 0 ), 10 );
+    ASSERT_EQ( frame.get_pixel( 0, 0, 0 ), 20 );
+}
+
+/**
+ * Scrolling moves whole rows and leaves the uncovered rows alone
+ */
+TEST( img_Frame, scroll_rows )
+{
+    img::Frame frame( img::Dimensions( 2, 5, 4 ) );
+    for( size_t r = 0; r < 5; r++ ){
+        frame.set_pixel( 1, r, 0, static_cast<uint8_t>( 10 + r ) );
+    }
+
+    frame.scroll_rows( 2 );
+    ASSERT_EQ( frame.get_pixel( 1, 0, 0 ), 12 );
+    ASSERT_EQ( frame.get_pixel( 1, 2, 0 ), 14 );
+    ASSERT_EQ( frame.get_pixel( 1, 4, 0 ), 14 );
+
+    frame.scroll_rows( -1 );
+    ASSERT_EQ( frame.get_pixel( 1, 0, 0 ), 12 );
+    ASSERT_EQ( frame.get_pixel( 1, 1, 0 ), 12 );
+    ASSERT_EQ( frame.get_pixel( 1, 3, 0 ), 14 );
+
+    // Scrolling everything out of view does nothing
+    frame.scroll_rows( 5 );
+    ASSERT_EQ( frame.get_pixel( 1, 1, 0 ), 12 );
+}
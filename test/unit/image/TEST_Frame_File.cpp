@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Frame_File.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Native Frame File API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <filesystem>
+#include <fstream>
+
+// Project Libraries
+#include <terminus/image/Frame_File.hpp>
+
+using namespace tmns;
+
+/**
+ * Build a test frame with a few solid runs and a gradient row
+ */
+img::Frame make_test_frame()
+{
+    img::Frame frame( img::Dimensions( 37, 5, 4 ) );
+    for( size_t r = 0; r < frame.rows(); r++ ){
+        for( size_t c = 0; c < frame.cols(); c++ ){
+            if( r == 2 ){
+                frame.set_pixel( c, r, math::Vector4u( { static_cast<uint8_t>( c ), 10, 20, 255 } ) );
+            } else {
+                frame.set_pixel( c, r, math::Vector4u( { 200, static_cast<uint8_t>( r ), 0, 255 } ) );
+            }
+        }
+    }
+    return frame;
+}
+
+/**
+ * Uncompressed files are referenced straight out of the memory map
+ */
+TEST( img_Frame_File, round_trip_uncompressed )
+{
+    auto frame = make_test_frame();
+    auto path  = std::filesystem::temp_directory_path() / "TEST_Frame_File_none.tfrm";
+
+    img::write_frame_file( frame, path, img::FrameCompression::NONE );
+    auto loaded = img::read_frame_file( path );
+
+    ASSERT_TRUE( loaded->is_external() );
+    ASSERT_EQ( loaded->cols(), frame.cols() );
+    ASSERT_EQ( loaded->rows(), frame.rows() );
+    ASSERT_EQ( loaded->channels(), frame.channels() );
+    ASSERT_EQ( loaded->image(), frame.image() );
+
+    // Writing detaches from the mapping without touching the file
+    loaded->set_pixel( 0, 0, 0, 1 );
+    ASSERT_FALSE( loaded->is_external() );
+    ASSERT_EQ( img::read_frame_file( path )->get_pixel( 0, 0, 0 ), 200 );
+
+    std::filesystem::remove( path );
+}
+
+/**
+ * RLE files decode to the original pixels and are smaller on disk
+ */
+TEST( img_Frame_File, round_trip_rle )
+{
+    auto frame = make_test_frame();
+    frame.set_premultiplied( true );
+
+    auto raw = img::encode_frame_file( frame, img::FrameCompression::NONE );
+    auto rle = img::encode_frame_file( frame, img::FrameCompression::RLE );
+    ASSERT_LT( rle.size(), raw.size() );
+
+    auto loaded = img::frame_from_buffer( rle, nullptr );
+    ASSERT_FALSE( loaded->is_external() );
+    ASSERT_TRUE( loaded->is_premultiplied() );
+    ASSERT_TRUE( img::frame_from_buffer( raw, nullptr )->is_premultiplied() );
+    ASSERT_EQ( loaded->image(), frame.image() );
+}
+
+/**
+ * Malformed buffers are rejected
+ */
+TEST( img_Frame_File, reject_invalid )
+{
+    std::vector<uint8_t> garbage( 64, 0 );
+    ASSERT_THROW( img::frame_from_buffer( garbage, nullptr ), std::runtime_error );
+
+    auto buffer = img::encode_frame_file( make_test_frame(), img::FrameCompression::NONE );
+    buffer.resize( buffer.size() - 1 );
+    ASSERT_THROW( img::frame_from_buffer( buffer, nullptr ), std::runtime_error );
+
+    // Unknown pixel formats are rejected before their size is needed
+    for( uint8_t format : { uint8_t( 0 ), uint8_t( 8 ), uint8_t( 255 ) } ){
+        auto bad_format = img::encode_frame_file( make_test_frame(), img::FrameCompression::NONE );
+        bad_format[6] = format;
+        ASSERT_THROW( img::Frame_File_Header::parse( bad_format ), std::runtime_error );
+    }
+}
+
+/**
+ * Layouts a frame cannot hold are converted to RGB or RGBA as they load
+ */
+TEST( img_Frame_File, convert_other_formats )
+{
+    auto frame = make_test_frame();
+    auto path  = std::filesystem::temp_directory_path() / "TEST_Frame_File_bgra.tfrm";
+
+    // The same bytes read as BGRA come out with red and blue swapped
+    for( auto compression : { img::FrameCompression::NONE, img::FrameCompression::RLE } ){
+        auto buffer = img::encode_frame_file( frame, compression );
+        buffer[6] = static_cast<uint8_t>( img::PixelFormat::BGRA );
+        std::ofstream( path, std::ios::binary ).write( reinterpret_cast<const char*>( buffer.data() ),
+                                                       static_cast<std::streamsize>( buffer.size() ) );
+
+        auto loaded = img::read_frame_file( path );
+        ASSERT_FALSE( loaded->is_external() );
+        ASSERT_EQ( loaded->channels(), 4u );
+        ASSERT_EQ( loaded->get_pixel( 3, 2, 0 ), 20 );
+        ASSERT_EQ( loaded->get_pixel( 3, 2, 2 ), 3 );
+        ASSERT_EQ( loaded->get_pixel( 0, 4, 0 ), 0 );
+        ASSERT_EQ( loaded->get_pixel( 0, 4, 1 ), 4 );
+        ASSERT_EQ( loaded->get_pixel( 0, 4, 2 ), 200 );
+        ASSERT_EQ( loaded->get_pixel( 0, 4, 3 ), 255 );
+    }
+    std::filesystem::remove( path );
+
+    // Two bytes a pixel is RGB565, not gray and alpha
+    img::Frame packed( img::Dimensions( 2, 1, 2 ) );
+    packed.set_pixel( 0, 0, 0, 0x00 );
+    packed.set_pixel( 0, 0, 1, 0xF8 );
+    auto buffer = img::encode_frame_file( packed, img::FrameCompression::NONE );
+    buffer[6] = static_cast<uint8_t>( img::PixelFormat::RGB565 );
+
+    auto loaded = img::frame_from_buffer( buffer, nullptr );
+    ASSERT_EQ( loaded->channels(), 3u );
+    ASSERT_EQ( loaded->get_pixel( 0, 0, 0 ), 255 );
+    ASSERT_EQ( loaded->get_pixel( 0, 0, 1 ), 0 );
+    ASSERT_EQ( loaded->get_pixel( 0, 0, 2 ), 0 );
+}
@@ -0,0 +1,79 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Frame_Pool.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Frame Pool API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/image/Frame_Pool.hpp>
+
+using namespace tmns;
+/**
+ * Released buffers are reused by any image in the same size class
+ */
+TEST( img_Frame_Pool, recycle_by_size_class )
+{
+    img::Frame_Pool pool;
+
+    const uint8_t* first = nullptr;
+    {
+        auto frame = pool.acquire( img::Dimensions( 30, 10, 4 ) );
+        frame->set_pixel( 0, 0, 0, 9 );
+        first = frame->data();
+    }
+    ASSERT_EQ( pool.stats().cached_bytes, 1280u );
+
+    // 1280 bytes lands in the same class, and comes back zeroed
+    auto frame = pool.acquire( img::Dimensions( 20, 16, 4 ) );
+    ASSERT_EQ( frame->data(), first );
+    ASSERT_EQ( frame->get_pixel( 0, 0, 0 ), 0 );
+    ASSERT_EQ( pool.stats().hits, 1u );
+    ASSERT_EQ( pool.stats().misses, 1u );
+
+    // A different class allocates, even one only a little larger
+    auto other = pool.acquire( img::Dimensions( 21, 16, 4 ) );
+    ASSERT_EQ( pool.stats().misses, 2u );
+}
+
+/**
+ * The cache stays under its cap, and frames may outlive the pool
+ */
+TEST( img_Frame_Pool, cap_and_lifetime )
+{
+    img::Frame::ptr_t survivor;
+    {
+        img::Frame_Pool pool( 4096 );
+        {
+            std::vector<img::Frame::ptr_t> frames;
+            for( int i = 0; i < 6; i++ ){
+                frames.push_back( pool.acquire( img::Dimensions( 16, 16, 4 ) ) );
+            }
+        }
+        ASSERT_EQ( pool.stats().cached_bytes, 4096u );
+        ASSERT_EQ( pool.stats().evictions, 2u );
+
+        survivor = pool.acquire( img::Dimensions( 8, 8, 4 ) );
+        pool.trim();
+        ASSERT_EQ( pool.stats().cached_bytes, 0u );
+    }
+    survivor.reset();
+
+    ASSERT_EQ( img::Frame_Pool::size_class( 1 ), 0u );
+    ASSERT_EQ( img::Frame_Pool::size_class( 257 ), 1u );
+    ASSERT_EQ( img::Frame_Pool::class_bytes( 1 ), 320u );
+    ASSERT_EQ( img::Frame_Pool::class_bytes( 4 ), 512u );
+    ASSERT_EQ( img::Frame_Pool::class_bytes( img::Frame_Pool::NUM_CLASSES - 1 ), size_t( 64 ) << 20 );
+    ASSERT_EQ( img::Frame_Pool::size_class( size_t(1) << 40 ), img::Frame_Pool::NUM_CLASSES );
+}
@@ -0,0 +1,126 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Frame_View.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Frame View API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// Project Libraries
+#include <terminus/image/Frame_View.hpp>
+#include <terminus/image/Pixels.hpp>
+
+using namespace tmns;
+
+/**
+ * Reads and writes use the same offset into the frame
+ */
+TEST( img_Frame_View, pixel_offsets )
+{
+    img::Frame frame( img::Dimensions( 10, 8, 4 ) );
+    img::Frame_View view( frame, math::Rect2i( 3, 2, 4, 4 ) );
+
+    view.set_pixel( 1, 1, img::PIXEL_RED() );
+    ASSERT_EQ( frame.get_pixel( 4, 3, 0 ), 255 );
+    ASSERT_EQ( view.get_pixel( 1, 1, 0 ), 255 );
+    ASSERT_EQ( view.get_pixel( 1, 1 )[0], 255 );
+
+    view.set_pixel( 2, 3, 1, 7 );
+    ASSERT_EQ( frame.get_pixel( 5, 5, 1 ), 7 );
+}
+
+/**
+ * Subviews are clipped to their parent, and writes outside the clip are dropped
+ */
+TEST( img_Frame_View, subview_clip )
+{
+    img::Frame frame( img::Dimensions( 10, 8, 4 ) );
+    img::Frame_View view( frame, math::Rect2i( 2, 2, 4, 4 ) );
+
+    // Child hangs off the right and bottom of its parent
+    auto child = view.subview( math::Rect2i( 2, 2, 6, 6 ) );
+    ASSERT_EQ( child.bbox().bl().x(), 4 );
+    ASSERT_EQ( child.clip().width(), 2 );
+    ASSERT_EQ( child.clip().height(), 2 );
+
+    for( size_t r = 0; r < 6; r++ ){
+        for( size_t c = 0; c < 6; c++ ){
+            child.set_pixel( c, r, img::PIXEL_WHITE() );
+        }
+    }
+    size_t written = 0;
+    for( size_t r = 0; r < frame.rows(); r++ ){
+        for( size_t c = 0; c < frame.cols(); c++ ){
+            written += ( frame.get_pixel( c, r, 0 ) > 0 ) ? 1u : 0u;
+        }
+    }
+    ASSERT_EQ( written, 4u );
+    ASSERT_THROW( child.get_pixel( 3, 3, 0 ), std::runtime_error );
+    ASSERT_THROW( child.get_pixel( 3, 3 ), std::runtime_error );
+
+    // Disjoint children have nothing to draw on
+    auto outside = view.subview( math::Rect2i( 10, 10, 3, 3 ) );
+    ASSERT_EQ( outside.clip().width(), 0 );
+    ASSERT_FALSE( outside.is_visible( 0, 0 ) );
+}
+
+/**
+ * The clip stack narrows and restores the writable region
+ */
+TEST( img_Frame_View, clip_stack )
+{
+    img::Frame frame( img::Dimensions( 10, 10, 4 ) );
+    img::Frame_View view( frame );
+
+    view.push_clip( math::Rect2i( 2, 2, 3, 3 ) );
+    view.push_clip( math::Rect2i( 3, 0, 10, 10 ) );
+    ASSERT_FALSE( view.is_visible( 2, 2 ) );
+    ASSERT_TRUE( view.is_visible( 3, 3 ) );
+    ASSERT_FALSE( view.is_visible( 5, 3 ) );
+
+    view.pop_clip();
+    ASSERT_TRUE( view.is_visible( 2, 2 ) );
+    view.pop_clip();
+    ASSERT_TRUE( view.is_visible( 9, 9 ) );
+    ASSERT_THROW( view.pop_clip(), std::runtime_error );
+}
+
+/**
+ * Copies are clipped once and gray frames are expanded to RGBA
+ */
+TEST( img_Frame_View, copy_clipped )
+{
+    img::Frame frame( img::Dimensions( 8, 8, 4 ) );
+    img::Frame_View view( frame );
+    auto child = view.subview( math::Rect2i( 5, 5, 3, 3 ) );
+
+    img::Frame gray( img::Dimensions( 6, 6, 1 ) );
+    for( size_t r = 0; r < 6; r++ ){
+        for( size_t c = 0; c < 6; c++ ){
+            gray.set_pixel( c, r, 0, static_cast<uint8_t>( 10 * r + c + 1 ) );
+        }
+    }
+    child.copy( gray, img::CopyPolicy::FLEXIBILE );
+
+    ASSERT_EQ( frame.get_pixel( 5, 5, 0 ), 1 );
+    ASSERT_EQ( frame.get_pixel( 7, 6, 2 ), 13 );
+    ASSERT_EQ( frame.get_pixel( 7, 7, 3 ), 255 );
+    ASSERT_EQ( frame.get_pixel( 4, 5, 0 ), 0 );
+
+    // View to view copies keep the source offset
+    img::Frame target( img::Dimensions( 8, 8, 4 ) );
+    img::Frame_View target_view( target, math::Rect2i( 1, 1, 4, 4 ) );
+    target_view.copy( img::Frame_View( frame, math::Rect2i( 5, 5, 3, 3 ) ), img::CopyPolicy::FLEXIBILE );
+    ASSERT_EQ( target.get_pixel( 1, 1, 0 ), 1 );
+    ASSERT_EQ( target.get_pixel( 3, 2, 0 ), 13 );
+}
@@ -0,0 +1,189 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_Raster.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Raster API Unit-Test
+ */
+#include <gtest/gtest.h>
+
+// C++ Standard Libraries
+#include <numbers>
+#include <set>
+
+// Project Libraries
+#include <terminus/image/Pixels.hpp>
+#include <terminus/image/Raster.hpp>
+
+using namespace tmns;
+
+namespace {
+
+/// Count pixels whose red channel is set
+size_t count_red( const img::Frame& frame )
+{
+    size_t count = 0;
+    for( size_t r = 0; r < frame.rows(); r++ ){
+        for( size_t c = 0; c < frame.cols(); c++ ){
+            count += ( frame.get_pixel( c, r, 0 ) > 0 ) ? 1u : 0u;
+        }
+    }
+    return count;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Spans are clipped to a subview and land at its offset in the frame
+ */
+TEST( img_Raster, clip_to_view )
+{
+    img::Frame frame( img::Dimensions( 20, 10, 4 ) );
+    img::Frame_View view( frame, math::Rect2i( 5, 2, 10, 5 ) );
+    img::Raster raster( view );
+
+    raster.draw_hline( -100, 100, 0, img::PIXEL_RED() );
+    raster.draw_vline( 0, -100, 100, img::PIXEL_RED() );
+    raster.draw_line( math::ToPoint2<int>( -100000, 3 ), math::ToPoint2<int>( 100000, 3 ), img::PIXEL_RED() );
+
+    ASSERT_EQ( count_red( frame ), 10u + 4u + 9u );
+    ASSERT_EQ( frame.get_pixel( 5, 2, 0 ), 255 );
+    ASSERT_EQ( frame.get_pixel( 14, 2, 0 ), 255 );
+    ASSERT_EQ( frame.get_pixel( 4, 2, 0 ), 0 );
+    ASSERT_EQ( frame.get_pixel( 15, 2, 0 ), 0 );
+    ASSERT_EQ( frame.get_pixel( 5, 6, 0 ), 255 );
+    ASSERT_EQ( frame.get_pixel( 5, 7, 0 ), 0 );
+}
+
+/**
+ * Bresenham lines hit both endpoints and one pixel per major-axis step
+ */
+TEST( img_Raster, bresenham )
+{
+    img::Frame frame( img::Dimensions( 32, 32, 4 ) );
+    img::Raster raster( frame );
+
+    raster.draw_line( math::ToPoint2<int>( 2, 3 ), math::ToPoint2<int>( 27, 14 ), img::PIXEL_RED() );
+    ASSERT_EQ( count_red( frame ), 26u );
+    ASSERT_EQ( frame.get_pixel( 2, 3, 0 ), 255 );
+    ASSERT_EQ( frame.get_pixel( 27, 14, 0 ), 255 );
+}
+
+/**
+ * Wu lines spread full coverage over two pixels per column
+ */
+TEST( img_Raster, wu_line )
+{
+    img::Frame frame( img::Dimensions( 32, 32, 4 ) );
+    img::Raster raster( frame );
+
+    raster.draw_line_aa( math::ToPoint2<double>( 2, 5.25 ), math::ToPoint2<double>( 20, 9.75 ), img::PIXEL_WHITE() );
+    for( size_t c = 3; c < 20; c++ ){
+        unsigned total = 0;
+        for( size_t r = 0; r < frame.rows(); r++ ){
+            total += frame.get_pixel( c, r, 0 );
+        }
+        ASSERT_NEAR( total, 255, 2 ) << "column " << c;
+    }
+}
+
+/**
+ * Circles and ellipses are symmetric and fills cover the boundary pixels
+ */
+TEST( img_Raster, circles_and_ellipses )
+{
+    img::Frame frame( img::Dimensions( 64, 64, 4 ) );
+    img::Raster raster( frame );
+
+    const int radius = 20;
+    raster.fill_circle( math::ToPoint2<int>( 32, 32 ), radius, img::PIXEL_RED() );
+    const double area = std::numbers::pi * ( radius + 0.5 ) * ( radius + 0.5 );
+    ASSERT_NEAR( static_cast<double>( count_red( frame ) ), area, area * 0.02 );
+    for( size_t d = 0; d <= static_cast<size_t>( radius ); d++ ){
+        ASSERT_EQ( frame.get_pixel( 32 + d, 32, 0 ), frame.get_pixel( 32 - d, 32, 0 ) );
+        ASSERT_EQ( frame.get_pixel( 32, 32 + d, 0 ), frame.get_pixel( 32 + d, 32, 0 ) );
+    }
+
+    // The outline sits on the boundary of the fill
+    img::Frame outline( img::Dimensions( 64, 64, 4 ) );
+    img::Raster( outline ).draw_circle( math::ToPoint2<int>( 32, 32 ), radius, img::PIXEL_RED() );
+    for( size_t r = 0; r < 64; r++ ){
+        for( size_t c = 0; c < 64; c++ ){
+            if( outline.get_pixel( c, r, 0 ) > 0 ){
+                ASSERT_GT( frame.get_pixel( c, r, 0 ), 0 );
+            }
+        }
+    }
+
+    img::Frame ellipse( img::Dimensions( 64, 64, 4 ) );
+    img::Raster( ellipse ).fill_ellipse( math::ToPoint2<int>( 32, 32 ), 25, 10, img::PIXEL_RED() );
+    const double ellipse_area = std::numbers::pi * 25.5 * 10.5;
+    ASSERT_NEAR( static_cast<double>( count_red( ellipse ) ), ellipse_area, ellipse_area * 0.02 );
+    ASSERT_EQ( ellipse.get_pixel( 57, 32, 0 ), 255 );
+    ASSERT_EQ( ellipse.get_pixel( 58, 32, 0 ), 0 );
+    ASSERT_EQ( ellipse.get_pixel( 32, 42, 0 ), 255 );
+    ASSERT_EQ( ellipse.get_pixel( 32, 43, 0 ), 0 );
+}
+
+/**
+ * Polygons fill pixels whose centers are inside, using the even-odd rule
+ */
+TEST( img_Raster, fill_polygon )
+{
+    img::Frame frame( img::Dimensions( 32, 32, 4 ) );
+    img::Raster raster( frame );
+
+    raster.fill_polygon( { math::ToPoint2<double>( 2, 2 ),
+                           math::ToPoint2<double>( 12, 2 ),
+                           math::ToPoint2<double>( 12, 8 ),
+                           math::ToPoint2<double>( 2, 8 ) },
+                         img::PIXEL_RED() );
+    ASSERT_EQ( count_red( frame ), 60u );
+
+    // A five-pointed star leaves its center empty
+    img::Frame star( img::Dimensions( 64, 64, 4 ) );
+    std::vector<math::Point2d> points;
+    for( int i = 0; i < 5; i++ ){
+        const double angle = -std::numbers::pi / 2 + i * 4 * std::numbers::pi / 5;
+        points.push_back( math::ToPoint2<double>( 32 + 30 * std::cos( angle ), 32 + 30 * std::sin( angle ) ) );
+    }
+    img::Raster( star ).fill_polygon( points, img::PIXEL_RED() );
+    ASSERT_EQ( star.get_pixel( 32, 32, 0 ), 0 );
+    ASSERT_EQ( star.get_pixel( 32, 8, 0 ), 255 );
+}
+
+/**
+ * Translucent wide polylines blend every covered pixel exactly once
+ */
+TEST( img_Raster, polyline_single_blend )
+{
+    const std::vector<math::Point2d> points { math::ToPoint2<double>( 5, 5 ),
+                                              math::ToPoint2<double>( 40, 8 ),
+                                              math::ToPoint2<double>( 20, 40 ),
+                                              math::ToPoint2<double>( 50, 50 ) };
+
+    for( auto join : { img::LineJoin::MITER, img::LineJoin::ROUND, img::LineJoin::BEVEL } ){
+        for( double width : { 1.0, 6.0 } ){
+            img::Frame frame( img::Dimensions( 64, 64, 4 ) );
+            img::Raster raster( frame );
+            raster.draw_polyline( points, width, img::PIXEL_RED( 128 ), join, true );
+
+            std::set<uint8_t> values;
+            for( size_t r = 0; r < frame.rows(); r++ ){
+                for( size_t c = 0; c < frame.cols(); c++ ){
+                    values.insert( frame.get_pixel( c, r, 0 ) );
+                }
+            }
+            ASSERT_EQ( values, std::set<uint8_t>( { 0, 128 } ) ) << to_string( join ) << " width " << width;
+        }
+    }
+}
@@ -0,0 +1,340 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    main.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Offline converter from source images (PNG, etc) to native Terminus assets.
+ */
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/core/Resource_Bundle.hpp>
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_File.hpp>
+
+// OpenCV Libraries
+#include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/imgcodecs.hpp>
+
+using namespace tmns;
+
+/**
+ * Print usage instructions
+ */
+void usage( const std::string& app_name )
+{
+    std::cerr << "usage: " << app_name << " convert <input-image> <output.tfrm> [--rle]" << std::endl;
+    std::cerr << "       " << app_name << " bundle <resource-dir> <output.tbdl> [--rle]" << std::endl;
+    std::cerr << "       " << app_name << " embed <resource-dir> <output.cpp> [--format GRAY|GRAY_ALPHA|RGB|RGBA] [--rle] <name> ..." << std::endl;
+}
+
+/**
+ * Check if a file is an image which should be converted to a native frame
+ */
+bool is_source_image( const std::filesystem::path& pathname )
+{
+    auto ext = pathname.extension().string();
+    std::transform( ext.begin(), ext.end(), ext.begin(), []( unsigned char c ){ return static_cast<char>( std::tolower( c ) ); } );
+    return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp";
+}
+
+/**
+ * Parse the optional compression flag shared by all commands
+ */
+bool parse_compression( const std::vector<std::string>& args,
+                        size_t                          start,
+                        img::FrameCompression&          compression )
+{
+    compression = img::FrameCompression::NONE;
+    for( size_t i = start; i < args.size(); i++ ){
+        if( args[i] == "--rle" ){
+            compression = img::FrameCompression::RLE;
+        } else {
+            std::cerr << "error: Unknown argument: " << args[i] << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Decode any image OpenCV understands into an RGBA frame.
+ */
+img::Frame::ptr_t load_source_image( const std::filesystem::path& pathname )
+{
+    auto image = cv::imread( pathname.native(), cv::IMREAD_UNCHANGED );
+    if( image.empty() ){
+        throw std::runtime_error( "Unable to read image: " + pathname.native() );
+    }
+    if( image.depth() != CV_8U ){
+        image.convertTo( image, CV_8U, 1.0 / 257.0 );
+    }
+
+    // OpenCV stores color as BGR(A)
+    img::PixelFormat format;
+    switch( image.channels() ){
+        case 1: format = img::PixelFormat::GRAY;       break;
+        case 2: format = img::PixelFormat::GRAY_ALPHA; break;
+        case 3: format = img::PixelFormat::BGR;        break;
+        case 4: format = img::PixelFormat::BGRA;       break;
+        default:
+            throw std::runtime_error( "Unsupported channel count in " + pathname.native() );
+    }
+
+    const size_t rows = static_cast<size_t>( image.rows );
+    auto frame = img::convert( std::span<const uint8_t>( image.data, image.step[0] * rows ),
+                               static_cast<size_t>( image.cols ),
+                               rows,
+                               image.step[0],
+                               format,
+                               img::PixelFormat::RGBA );
+    return frame;
+}
+
+/**
+ * Premultiply an RGBA frame, the layout the compositor expects for cached assets
+ */
+img::Frame::ptr_t premultiply( img::Frame::ptr_t frame )
+{
+    img::premultiply_alpha( frame->data(), frame->cols() * frame->rows() );
+    frame->set_premultiplied( true );
+    return frame;
+}
+
+/**
+ * Convert an RGBA frame into another pixel format.  RGBA output is premultiplied.
+ */
+img::Frame::ptr_t convert_format( const img::Frame& rgba,
+                                  img::PixelFormat  format )
+{
+    if( format == img::PixelFormat::RGBA ){
+        return premultiply( std::make_shared<img::Frame>( rgba ) );
+    }
+    return img::convert( std::span<const uint8_t>( rgba.data(), rgba.dims().size_bytes() ),
+                         rgba.cols(),
+                         rgba.rows(),
+                         rgba.cols() * 4,
+                         img::PixelFormat::RGBA,
+                         format );
+}
+
+/**
+ * Convert a single image into a `.tfrm` file
+ */
+int run_convert( const std::vector<std::string>& args )
+{
+    if( args.size() < 2 ){
+        return 1;
+    }
+    std::filesystem::path input( args[0] );
+    std::filesystem::path output( args[1] );
+    img::FrameCompression compression;
+    if( !parse_compression( args, 2, compression ) ){
+        return 1;
+    }
+
+    auto frame = premultiply( load_source_image( input ) );
+
+    if( output.has_parent_path() ){
+        std::filesystem::create_directories( output.parent_path() );
+    }
+    img::write_frame_file( *frame, output, compression );
+    return 0;
+}
+
+/**
+ * Pack an entire resource folder into a single bundle.
+ *
+ * Images are stored as `.tfrm` frames under their original relative path, so
+ * `images/logo/logo_360_144.png` is looked up by that exact name.  Everything else
+ * is stored byte-for-byte.
+ */
+int run_bundle( const std::vector<std::string>& args )
+{
+    if( args.size() < 2 ){
+        return 1;
+    }
+    std::filesystem::path input( args[0] );
+    std::filesystem::path output( args[1] );
+    img::FrameCompression compression;
+    if( !parse_compression( args, 2, compression ) ){
+        return 1;
+    }
+
+    std::map<std::string,std::vector<uint8_t>> entries;
+    for( const auto& entry : std::filesystem::recursive_directory_iterator( input ) ){
+        if( !entry.is_regular_file() ){
+            continue;
+        }
+        auto name = std::filesystem::relative( entry.path(), input ).generic_string();
+
+        if( is_source_image( entry.path() ) ){
+            entries[name] = img::encode_frame_file( *premultiply( load_source_image( entry.path() ) ), compression );
+        }
+        else {
+            std::ifstream fin( entry.path(), std::ios::binary );
+            entries[name] = std::vector<uint8_t>( std::istreambuf_iterator<char>( fin ),
+                                                  std::istreambuf_iterator<char>() );
+        }
+    }
+
+    auto buffer = core::Resource_Bundle::pack( entries );
+
+    if( output.has_parent_path() ){
+        std::filesystem::create_directories( output.parent_path() );
+    }
+    std::ofstream fout( output, std::ios::binary | std::ios::trunc );
+    fout.write( reinterpret_cast<const char*>( buffer.data() ),
+                static_cast<std::streamsize>( buffer.size() ) );
+    if( !fout.good() ){
+        throw std::runtime_error( "Unable to write bundle: " + output.native() );
+    }
+
+    std::cout << "Packed " << entries.size() << " resources into " << output.native()
+              << " (" << buffer.size() << " bytes)" << std::endl;
+    return 0;
+}
+
+/**
+ * Emit a C++ source file holding a bundle of the named resources as a constexpr array.
+ *
+ * See cmake/TerminusEmbedResources.cmake.
+ */
+int run_embed( const std::vector<std::string>& args )
+{
+    if( args.size() < 3 ){
+        return 1;
+    }
+    std::filesystem::path input( args[0] );
+    std::filesystem::path output( args[1] );
+
+    auto compression = img::FrameCompression::NONE;
+    auto format      = img::PixelFormat::RGBA;
+    std::vector<std::string> names;
+    for( size_t i = 2; i < args.size(); i++ ){
+        if( args[i] == "--rle" ){
+            compression = img::FrameCompression::RLE;
+        }
+        else if( args[i] == "--format" && i + 1 < args.size() ){
+            const auto& value = args[++i];
+            bool found = false;
+            for( auto candidate : { img::PixelFormat::GRAY, img::PixelFormat::GRAY_ALPHA,
+                                    img::PixelFormat::RGB,  img::PixelFormat::RGBA } ){
+                if( img::to_string( candidate ) == value ){
+                    format = candidate;
+                    found  = true;
+                }
+            }
+            if( !found ){
+                std::cerr << "error: Unknown pixel format: " << value << std::endl;
+                return 1;
+            }
+        }
+        else {
+            names.push_back( args[i] );
+        }
+    }
+
+    std::map<std::string,std::vector<uint8_t>> entries;
+    for( const auto& name : names ){
+        auto pathname = input / name;
+        if( is_source_image( pathname ) ){
+            auto frame = convert_format( *load_source_image( pathname ), format );
+            entries[name] = img::encode_frame_file( *frame, compression );
+        }
+        else {
+            std::ifstream fin( pathname, std::ios::binary );
+            if( !fin.good() ){
+                throw std::runtime_error( "Unable to read resource: " + pathname.native() );
+            }
+            entries[name] = std::vector<uint8_t>( std::istreambuf_iterator<char>( fin ),
+                                                  std::istreambuf_iterator<char>() );
+        }
+    }
+
+    auto buffer = core::Resource_Bundle::pack( entries );
+
+    std::stringstream sout;
+    sout << "// Generated by asset_builder.  Do not edit." << std::endl;
+    sout << "#include <terminus/core/Embedded_Resources.hpp>" << std::endl << std::endl;
+    sout << "namespace tmns::core {" << std::endl << std::endl;
+    sout << "namespace {" << std::endl << std::endl;
+    sout << "alignas(" << core::Resource_Bundle::DATA_ALIGNMENT << ") constexpr uint8_t EMBEDDED_BUNDLE["
+         << buffer.size() << "] = {";
+    for( size_t i = 0; i < buffer.size(); i++ ){
+        if( i % 16 == 0 ){
+            sout << std::endl << "    ";
+        }
+        sout << "0x" << std::hex << std::setw( 2 ) << std::setfill( '0' ) << static_cast<int>( buffer[i] ) << ",";
+    }
+    sout << std::dec << std::endl << "};" << std::endl << std::endl;
+    sout << "} // End of anonymous namespace" << std::endl << std::endl;
+    sout << "std::span<const uint8_t> embedded_bundle()" << std::endl;
+    sout << "{" << std::endl;
+    sout << "    return std::span<const uint8_t>( EMBEDDED_BUNDLE );" << std::endl;
+    sout << "}" << std::endl << std::endl;
+    sout << "} // End of tmns::core namespace" << std::endl;
+
+    if( output.has_parent_path() ){
+        std::filesystem::create_directories( output.parent_path() );
+    }
+    std::ofstream fout( output, std::ios::trunc );
+    fout << sout.str();
+    if( !fout.good() ){
+        throw std::runtime_error( "Unable to write source: " + output.native() );
+    }
+    return 0;
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc < 2 ){
+        usage( argv[0] );
+        return 1;
+    }
+
+    std::string command( argv[1] );
+    std::vector<std::string> args( argv + 2, argv + argc );
+
+    try {
+        int result = 1;
+        if( command == "convert" ){
+            result = run_convert( args );
+        }
+        else if( command == "bundle" ){
+            result = run_bundle( args );
+        }
+        else if( command == "embed" ){
+            result = run_embed( args );
+        }
+        if( result != 0 ){
+            usage( argv[0] );
+        }
+        return result;
+    }
+    catch( const std::exception& e ){
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,181 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    main.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Plays back session recordings (.trec) into individual frames.
+ */
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/image/Convert.hpp>
+#include <terminus/image/Frame_File.hpp>
+#include <terminus/image/Frame_Recording.hpp>
+
+// OpenCV Libraries
+#include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/imgcodecs.hpp>
+
+using namespace tmns;
+
+/**
+ * Print usage instructions
+ */
+void usage( const std::string& app_name )
+{
+    std::cerr << "usage: " << app_name << " info <recording.trec>" << std::endl;
+    std::cerr << "       " << app_name << " extract <recording.trec> <output-dir> [--png] [--every N]" << std::endl;
+}
+
+/**
+ * Write a frame as a PNG.  OpenCV expects BGR(A).
+ */
+void write_png( const img::Frame&            frame,
+                const std::filesystem::path& pathname )
+{
+    auto bgra = img::convert( frame.pixels(),
+                              frame.cols(),
+                              frame.rows(),
+                              frame.cols() * frame.channels(),
+                              img::pixel_format_from_channels( frame.channels() ),
+                              img::PixelFormat::BGRA );
+    cv::Mat image( static_cast<int>( bgra->rows() ),
+                   static_cast<int>( bgra->cols() ),
+                   CV_8UC4,
+                   bgra->data(),
+                   bgra->cols() * 4 );
+    if( !cv::imwrite( pathname.native(), image ) ){
+        throw std::runtime_error( "Unable to write image: " + pathname.native() );
+    }
+}
+
+/**
+ * Summarize a recording
+ */
+int run_info( const std::vector<std::string>& args )
+{
+    if( args.size() != 1 ){
+        return 1;
+    }
+    auto reader = img::Recording_Reader::open( args[0] );
+
+    size_t packets   = 0;
+    size_t keyframes = 0;
+    while( reader->next() ){
+        packets++;
+        if( reader->decoder().last_packet() == img::DeltaPacket::KEY ){
+            keyframes++;
+        }
+    }
+
+    const auto& frame = reader->frame();
+    std::cout << "Recording: " << args[0] << std::endl;
+    std::cout << "  - Frame Size: " << frame.cols() << " x " << frame.rows()
+              << ", channels: " << frame.channels() << std::endl;
+    std::cout << "  - Packets: " << packets << ", Keyframes: " << keyframes << std::endl;
+    std::cout << "  - Duration: " << std::fixed << std::setprecision( 3 )
+              << static_cast<double>( reader->timestamp().count() ) / 1e6 << " s" << std::endl;
+    return 0;
+}
+
+/**
+ * Reconstruct every frame in a recording and write it to a folder.
+ *
+ * Frames are named after their timestamp in microseconds, so gaps where the screen did not
+ * change are visible from the names alone.
+ */
+int run_extract( const std::vector<std::string>& args )
+{
+    if( args.size() < 2 ){
+        return 1;
+    }
+    std::filesystem::path input( args[0] );
+    std::filesystem::path output( args[1] );
+
+    bool   as_png = false;
+    size_t every  = 1;
+    for( size_t i = 2; i < args.size(); i++ ){
+        if( args[i] == "--png" ){
+            as_png = true;
+        }
+        else if( args[i] == "--every" && i + 1 < args.size() ){
+            every = std::max<size_t>( 1, std::stoul( args[++i] ) );
+        }
+        else {
+            std::cerr << "error: Unknown argument: " << args[i] << std::endl;
+            return 1;
+        }
+    }
+
+    auto reader = img::Recording_Reader::open( input );
+    std::filesystem::create_directories( output );
+
+    size_t index   = 0;
+    size_t written = 0;
+    while( reader->next() ){
+        if( index++ % every != 0 ){
+            continue;
+        }
+        std::stringstream name;
+        name << "frame_" << std::setw( 12 ) << std::setfill( '0' ) << reader->timestamp().count()
+             << ( as_png ? ".png" : ".tfrm" );
+
+        if( as_png ){
+            write_png( reader->frame(), output / name.str() );
+        }
+        else {
+            img::write_frame_file( reader->frame(), output / name.str(), img::FrameCompression::RLE );
+        }
+        written++;
+    }
+
+    std::cout << "Wrote " << written << " of " << index << " frames to " << output.native() << std::endl;
+    return 0;
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc < 2 ){
+        usage( argv[0] );
+        return 1;
+    }
+
+    std::string command( argv[1] );
+    std::vector<std::string> args( argv + 2, argv + argc );
+
+    try {
+        int result = 1;
+        if( command == "info" ){
+            result = run_info( args );
+        }
+        else if( command == "extract" ){
+            result = run_extract( args );
+        }
+        if( result != 0 ){
+            usage( argv[0] );
+        }
+        return result;
+    }
+    catch( const std::exception& e ){
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+}
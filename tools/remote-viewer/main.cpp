@@ -0,0 +1,181 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    main.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ *
+ * @details Views and drives a unit serving its screen with Driver_Remote.
+ */
+
+// C++ Standard Libraries
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <terminus/driver/Remote_Client.hpp>
+#include <terminus/image/Convert.hpp>
+
+// OpenCV Libraries
+#include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/highgui.hpp>
+#include <opencv4/opencv2/imgcodecs.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
+
+using namespace tmns;
+using namespace std::chrono_literals;
+
+/// Name of the viewer window
+const std::string WINDOW_NAME { "Terminus Remote Viewer" };
+
+/**
+ * Print usage instructions
+ */
+void usage( const std::string& app_name )
+{
+    std::cerr << "usage: " << app_name << " <unix:path | tcp:host:port> [--scale N] [--snapshot out.png]" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "  --scale N           : Show the screen N times larger.  Default 2." << std::endl;
+    std::cerr << "  --snapshot out.png  : Save the first full screen and exit, without a window." << std::endl;
+}
+
+/**
+ * Map a highgui key code to a Key.  Special keys use the GTK key symbols.
+ */
+drv::Key translate_key( int code )
+{
+    if( code >= 'a' && code <= 'z' ){
+        return static_cast<drv::Key>( code - 'a' + 'A' );
+    }
+    if( ( code >= 'A' && code <= 'Z' ) || ( code >= '0' && code <= '9' ) ){
+        return static_cast<drv::Key>( code );
+    }
+    switch( code ){
+        case ' ':    return drv::Key::SPACE;
+        case ',':    return drv::Key::COMMA;
+        case '-':    return drv::Key::MINUS;
+        case '.':    return drv::Key::PERIOD;
+        case '/':    return drv::Key::SLASH;
+        case '=':    return drv::Key::EQUAL;
+        case 8:      return drv::Key::BACKSPACE;
+        case 9:      return drv::Key::TAB;
+        case 10:
+        case 13:     return drv::Key::ENTER;
+        case 27:     return drv::Key::ESCAPE;
+        case 0xFF50: return drv::Key::HOME;
+        case 0xFF51: return drv::Key::LEFT;
+        case 0xFF52: return drv::Key::UP;
+        case 0xFF53: return drv::Key::RIGHT;
+        case 0xFF54: return drv::Key::DOWN;
+        case 0xFF55: return drv::Key::PAGE_UP;
+        case 0xFF56: return drv::Key::PAGE_DOWN;
+        case 0xFF57: return drv::Key::END;
+        case 0xFFFF: return drv::Key::DELETE;
+        default:     return drv::Key::NONE;
+    }
+}
+
+/**
+ * Convert the remote screen into an OpenCV image.  OpenCV expects BGR(A).
+ */
+cv::Mat to_image( const img::Frame& frame,
+                  int               scale )
+{
+    auto bgra = img::convert( frame.pixels(),
+                              frame.cols(),
+                              frame.rows(),
+                              frame.cols() * frame.channels(),
+                              img::pixel_format_from_channels( frame.channels() ),
+                              img::PixelFormat::BGRA );
+    cv::Mat image( static_cast<int>( bgra->rows() ),
+                   static_cast<int>( bgra->cols() ),
+                   CV_8UC4,
+                   bgra->data(),
+                   bgra->cols() * 4 );
+
+    cv::Mat scaled;
+    cv::resize( image, scaled, cv::Size(), scale, scale, cv::INTER_NEAREST );
+    return scaled;
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc < 2 ){
+        usage( argv[0] );
+        return 1;
+    }
+
+    int                   scale = 2;
+    std::filesystem::path snapshot;
+    for( int i = 2; i < argc; i++ ){
+        std::string arg( argv[i] );
+        if( arg == "--scale" && i + 1 < argc ){
+            scale = std::max( 1, std::stoi( argv[++i] ) );
+        }
+        else if( arg == "--snapshot" && i + 1 < argc ){
+            snapshot = argv[++i];
+        }
+        else {
+            std::cerr << "error: Unknown argument: " << arg << std::endl;
+            usage( argv[0] );
+            return 1;
+        }
+    }
+
+    try {
+        auto client = drv::Remote_Client::connect( drv::Remote_Endpoint::parse( argv[1] ) );
+
+        size_t shown = 0;
+        while( client->poll( 10ms ) ){
+            if( !client->has_frame() ){
+                continue;
+            }
+
+            // Scripts can grab a single screen without opening a window
+            if( !snapshot.empty() ){
+                if( !cv::imwrite( snapshot.native(), to_image( client->frame(), scale ) ) ){
+                    throw std::runtime_error( "Unable to write image: " + snapshot.native() );
+                }
+                std::cout << client->to_log_string();
+                return 0;
+            }
+
+            if( client->frames_received() != shown ){
+                cv::imshow( WINDOW_NAME, to_image( client->frame(), scale ) );
+                shown = client->frames_received();
+            }
+
+            // highgui only reports presses, so each key is sent as a press and release
+            const int code = cv::waitKeyEx( 1 );
+            const auto key = translate_key( code );
+            if( key != drv::Key::NONE ){
+                client->send_key( drv::Input_Action::PRESS, key );
+                client->send_key( drv::Input_Action::RELEASE, key );
+            }
+
+            // Closing the window ends the session
+            if( cv::getWindowProperty( WINDOW_NAME, cv::WND_PROP_VISIBLE ) < 1 ){
+                break;
+            }
+        }
+        std::cout << client->to_log_string();
+        cv::destroyAllWindows();
+        return 0;
+    }
+    catch( const std::exception& e ){
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+}